@@ -0,0 +1,787 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `jeyson-lib`.
+//
+// Changelog:
+//      2026.10.15 Initial version.
+//                 Added lazy document benchmarks.
+//                 Added projection parsing benchmark.
+//                 Added v1 string view delivery benchmark.
+//                 Added streaming writer benchmarks.
+//                 Added scalar getter benchmarks.
+//                 Added native backend and destruction benchmarks.
+//                 Added v1 value layout benchmarks.
+//                 Added v1 object storage benchmarks.
+//      2026.10.16 Added v1 monotonic buffer benchmark.
+//                 Aligned and nothrow allocations are counted.
+////////////////////////////////////////////////////////////////////////////////
+#include "pfs/jeyson/json.hpp"
+#include "pfs/jeyson/document.hpp"
+#include "pfs/jeyson/lazy.hpp"
+#include "pfs/jeyson/writer.hpp"
+#include "pfs/jeyson/backend/jansson.hpp"
+#include "pfs/jeyson/backend/native.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#if JEYSON__BENCHMARK_JANSSON_HOOKS
+#   include <jansson.h>
+#endif
+
+// Usage: jeyson-bench [--csv] [--iterations N] [--filter SUBSTRING] [DATA_DIR]
+//
+// Prints one record per (file, benchmark) pair: JSON Lines by default, CSV
+// with `--csv`. Fields:
+//      file            - file name from DATA_DIR;
+//      benchmark       - benchmark name;
+//      iterations      - number of measured iterations;
+//      bytes           - JSON text size (input for parsers, output for serializers);
+//      nodes           - number of JSON values in the document;
+//      seconds         - best time of one iteration;
+//      mb_per_s        - bytes / seconds (MiB/s);
+//      ns_per_node     - seconds / nodes (ns);
+//      allocations     - number of allocations per iteration (C++ heap and,
+//                        if available, jansson allocation functions);
+//      allocated_bytes - number of bytes allocated per iteration.
+
+#ifndef JEYSON__BENCHMARK_DATA_DIR
+#   define JEYSON__BENCHMARK_DATA_DIR "data"
+#endif
+
+namespace {
+
+struct allocation_counters
+{
+    std::size_t count {0};
+    std::size_t bytes {0};
+};
+
+allocation_counters g_allocations;
+
+} // namespace
+
+// Benchmark is single-threaded, counters are not atomic
+void * operator new (std::size_t n)
+{
+    g_allocations.count++;
+    g_allocations.bytes += n;
+
+    if (auto p = std::malloc(n > 0 ? n : 1))
+        return p;
+
+    throw std::bad_alloc{};
+}
+
+void operator delete (void * p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete (void * p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+void * operator new (std::size_t n, std::nothrow_t const &) noexcept
+{
+    g_allocations.count++;
+    g_allocations.bytes += n;
+    return std::malloc(n > 0 ? n : 1);
+}
+
+void operator delete (void * p, std::nothrow_t const &) noexcept
+{
+    std::free(p);
+}
+
+#if __cpp_aligned_new
+// Over-aligned blocks are placed in a larger `malloc()` block, pointer to the
+// latter is stored right before the aligned block
+void * operator new (std::size_t n, std::align_val_t al, std::nothrow_t const &) noexcept
+{
+    g_allocations.count++;
+    g_allocations.bytes += n;
+
+    auto align = (std::max)(static_cast<std::size_t>(al), sizeof(void *));
+    auto raw = std::malloc(n + align + sizeof(void *));
+
+    if (raw == nullptr)
+        return nullptr;
+
+    auto addr = reinterpret_cast<std::uintptr_t>(raw) + sizeof(void *);
+    auto p = reinterpret_cast<void *>((addr + align - 1) & ~(align - 1));
+    std::memcpy(static_cast<char *>(p) - sizeof(void *), & raw, sizeof(void *));
+    return p;
+}
+
+void * operator new (std::size_t n, std::align_val_t al)
+{
+    if (auto p = operator new(n, al, std::nothrow))
+        return p;
+
+    throw std::bad_alloc{};
+}
+
+void operator delete (void * p, std::align_val_t) noexcept
+{
+    if (p != nullptr) {
+        void * raw = nullptr;
+        std::memcpy(& raw, static_cast<char *>(p) - sizeof(void *), sizeof(void *));
+        std::free(raw);
+    }
+}
+
+void operator delete (void * p, std::size_t, std::align_val_t al) noexcept
+{
+    operator delete(p, al);
+}
+
+void operator delete (void * p, std::align_val_t al, std::nothrow_t const &) noexcept
+{
+    operator delete(p, al);
+}
+#endif
+
+// Defined in v1_parse.cpp: v1 headers can not be included together with
+// `json.hpp` (both define `jeyson::errc`).
+bool v1_parse_callbacks (std::string const & content);
+bool v1_parse_static (std::string const & content);
+bool v1_parse_views (std::string const & content);
+
+// Build and traversal of `v1::value<>` and `v1::compact_value` DOMs
+// (allocations of the build are the footprint of the DOM)
+bool v1_build_value (std::string const & content);
+bool v1_build_compact (std::string const & content);
+bool v1_prepare_trees (std::string const & content);
+void v1_release_trees ();
+std::size_t v1_traverse_value ();
+std::size_t v1_traverse_compact ();
+
+// `v1::value` object storages: "map" (default), "sorted", "ordered" and
+// "hashed". Lookup, insertion and iteration use the member names of every
+// object of the document, the functions return the number of members.
+bool v1_build_objects (std::string const & content, char const * storage);
+std::size_t v1_prepare_objects (std::string const & content);
+void v1_release_objects ();
+std::size_t v1_objects_insert (char const * storage);
+std::size_t v1_objects_lookup (char const * storage);
+std::size_t v1_objects_iterate (char const * storage);
+
+#if __cplusplus >= 201703L
+// Build of `v1::pmr::value` DOM in a monotonic buffer, dropped without
+// destruction (compare with `v1_build_value`)
+bool v1_build_monotonic (std::string const & content);
+#endif
+
+namespace {
+
+namespace fs = pfs::filesystem;
+using backend = jeyson::backend::jansson;
+using json = jeyson::json<backend>;
+using json_ref = jeyson::json_ref<backend>;
+using json_view = jeyson::json_view<backend>;
+using json_document = jeyson::json_document<backend>;
+using lazy_document = jeyson::lazy_document<backend>;
+using json_writer = jeyson::json_writer<backend>;
+using native_json = jeyson::json<jeyson::backend::native>;
+using native_json_ref = jeyson::json_ref<jeyson::backend::native>;
+using native_json_view = jeyson::json_view<jeyson::backend::native>;
+
+#if JEYSON__BENCHMARK_JANSSON_HOOKS
+void * counting_malloc (std::size_t n)
+{
+    g_allocations.count++;
+    g_allocations.bytes += n;
+    return std::malloc(n);
+}
+
+void counting_free (void * p)
+{
+    std::free(p);
+}
+#endif
+
+struct options
+{
+    bool csv {false};
+    int iterations {10};
+    std::string filter;
+    std::string data_dir {JEYSON__BENCHMARK_DATA_DIR};
+};
+
+struct result
+{
+    char const * file;
+    char const * benchmark;
+    int iterations;
+    std::size_t bytes;
+    std::size_t nodes;
+    double seconds;
+    double allocations;
+    double allocated_bytes;
+};
+
+void print_header (options const & opts)
+{
+    if (opts.csv) {
+        std::printf("file,benchmark,iterations,bytes,nodes,seconds,mb_per_s,ns_per_node"
+            ",allocations,allocated_bytes\n");
+    }
+}
+
+void print (options const & opts, result const & r)
+{
+    auto mbs = static_cast<double>(r.bytes) / r.seconds / (1024 * 1024);
+    auto ns_per_node = r.nodes > 0 ? r.seconds * 1e9 / static_cast<double>(r.nodes) : 0.0;
+
+    if (opts.csv) {
+        std::printf("%s,%s,%d,%zu,%zu,%.9f,%.2f,%.3f,%.1f,%.1f\n"
+            , r.file, r.benchmark, r.iterations, r.bytes, r.nodes, r.seconds
+            , mbs, ns_per_node, r.allocations, r.allocated_bytes);
+    } else {
+        std::printf("{\"file\":\"%s\",\"benchmark\":\"%s\",\"iterations\":%d"
+            ",\"bytes\":%zu,\"nodes\":%zu,\"seconds\":%.9f,\"mb_per_s\":%.2f"
+            ",\"ns_per_node\":%.3f,\"allocations\":%.1f,\"allocated_bytes\":%.1f}\n"
+            , r.file, r.benchmark, r.iterations, r.bytes, r.nodes, r.seconds
+            , mbs, ns_per_node, r.allocations, r.allocated_bytes);
+    }
+
+    std::fflush(stdout);
+}
+
+// Runs @a f @a iterations times, measures the best iteration time and the
+// average number of allocations. Results of the iteration (e.g. parsed values)
+// must be released inside @a f to count them in.
+template <typename F>
+result measure (int iterations, F && f)
+{
+    result r {};
+    r.iterations = iterations;
+    r.seconds = (std::numeric_limits<double>::max)();
+
+    auto before = g_allocations;
+
+    for (int i = 0; i < iterations; i++) {
+        auto start = std::chrono::steady_clock::now();
+        f();
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        r.seconds = (std::min)(r.seconds, elapsed.count());
+    }
+
+    r.allocations = static_cast<double>(g_allocations.count - before.count) / iterations;
+    r.allocated_bytes = static_cast<double>(g_allocations.bytes - before.bytes) / iterations;
+
+    return r;
+}
+
+template <typename View>
+std::size_t count_nodes (View v)
+{
+    std::size_t n = 1;
+
+    if (v.is_structured()) {
+        for (auto it = v.begin(); it != v.end(); ++it)
+            n += count_nodes(*it);
+    }
+
+    return n;
+}
+
+template <typename Ref>
+std::size_t traverse_iterators (Ref const & r)
+{
+    std::size_t n = 1;
+
+    if (r.is_structured()) {
+        for (auto it = r.begin(); it != r.end(); ++it)
+            n += traverse_iterators(*it);
+    }
+
+    return n;
+}
+
+template <typename T>
+std::size_t traverse_for_each (T const & j)
+{
+    using reference = typename T::const_reference;
+    std::size_t n = 1;
+
+    j.for_each([& n] (reference r) {
+        if (r.is_structured())
+            n += traverse_for_each(r);
+        else
+            n++;
+    });
+
+    return n;
+}
+
+// Builds copy of @a v by `insert()`/`push_back()` as responses are usually built
+json build_tree (json_view v)
+{
+    if (v.is_null())
+        return json{nullptr};
+
+    if (v.is_bool())
+        return json{v.template get<bool>()};
+
+    if (v.is_integer())
+        return json{v.template get<std::intmax_t>()};
+
+    if (v.is_real())
+        return json{v.template get<double>()};
+
+    if (v.is_string())
+        return json{v.template get<std::string>()};
+
+    if (v.size() == 0)
+        return json::parse(std::string{v.is_array() ? "[]" : "{}"});
+
+    json result;
+
+    for (auto it = v.begin(); it != v.end(); ++it) {
+        if (v.is_array())
+            result.push_back(build_tree(*it));
+        else
+            result.insert(it.key(), build_tree(*it));
+    }
+
+    return result;
+}
+
+// Writes @a v by the streaming writer events
+void write_events (json_view v, json_writer & w)
+{
+    if (v.is_null()) {
+        w.value(nullptr);
+    } else if (v.is_bool()) {
+        w.value(v.template get<bool>());
+    } else if (v.is_integer()) {
+        w.value(v.template get<std::intmax_t>());
+    } else if (v.is_real()) {
+        w.value(v.template get<double>());
+    } else if (v.is_string()) {
+        w.value(v.template get<std::string>());
+    } else if (v.is_array()) {
+        w.begin_array();
+
+        for (auto it = v.begin(); it != v.end(); ++it)
+            write_events(*it, w);
+
+        w.end_array();
+    } else {
+        w.begin_object();
+
+        for (auto it = v.begin(); it != v.end(); ++it) {
+            w.key(it.key());
+            write_events(*it, w);
+        }
+
+        w.end_object();
+    }
+}
+
+// Collects numbers and booleans of @a v
+template <typename Ref>
+void collect_scalars (Ref const & r, std::vector<Ref> & result)
+{
+    if (r.is_structured()) {
+        for (auto it = r.begin(); it != r.end(); ++it)
+            collect_scalars(Ref{*it}, result);
+    } else if (r.is_integer() || r.is_real() || r.is_bool()) {
+        result.push_back(r);
+    }
+}
+
+// Sums the scalars by `get<T>()` (each value is read several times to get
+// measurable time)
+template <typename T, typename Ref>
+bool sum_scalars (std::vector<Ref> const & scalars, double & sum)
+{
+    bool ok = true;
+
+    for (int i = 0; i < 16; i++) {
+        for (auto const & r: scalars) {
+            bool success = true;
+            sum += static_cast<double>(r.template get<T>(success));
+            ok = ok && success;
+        }
+    }
+
+    return ok;
+}
+
+bool read_file (std::string const & path, std::string & content)
+{
+    std::ifstream ifs(path, std::ios::binary);
+
+    if (!ifs.is_open())
+        return false;
+
+    content.assign(std::istreambuf_iterator<char>{ifs}, std::istreambuf_iterator<char>{});
+    return true;
+}
+
+std::size_t output_size (fs::path const & path)
+{
+    std::error_code ec;
+    auto size = fs::file_size(path, ec);
+    return ec ? 0 : static_cast<std::size_t>(size);
+}
+
+bool parse_options (int argc, char * argv[], options & opts)
+{
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--csv") == 0) {
+            opts.csv = true;
+        } else if (std::strcmp(argv[i], "--iterations") == 0 && i + 1 < argc) {
+            opts.iterations = (std::max)(1, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+            opts.filter = argv[++i];
+        } else if (argv[i][0] == '-') {
+            return false;
+        } else {
+            opts.data_dir = argv[i];
+        }
+    }
+
+    return true;
+}
+
+} // namespace
+
+int main (int argc, char * argv[])
+{
+    options opts;
+
+    if (!parse_options(argc, argv, opts)) {
+        std::fprintf(stderr, "Usage: %s [--csv] [--iterations N] [--filter SUBSTRING] [DATA_DIR]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+#if JEYSON__BENCHMARK_JANSSON_HOOKS
+    json_set_alloc_funcs(counting_malloc, counting_free);
+#endif
+
+    char const * files[] = {"canada.json", "citm_catalog.json", "twitter.json"};
+    auto out_path = fs::temp_directory_path() / pfs::utf8_decode_path("jeyson-bench.json");
+    std::vector<std::string> const projection {"/statuses/*/user/screen_name", "/search_metadata/count"};
+
+    print_header(opts);
+
+    for (auto filename: files) {
+        std::string content;
+        auto path = opts.data_dir + "/" + filename;
+
+        if (!read_file(path, content)) {
+            std::fprintf(stderr, "Open file %s failure\n", path.c_str());
+            return EXIT_FAILURE;
+        }
+
+        json j;
+
+        try {
+            j = json::parse(content);
+        } catch (jeyson::error const & ex) {
+            std::fprintf(stderr, "Parse file %s failure: %s\n", filename, ex.what());
+            return EXIT_FAILURE;
+        }
+
+        json const & cj = j;
+        auto nodes = count_nodes(json_view{cj});
+        auto copy = j.deep_copy();
+        bool failure = false;
+
+        auto selected = [&] (char const * benchmark) {
+            return opts.filter.empty() || std::string{benchmark}.find(opts.filter) != std::string::npos;
+        };
+
+        auto run = [&] (char const * benchmark, std::function<std::size_t ()> f) {
+            if (!selected(benchmark))
+                return;
+
+            std::size_t bytes = 0;
+            auto r = measure(opts.iterations, [&] { bytes = f(); });
+            r.file = filename;
+            r.benchmark = benchmark;
+            r.bytes = bytes;
+            r.nodes = nodes;
+            print(opts, r);
+        };
+
+        run("parse", [&] {
+            backend::set_parser_engine(backend::parser_engine::jansson);
+            json::parse(content);
+            return content.size();
+        });
+
+        run("parse_native", [&] {
+            backend::set_parser_engine(backend::parser_engine::native);
+            json::parse(content);
+            return content.size();
+        });
+
+        run("parse_native_backend", [&] {
+            native_json::parse(content);
+            return content.size();
+        });
+
+        run("parse_document", [&] {
+            backend::set_parser_engine(backend::parser_engine::native);
+            json_document::parse(content);
+            return content.size();
+        });
+
+        run("parse_lazy", [&] {
+            lazy_document::parse(content);
+            return content.size();
+        });
+
+        run("parse_lazy_materialize", [&] {
+            lazy_document::parse(content).to_json();
+            return content.size();
+        });
+
+        // Selects a few values of twitter.json, other inputs are skipped entirely
+        run("parse_projection", [&] {
+            json::parse(content, projection);
+            return content.size();
+        });
+
+        run("v1_parse_callbacks", [&] {
+            failure = failure || !v1_parse_callbacks(content);
+            return content.size();
+        });
+
+        run("v1_parse_static", [&] {
+            failure = failure || !v1_parse_static(content);
+            return content.size();
+        });
+
+        run("v1_parse_views", [&] {
+            failure = failure || !v1_parse_views(content);
+            return content.size();
+        });
+
+        run("v1_build_value", [&] {
+            failure = failure || !v1_build_value(content);
+            return content.size();
+        });
+
+        run("v1_build_compact", [&] {
+            failure = failure || !v1_build_compact(content);
+            return content.size();
+        });
+
+        if (selected("v1_traverse")) {
+            failure = failure || !v1_prepare_trees(content);
+
+            run("v1_traverse_value", [&] {
+                failure = failure || v1_traverse_value() != nodes;
+                return content.size();
+            });
+
+            run("v1_traverse_compact", [&] {
+                failure = failure || v1_traverse_compact() != nodes;
+                return content.size();
+            });
+
+            v1_release_trees();
+        }
+
+#if __cplusplus >= 201703L
+        run("v1_build_monotonic", [&] {
+            failure = failure || !v1_build_monotonic(content);
+            return content.size();
+        });
+#endif
+
+        struct {
+            char const * storage;
+            char const * build;
+            char const * insert;
+            char const * lookup;
+            char const * iterate;
+        } const object_benchmarks[] = {
+              {"map", "v1_build_objects_map", "v1_objects_insert_map"
+                , "v1_objects_lookup_map", "v1_objects_iterate_map"}
+            , {"sorted", "v1_build_objects_sorted", "v1_objects_insert_sorted"
+                , "v1_objects_lookup_sorted", "v1_objects_iterate_sorted"}
+            , {"ordered", "v1_build_objects_ordered", "v1_objects_insert_ordered"
+                , "v1_objects_lookup_ordered", "v1_objects_iterate_ordered"}
+            , {"hashed", "v1_build_objects_hashed", "v1_objects_insert_hashed"
+                , "v1_objects_lookup_hashed", "v1_objects_iterate_hashed"}
+        };
+
+        for (auto const & b: object_benchmarks) {
+            run(b.build, [&] {
+                failure = failure || !v1_build_objects(content, b.storage);
+                return content.size();
+            });
+        }
+
+        if (selected("v1_objects")) {
+            auto members = v1_prepare_objects(content);
+            failure = failure || members == 0;
+
+            for (auto const & b: object_benchmarks) {
+                run(b.insert, [&] {
+                    failure = failure || v1_objects_insert(b.storage) != members;
+                    return content.size();
+                });
+
+                run(b.lookup, [&] {
+                    failure = failure || v1_objects_lookup(b.storage) != members;
+                    return content.size();
+                });
+
+                run(b.iterate, [&] {
+                    failure = failure || v1_objects_iterate(b.storage) != members;
+                    return content.size();
+                });
+            }
+
+            v1_release_objects();
+        }
+
+        run("to_string", [&] {
+            return cj.to_string().size();
+        });
+
+        // Both read the values from the parsed tree
+        run("build_to_string", [&] {
+            return build_tree(json_view{cj}).to_string().size();
+        });
+
+        run("writer_compact", [&] {
+            json_writer w;
+            write_events(json_view{cj}, w);
+            failure = failure || !w.complete();
+            return w.str().size();
+        });
+
+        run("save_compact", [&] {
+            j.save(out_path, true);
+            return output_size(out_path);
+        });
+
+        run("save_compact_precision_17", [&] {
+            j.save(out_path, true, 0, 17);
+            return output_size(out_path);
+        });
+
+        run("save_pretty", [&] {
+            j.save(out_path, false, 4);
+            return output_size(out_path);
+        });
+
+        run("traverse_iterators", [&] {
+            failure = failure || traverse_iterators(json_ref{j}) != nodes;
+            return content.size();
+        });
+
+        run("traverse_for_each", [&] {
+            failure = failure || traverse_for_each(cj) != nodes;
+            return content.size();
+        });
+
+        run("traverse_view", [&] {
+            failure = failure || count_nodes(json_view{cj}) != nodes;
+            return content.size();
+        });
+
+        auto nj = native_json::parse(content);
+        native_json const & cnj = nj;
+
+        run("traverse_native_iterators", [&] {
+            failure = failure || traverse_iterators(native_json_ref{nj}) != nodes;
+            return content.size();
+        });
+
+        run("traverse_native_for_each", [&] {
+            failure = failure || traverse_for_each(cnj) != nodes;
+            return content.size();
+        });
+
+        run("traverse_native_view", [&] {
+            failure = failure || count_nodes(native_json_view{cnj}) != nodes;
+            return content.size();
+        });
+
+        // Trees are parsed in advance, only the release is measured
+        if (selected("destroy")) {
+            std::vector<json> trees;
+            std::vector<native_json> native_trees;
+
+            backend::set_parser_engine(backend::parser_engine::jansson);
+
+            for (int i = 0; i < opts.iterations; i++) {
+                trees.push_back(json::parse(content));
+                native_trees.push_back(native_json::parse(content));
+            }
+
+            run("destroy", [&] {
+                trees.pop_back();
+                return content.size();
+            });
+
+            run("destroy_native", [&] {
+                native_trees.pop_back();
+                return content.size();
+            });
+        }
+
+        run("deep_copy", [&] {
+            cj.deep_copy();
+            return content.size();
+        });
+
+        run("equal", [&] {
+            failure = failure || !(cj == copy);
+            return content.size();
+        });
+
+        std::vector<json_view> view_scalars;
+        std::vector<json_ref> ref_scalars;
+        collect_scalars(json_view{cj}, view_scalars);
+        collect_scalars(json_ref{j}, ref_scalars);
+        double sum = 0;
+
+        run("get_view_double", [&] {
+            failure = failure || !sum_scalars<double>(view_scalars, sum);
+            return content.size();
+        });
+
+        run("get_view_int", [&] {
+            failure = failure || !sum_scalars<std::int64_t>(view_scalars, sum);
+            return content.size();
+        });
+
+        run("get_ref_double", [&] {
+            failure = failure || !sum_scalars<double>(ref_scalars, sum);
+            return content.size();
+        });
+
+        if (failure) {
+            std::fprintf(stderr, "Benchmark on file %s failure\n", filename);
+            return EXIT_FAILURE;
+        }
+    }
+
+    fs::remove(out_path);
+
+    return EXIT_SUCCESS;
+}
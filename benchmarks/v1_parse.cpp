@@ -0,0 +1,450 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `jeyson-lib`.
+//
+// Changelog:
+//      2026.10.15 Initial version.
+//                 Added string view delivery benchmark.
+//                 Added v1 value layout benchmarks.
+//                 Added object storage benchmarks.
+//      2026.10.16 Added monotonic buffer benchmark.
+////////////////////////////////////////////////////////////////////////////////
+#include "pfs/jeyson/v1/parser.hpp"
+#include "pfs/jeyson/v1/compact.hpp"
+#include "pfs/jeyson/v1/object_types.hpp"
+#include "pfs/string_view.hpp"
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#if __cplusplus >= 201703L
+#   include "pfs/jeyson/v1/pmr.hpp"
+#   include <memory_resource>
+#endif
+
+namespace {
+
+// Handler with member functions: calls are dispatched statically.
+struct static_handler
+{
+    using string_type = std::string;
+    using number_type = double;
+
+    std::size_t nodes {0};
+    bool failure {false};
+
+    void on_error (std::error_code const &) { failure = true; }
+    void on_null () { nodes++; }
+    void on_true () { nodes++; }
+    void on_false () { nodes++; }
+    void on_number (number_type &&) { nodes++; }
+    void on_string (string_type &&) { nodes++; }
+    void on_member_name (string_type &&) {}
+    void on_begin_array () { nodes++; }
+    void on_end_array () {}
+    void on_begin_object () { nodes++; }
+    void on_end_object () {}
+};
+
+// Handler receives strings as views (no allocation for escape-free strings).
+struct view_handler
+{
+    using string_type = pfs::string_view;
+    using number_type = double;
+
+    std::size_t nodes {0};
+    bool failure {false};
+
+    void on_error (std::error_code const &) { failure = true; }
+    void on_null () { nodes++; }
+    void on_true () { nodes++; }
+    void on_false () { nodes++; }
+    void on_number (number_type &&) { nodes++; }
+    void on_string (string_type &&) { nodes++; }
+    void on_member_name (string_type &&) {}
+    void on_begin_array () { nodes++; }
+    void on_end_array () {}
+    void on_begin_object () { nodes++; }
+    void on_end_object () {}
+};
+
+using type_erased_handler = jeyson::v1::basic_callbacks<std::string, double>;
+
+using json_value = jeyson::v1::value<>;
+using compact_value = jeyson::v1::compact_value;
+using type_enum = jeyson::v1::type_enum;
+
+template <template <typename, typename> class ObjectType>
+using object_value = jeyson::v1::value<bool, std::intmax_t, std::uintmax_t
+    , double, std::string, jeyson::v1::array_type, ObjectType>;
+
+template <typename Value>
+inline void assign_string (Value & v, pfs::string_view s)
+{
+    v = Value{typename Value::string_type(s.data(), s.size())};
+}
+
+inline void assign_string (compact_value & v, pfs::string_view s)
+{
+    v = compact_value{s};
+}
+
+// Builds DOM by `operator []`. Strings are delivered as views, so allocations
+// are made by the DOM only.
+template <typename Value>
+struct dom_builder
+{
+    using string_type = pfs::string_view;
+    using number_type = Value;
+
+    Value root;
+    std::vector<Value *> stack;
+    typename Value::object_type::key_type name;
+    bool failure {false};
+
+    Value & slot ()
+    {
+        if (stack.empty())
+            return root;
+
+        auto & top = *stack.back();
+
+        if (top.is_array())
+            return top[top.size()];
+
+        return top[name];
+    }
+
+    void on_error (std::error_code const &) { failure = true; }
+    void on_null () { slot() = Value{}; }
+    void on_true () { slot() = Value{true}; }
+    void on_false () { slot() = Value{false}; }
+    void on_number (number_type && n) { slot() = std::move(n); }
+    void on_string (string_type && s) { assign_string(slot(), s); }
+    void on_member_name (string_type && s) { name.assign(s.data(), s.size()); }
+
+    void on_begin_array ()
+    {
+        auto & v = slot();
+        v = Value{type_enum::array};
+        stack.push_back(& v);
+    }
+
+    void on_end_array () { stack.pop_back(); }
+
+    void on_begin_object ()
+    {
+        auto & v = slot();
+        v = Value{type_enum::object};
+        stack.push_back(& v);
+    }
+
+    void on_end_object () { stack.pop_back(); }
+};
+
+template <typename Value>
+bool build (std::string const & content, Value & result)
+{
+    dom_builder<Value> b;
+    auto pos = jeyson::v1::parse(content.cbegin(), content.cend()
+        , jeyson::v1::relaxed_policy(), b);
+
+    if (pos == content.cbegin() || b.failure)
+        return false;
+
+    result = std::move(b.root);
+    return true;
+}
+
+// Counts the nodes and sums the numbers
+template <typename Value>
+std::size_t traverse (Value & v, double & sum)
+{
+    std::size_t n = 1;
+
+    if (v.is_array() || v.is_object()) {
+        for (auto it = v.begin(), last = v.end(); it != last; ++it)
+            n += traverse(*it, sum);
+    } else if (v.is_number()) {
+        sum += v.template get<double>();
+    }
+
+    return n;
+}
+
+std::unique_ptr<json_value> g_value;
+std::unique_ptr<compact_value> g_compact;
+
+// Collects member names of every object of the document (duplicate names
+// are skipped)
+struct key_collector
+{
+    using string_type = pfs::string_view;
+    using number_type = double;
+
+    std::vector<std::vector<std::string>> objects;
+    std::vector<std::size_t> stack; // Object positions (-1 for arrays)
+    bool failure {false};
+
+    void on_error (std::error_code const &) { failure = true; }
+    void on_null () {}
+    void on_true () {}
+    void on_false () {}
+    void on_number (number_type &&) {}
+    void on_string (string_type &&) {}
+
+    void on_member_name (string_type && s)
+    {
+        auto & keys = objects[stack.back()];
+        std::string key(s.data(), s.size());
+
+        if (std::find(keys.begin(), keys.end(), key) == keys.end())
+            keys.push_back(std::move(key));
+    }
+
+    void on_begin_array () { stack.push_back(static_cast<std::size_t>(-1)); }
+    void on_end_array () { stack.pop_back(); }
+
+    void on_begin_object ()
+    {
+        stack.push_back(objects.size());
+        objects.emplace_back();
+    }
+
+    void on_end_object () { stack.pop_back(); }
+};
+
+// Objects of the document with every storage, keys are mapped to 1
+struct object_storages
+{
+    std::vector<std::vector<std::string>> keys;
+    std::vector<std::map<std::string, int>> map;
+    std::vector<jeyson::v1::sorted_object<std::string, int>> sorted;
+    std::vector<jeyson::v1::ordered_object<std::string, int>> ordered;
+    std::vector<jeyson::v1::hashed_object<std::string, int>> hashed;
+};
+
+std::unique_ptr<object_storages> g_objects;
+
+template <typename Object>
+std::size_t insert_objects (std::vector<std::vector<std::string>> const & keys
+    , std::vector<Object> & objects)
+{
+    std::size_t n = 0;
+
+    objects.clear();
+    objects.resize(keys.size());
+
+    for (std::size_t i = 0; i < keys.size(); i++) {
+        for (auto const & key: keys[i])
+            objects[i][key] = 1;
+
+        n += objects[i].size();
+    }
+
+    return n;
+}
+
+template <typename Object>
+std::size_t lookup_objects (std::vector<std::vector<std::string>> const & keys
+    , std::vector<Object> const & objects)
+{
+    std::size_t n = 0;
+
+    for (std::size_t i = 0; i < keys.size(); i++) {
+        for (auto const & key: keys[i]) {
+            auto pos = objects[i].find(key);
+
+            if (pos != objects[i].end())
+                n += pos->second;
+        }
+    }
+
+    return n;
+}
+
+template <typename Object>
+std::size_t iterate_objects (std::vector<Object> const & objects)
+{
+    std::size_t n = 0;
+
+    for (auto const & obj: objects) {
+        for (auto const & m: obj)
+            n += m.second;
+    }
+
+    return n;
+}
+
+// Calls `f` with the objects of the storage named `storage`
+// ("map", "sorted", "ordered" or "hashed")
+template <typename F>
+std::size_t with_storage (char const * storage, F && f)
+{
+    std::string name {storage};
+
+    if (name == "map")
+        return f(g_objects->map);
+    else if (name == "sorted")
+        return f(g_objects->sorted);
+    else if (name == "ordered")
+        return f(g_objects->ordered);
+    else if (name == "hashed")
+        return f(g_objects->hashed);
+
+    return 0;
+}
+
+} // namespace
+
+bool v1_parse_callbacks (std::string const & content)
+{
+    type_erased_handler h;
+    auto pos = jeyson::v1::parse(content.cbegin(), content.cend()
+        , jeyson::v1::relaxed_policy(), h);
+    return pos != content.cbegin();
+}
+
+bool v1_parse_static (std::string const & content)
+{
+    static_handler h;
+    auto pos = jeyson::v1::parse(content.cbegin(), content.cend()
+        , jeyson::v1::relaxed_policy(), h);
+    return pos != content.cbegin() && !h.failure;
+}
+
+bool v1_parse_views (std::string const & content)
+{
+    view_handler h;
+    auto pos = jeyson::v1::parse(content.cbegin(), content.cend()
+        , jeyson::v1::relaxed_policy(), h);
+    return pos != content.cbegin() && !h.failure;
+}
+
+bool v1_build_value (std::string const & content)
+{
+    json_value v;
+    return build(content, v);
+}
+
+bool v1_build_compact (std::string const & content)
+{
+    compact_value v;
+    return build(content, v);
+}
+
+bool v1_prepare_trees (std::string const & content)
+{
+    g_value.reset(new json_value);
+    g_compact.reset(new compact_value);
+
+    return build(content, *g_value) && build(content, *g_compact);
+}
+
+void v1_release_trees ()
+{
+    g_value.reset();
+    g_compact.reset();
+}
+
+std::size_t v1_traverse_value ()
+{
+    double sum = 0;
+    return traverse(*g_value, sum);
+}
+
+std::size_t v1_traverse_compact ()
+{
+    double sum = 0;
+    return traverse(*g_compact, sum);
+}
+
+bool v1_build_objects (std::string const & content, char const * storage)
+{
+    std::string name {storage};
+
+    if (name == "map") {
+        json_value v;
+        return build(content, v);
+    } else if (name == "sorted") {
+        object_value<jeyson::v1::sorted_object> v;
+        return build(content, v);
+    } else if (name == "ordered") {
+        object_value<jeyson::v1::ordered_object> v;
+        return build(content, v);
+    } else if (name == "hashed") {
+        object_value<jeyson::v1::hashed_object> v;
+        return build(content, v);
+    }
+
+    return false;
+}
+
+std::size_t v1_prepare_objects (std::string const & content)
+{
+    key_collector c;
+    auto pos = jeyson::v1::parse(content.cbegin(), content.cend()
+        , jeyson::v1::relaxed_policy(), c);
+
+    if (pos == content.cbegin() || c.failure)
+        return 0;
+
+    g_objects.reset(new object_storages);
+    g_objects->keys = std::move(c.objects);
+
+    std::size_t n = 0;
+
+    for (auto const & keys: g_objects->keys)
+        n += keys.size();
+
+    insert_objects(g_objects->keys, g_objects->map);
+    insert_objects(g_objects->keys, g_objects->sorted);
+    insert_objects(g_objects->keys, g_objects->ordered);
+    insert_objects(g_objects->keys, g_objects->hashed);
+
+    return n;
+}
+
+void v1_release_objects ()
+{
+    g_objects.reset();
+}
+
+std::size_t v1_objects_insert (char const * storage)
+{
+    return with_storage(storage, [] (auto & objects) {
+        typename std::decay<decltype(objects)>::type fresh;
+        return insert_objects(g_objects->keys, fresh);
+    });
+}
+
+std::size_t v1_objects_lookup (char const * storage)
+{
+    return with_storage(storage, [] (auto const & objects) {
+        return lookup_objects(g_objects->keys, objects);
+    });
+}
+
+std::size_t v1_objects_iterate (char const * storage)
+{
+    return with_storage(storage, [] (auto const & objects) {
+        return iterate_objects(objects);
+    });
+}
+
+#if __cplusplus >= 201703L
+bool v1_build_monotonic (std::string const & content)
+{
+    std::pmr::monotonic_buffer_resource buffer;
+    jeyson::v1::pmr::resource_scope scope {& buffer};
+    jeyson::v1::pmr::value v;
+
+    auto success = build(content, v);
+    v.discard();
+    return success;
+}
+#endif
@@ -5,9 +5,18 @@
 //
 // Changelog:
 //      2022.02.07 Initial version.
+//      2026.10.15 Added parser engine selection.
+//                 Object member references do not copy keys.
+//                 Added view representation.
+//                 Added copy-on-write group to value representation.
+//                 Added parallel parsing settings.
+//                 Added inline type tag and scalar access.
+//      2026.10.16 Scalars are read by jansson API calls.
 ////////////////////////////////////////////////////////////////////////////////
 #pragma once
 #include "pfs/jeyson/exports.hpp"
+#include <atomic>
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <cstdint>
@@ -25,23 +34,58 @@ struct jansson
     using string_type = std::string;
     using key_type    = std::string;
 
-#if _MSC_VER
-// Eliminate warning:
-// C4251: 'jeyson::backend::jansson::index_type::key': class 'std::basic_string<char,std::char_traits<char>,std::allocator<char>>' 
-// needs to have dll-interface to be used by clients of union 'jeyson::backend::jansson::index_type'
-#   pragma warning(push)
-#   pragma warning(disable: 4251)
-#endif
-    union JEYSON__EXPORT index_type {
-        size_type i {0};
-        key_type key;
+    /// Parser engines for `json<jansson>::parse()`.
+    enum class parser_engine
+    {
+          jansson // `json_loadb()` / `json_load_file()`
+        , native  // Two-stage parser: SIMD structural index + tree builder
+    };
+
+    /**
+     * Sets parser engine for subsequent `json<jansson>::parse()` calls
+     * (process-wide). Default is @c parser_engine::jansson unless the library
+     * is built with `JEYSON__NATIVE_PARSER_DEFAULT` option.
+     */
+    static JEYSON__EXPORT void set_parser_engine (parser_engine engine) noexcept;
+
+    /// Returns current parser engine.
+    static JEYSON__EXPORT parser_engine get_parser_engine () noexcept;
 
-        index_type () {}
-        ~index_type () {}
+    /// Parallel parsing settings for `json<jansson>::parse()`.
+    struct parallel_parsing
+    {
+        // Minimum input size in bytes, zero disables parallel parsing
+        std::size_t threshold {0};
+
+        // Number of parsing threads, zero means `std::thread::hardware_concurrency()`
+        std::size_t threads {0};
+    };
+
+    /**
+     * Sets parallel parsing settings (process-wide, disabled by default).
+     * Input (buffer or file) of @a threshold bytes and more which root is an
+     * array is split on element boundaries, the element ranges are parsed by
+     * the current parser engine on worker threads and spliced into a single
+     * array.
+     * Smaller input, input of other kind and input with errors is parsed
+     * serially, so results and error messages do not depend on the settings.
+     * Parsing inside a `json_document` scope is always serial.
+     */
+    static JEYSON__EXPORT void set_parallel_parsing (parallel_parsing const & settings) noexcept;
+
+    /// Returns current parallel parsing settings.
+    static JEYSON__EXPORT parallel_parsing get_parallel_parsing () noexcept;
+
+    /**
+     * Position of the referenced element in the parent container: index for
+     * array elements, jansson object iterator for object members. The iterator
+     * borrows key storage of the parent and remains valid while the member
+     * exists, so references to object members do not copy keys.
+     */
+    union index_type {
+        size_type i {0};
+        void * iter;
     };
-#if _MSC_VER
-#   pragma warning(pop)
-#endif
 
     class basic_rep
     {
@@ -49,8 +93,16 @@ struct jansson
         json_t * _ptr {nullptr};
     };
 
+    /// Number of `rep` instances sharing the same tree (copy-on-write group).
+    using share_counter = std::atomic<std::size_t>;
+
     class JEYSON__EXPORT rep : public basic_rep
     {
+    public:
+        // Copy-on-write group, `nullptr` if the tree is not shared.
+        // Mutable: copying of a constant value joins it to the group.
+        mutable std::atomic<share_counter *> _shares {nullptr};
+
     public:
         rep ();
         rep (rep const & other);
@@ -70,11 +122,82 @@ struct jansson
         ~ref ();
 
         ref (json_t * ptr, json_t * parent, size_type index);
-        ref (json_t * ptr, json_t * parent, std::string const & key);
+        ref (json_t * ptr, json_t * parent, void * iter);
         ref (ref const &);
         ref (ref &&);
     };
 
+    /**
+     * Non-owning representation: borrowed pointer and cached type tag
+     * (`json_type` value or -1 for invalid view). Trivially copyable.
+     */
+    class view: public basic_rep
+    {
+    public:
+        int _type {-1};
+    };
+
+    /// Type tag of the value, same as `json_type` of jansson.
+    enum class type_tag: int
+    {
+          invalid = -1
+        , object = 0
+        , array
+        , string
+        , integer
+        , real
+        , true_value
+        , false_value
+        , null
+    };
+
+    /**
+     * Inline access to the type of jansson values (the same as `json_typeof()`
+     * does). The header mirrors public `json_t` structure and is checked by
+     * the library (see `src/jansson.cpp`). Payloads are private to jansson,
+     * so scalars are read by the jansson API calls.
+     */
+    struct layout
+    {
+        struct header
+        {
+            int type;
+            std::size_t refcount;
+        };
+
+        template <typename T>
+        static T read (json_t const * p, std::size_t offset) noexcept
+        {
+            T result;
+            std::memcpy(& result, reinterpret_cast<char const *>(p) + offset, sizeof(T));
+            return result;
+        }
+    };
+
+    static type_tag type_of (basic_rep const & r) noexcept
+    {
+        return r._ptr
+            ? static_cast<type_tag>(layout::read<int>(r._ptr, offsetof(layout::header, type)))
+            : type_tag::invalid;
+    }
+
+    static type_tag type_of (view const & v) noexcept
+    {
+        return static_cast<type_tag>(v._type);
+    }
+
+    /// Integer value, @a r must be an integer.
+    static JEYSON__EXPORT std::intmax_t integer_of (basic_rep const & r) noexcept;
+
+    /// Real value, @a r must be a real.
+    static JEYSON__EXPORT double real_of (basic_rep const & r) noexcept;
+
+    /// String data, @a r must be a string.
+    static JEYSON__EXPORT char const * string_data_of (basic_rep const & r) noexcept;
+
+    /// String length, @a r must be a string.
+    static JEYSON__EXPORT std::size_t string_length_of (basic_rep const & r) noexcept;
+
     class iterator_rep
     {
     public:
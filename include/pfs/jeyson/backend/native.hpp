@@ -0,0 +1,186 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `jeyson-lib`.
+//
+// Changelog:
+//      2026.10.15 Initial version.
+//      2026.10.16 Documented dependency on the jansson backend.
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "pfs/jeyson/exports.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace jeyson {
+namespace backend {
+
+/**
+ * First-party backend with contiguous node layout.
+ *
+ * Every JSON value is a 16-byte tagged cell: scalars are stored in the cell
+ * itself, arrays are contiguous vectors of cells, objects are contiguous
+ * vectors of key/value cell pairs in insertion order. Objects with more than
+ * @c index_threshold members are additionally indexed by an open addressing
+ * hash table placed after the members, smaller objects are searched linearly.
+ *
+ * The tree is owned by a document shared by the values and references.
+ * Blocks built by the parser and by copying (strings, element and member
+ * vectors) are allocated from the document pool and released all at once
+ * with the document. Blocks created by modifications are allocated from the
+ * heap and released when the value is replaced.
+ *
+ * References, views and iterators point to the cells directly, so (like
+ * iterators of `std::vector`) they are invalidated by adding elements to the
+ * container that holds the cell and by replacing the value that contains it.
+ * The whole document is kept alive by the references.
+ *
+ * Copies of a value share the document until the first modification, a value
+ * that has given out mutable references or iterators is copied deeply.
+ *
+ * The backend is built with the `JEYSON__ENABLE_JANSSON` option only: parsing
+ * of selected paths reuses the projection loader of the jansson backend and
+ * converts its result.
+ */
+struct native
+{
+    using size_type   = std::size_t;
+    using string_type = std::string;
+    using key_type    = std::string;
+
+    /// Objects with more members are indexed by a hash table.
+    static constexpr std::size_t index_threshold = 16;
+
+    /// Type tag of the value.
+    enum class type_tag: std::uint8_t
+    {
+          invalid = 0
+        , null
+        , false_value
+        , true_value
+        , integer
+        , real
+        , string
+        , array
+        , object
+    };
+
+    struct member;
+    struct document;
+
+    /**
+     * Tagged 16-byte cell. @c n is the string length or the number of
+     * elements (members) of the container. Capacity of a heap allocated
+     * vector is `1 << capacity_log2`, capacity of a pool allocated vector
+     * is equal to its size.
+     */
+    struct value
+    {
+        union payload
+        {
+            std::int64_t i;
+            double d;
+            char const * s;
+            value * items;
+            member * members;
+        } u;
+
+        std::uint32_t n;
+        type_tag type;
+        std::uint8_t flags;
+        std::uint8_t capacity_log2;
+        std::uint8_t reserved;
+    };
+
+    struct member
+    {
+        value key;
+        value val;
+    };
+
+    class basic_rep
+    {
+    public:
+        value * _ptr {nullptr};
+    };
+
+    /**
+     * Value representation: root of the document. Copies share the document
+     * until the first modification through any of them (copy-on-write).
+     */
+    class JEYSON__EXPORT rep : public basic_rep
+    {
+    public:
+        document * _doc {nullptr};
+
+    public:
+        rep ();
+        rep (rep const & other);
+        rep (rep && other);
+        ~rep ();
+    };
+
+    /**
+     * Reference representation: cell of the document tree (or its root).
+     */
+    class JEYSON__EXPORT ref: public basic_rep
+    {
+    public:
+        document * _doc {nullptr};
+
+    public:
+        ref ();
+        ~ref ();
+
+        ref (value * ptr, document * doc);
+        ref (ref const &);
+        ref (ref &&);
+    };
+
+    /**
+     * Non-owning representation: borrowed pointer to the cell. Trivially
+     * copyable.
+     */
+    class view: public basic_rep
+    {};
+
+    static type_tag type_of (basic_rep const & r) noexcept
+    {
+        return r._ptr ? r._ptr->type : type_tag::invalid;
+    }
+
+    /// Integer value, @a r must be an integer.
+    static std::intmax_t integer_of (basic_rep const & r) noexcept
+    {
+        return static_cast<std::intmax_t>(r._ptr->u.i);
+    }
+
+    /// Real value, @a r must be a real.
+    static double real_of (basic_rep const & r) noexcept
+    {
+        return r._ptr->u.d;
+    }
+
+    /// String data, @a r must be a string.
+    static char const * string_data_of (basic_rep const & r) noexcept
+    {
+        return r._ptr->u.s;
+    }
+
+    /// String length, @a r must be a string.
+    static std::size_t string_length_of (basic_rep const & r) noexcept
+    {
+        return r._ptr->n;
+    }
+
+    class iterator_rep
+    {
+    public:
+        value * _parent {nullptr};    // For scalar, array and object iterators
+        document * _doc {nullptr};    // Owner of the references (not for views)
+        size_type _index {0};         // Element or member position
+    };
+};
+
+}} // namespace jeyson::backend
@@ -0,0 +1,148 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `jeyson-lib`.
+//
+// Changelog:
+//      2026.10.15 Initial version.
+//      2026.10.16 Modification outside of the document scope is rejected.
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "error.hpp"
+#include "exports.hpp"
+#include "json.hpp"
+#include <pfs/filesystem.hpp>
+#include <pfs/string_view.hpp>
+#include <cstddef>
+#include <string>
+
+namespace jeyson {
+
+class arena;
+
+/**
+ * JSON document with nodes allocated from the arena (bump allocator).
+ *
+ * All nodes and strings of the document are allocated from the document's
+ * arena and released in one shot when the document is destroyed, without
+ * walking the tree.
+ *
+ * Rules:
+ *  - modifications of the document nodes must be performed while the document
+ *    scope (see @c json_document::scope) is alive: modification outside of it
+ *    (or in the scope of another document) throws @c error with
+ *    @c std::errc::operation_not_permitted code; values moved into the
+ *    document are copied into the arena if created outside of the scope;
+ *  - references to the document nodes (@c json_ref, iterators) must not
+ *    outlive the document; copies (@c json) made outside the scope are
+ *    independent heap values.
+ *
+ * Cost for the rest of the process: the allocation hooks of the backend are
+ * installed process-wide when the first document is created and are never
+ * removed, so each JSON value released afterwards (not only the document ones)
+ * passes through the hook; while any document is alive the hook looks up the
+ * released pointer in the process-wide registry of the arena chunks (lock-free
+ * binary search over the chunks of all alive arenas).
+ */
+template <typename Backend>
+class json_document
+{
+public:
+    using value_type = json<Backend>;
+
+    /// Memory usage counters.
+    struct memory_stats
+    {
+        std::size_t reserved {0};    // Bytes allocated from the system
+        std::size_t used {0};        // Bytes allocated by the document nodes
+        std::size_t chunks {0};      // Number of arena chunks
+        std::size_t allocations {0}; // Number of allocations
+    };
+
+    /**
+     * Makes the document arena current for the thread: all JSON values
+     * created by the thread while the scope is alive are allocated from the
+     * document arena.
+     */
+    class scope
+    {
+        arena * _prev {nullptr};
+
+    public:
+        JEYSON__EXPORT explicit scope (json_document & doc);
+        JEYSON__EXPORT ~scope ();
+
+        scope (scope const &) = delete;
+        scope & operator = (scope const &) = delete;
+    };
+
+private:
+    arena * _arena {nullptr};
+    value_type _root;
+
+public:
+    /**
+     * Constructs empty document. @a initial_size is the size of the first
+     * arena chunk.
+     */
+    JEYSON__EXPORT explicit json_document (std::size_t initial_size = 64 * 1024);
+
+    JEYSON__EXPORT json_document (json_document && other) noexcept;
+    JEYSON__EXPORT json_document & operator = (json_document && other) noexcept;
+
+    json_document (json_document const &) = delete;
+    json_document & operator = (json_document const &) = delete;
+
+    /**
+     * Destroys the document releasing the arena in one shot.
+     */
+    JEYSON__EXPORT ~json_document ();
+
+    /// Root value of the document.
+    value_type & root () noexcept
+    {
+        return _root;
+    }
+
+    /// Root value of the document.
+    value_type const & root () const noexcept
+    {
+        return _root;
+    }
+
+    /// Memory usage counters of the document arena.
+    JEYSON__EXPORT memory_stats stats () const noexcept;
+
+    //--------------------------------------------------------------------------
+    // Parsing
+    //--------------------------------------------------------------------------
+    /**
+     * Decodes JSON document from string buffer.
+     */
+    static JEYSON__EXPORT json_document parse (char const * source, std::size_t len
+        , error * perr = nullptr);
+
+    /**
+     * Decodes JSON document from string view.
+     */
+    static json_document parse (string_view source, error * perr = nullptr)
+    {
+        return parse(source.data(), source.size(), perr);
+    }
+
+    /**
+     * Decodes JSON document from string.
+     */
+    static json_document parse (std::string const & source, error * perr = nullptr)
+    {
+        return parse(source.data(), source.size(), perr);
+    }
+
+    /**
+     * Decodes JSON document from file.
+     */
+    static JEYSON__EXPORT json_document parse (pfs::filesystem::path const & path
+        , error * perr = nullptr);
+};
+
+} // namespace jeyson
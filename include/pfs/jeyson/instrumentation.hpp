@@ -0,0 +1,142 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `jeyson-lib`.
+//
+// Changelog:
+//      2026.10.15 Initial version.
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "exports.hpp"
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Instrumentation of parsing and serialization (`json::parse()`,
+ * `json_document::parse()`, `to_string()` and `json::save()`).
+ *
+ * Instrumentation is available if the library is built with
+ * `JEYSON__ENABLE_INSTRUMENTATION` option (`JEYSON__INSTRUMENTATION_ENABLED`
+ * is defined), otherwise the functions below are no-ops and the library
+ * contains no instrumentation code.
+ *
+ * Statistics are collected for the calls made by the thread that enabled the
+ * instrumentation. Each call produces a record that is passed to the sink (if
+ * any) and accumulated in the thread totals.
+ *
+ * Example:
+ * @code
+ * jeyson::instrumentation::enable();
+ * auto j = json::parse(source);
+ * auto totals = jeyson::instrumentation::thread_totals();
+ * jeyson::instrumentation::disable();
+ * @endcode
+ */
+
+namespace jeyson {
+namespace instrumentation {
+
+/// Instrumented operation.
+enum class operation: int
+{
+      parse     // JSON text decoding
+    , to_string // Serialization into string
+    , save      // Serialization into file
+};
+
+/// Operation phase.
+enum class phase: int
+{
+      read = 0  // Reading file content
+    , index     // Structural indexing (native parser engine)
+    , build     // Tree construction
+    , dump      // Serialization
+};
+
+constexpr int phase_count = 4;
+
+/// Statistics of a call (or accumulated statistics of calls).
+struct stats
+{
+    operation op {operation::parse};
+
+    std::size_t calls {0};           // Number of calls
+    std::size_t failures {0};        // Number of failed calls
+    std::size_t bytes_in {0};        // JSON text bytes consumed (parse)
+    std::size_t bytes_out {0};       // JSON text bytes produced (to_string, save)
+
+    // Nodes of the parsed or serialized tree by type
+    std::size_t nulls {0};
+    std::size_t booleans {0};
+    std::size_t integers {0};
+    std::size_t reals {0};
+    std::size_t strings {0};
+    std::size_t arrays {0};
+    std::size_t objects {0};
+
+    std::size_t max_depth {0};       // Maximum nesting level (scalar root is 0)
+
+    // Backend allocations (made through the backend allocation functions)
+    std::size_t allocations {0};
+    std::size_t allocated_bytes {0};
+
+    std::uint64_t total_ns {0};                // Wall time of the call
+    std::uint64_t phase_ns[phase_count] {};    // Wall time of the phases
+
+    std::size_t nodes () const noexcept
+    {
+        return nulls + booleans + integers + reals + strings + arrays + objects;
+    }
+
+    std::uint64_t elapsed (phase p) const noexcept
+    {
+        return phase_ns[static_cast<int>(p)];
+    }
+};
+
+/**
+ * Sink for the call records, invoked in the thread of the call after the
+ * call is completed. Sink must not throw.
+ */
+using sink_type = void (*) (stats const & record, void * user_data);
+
+#if JEYSON__INSTRUMENTATION_ENABLED
+
+/**
+ * Enables instrumentation for the current thread. Records are passed to
+ * @a sink (if not @c nullptr) with @a user_data.
+ */
+JEYSON__EXPORT void enable (sink_type sink = nullptr, void * user_data = nullptr);
+
+/**
+ * Disables instrumentation for the current thread. Thread totals are kept.
+ */
+JEYSON__EXPORT void disable () noexcept;
+
+/**
+ * Checks if instrumentation is enabled for the current thread.
+ */
+JEYSON__EXPORT bool enabled () noexcept;
+
+/**
+ * Accumulated statistics of the calls made by the current thread (`op` is
+ * the operation of the last call, `max_depth` is the maximum over calls).
+ */
+JEYSON__EXPORT stats thread_totals () noexcept;
+
+/**
+ * Resets accumulated statistics of the current thread.
+ */
+JEYSON__EXPORT void reset_thread_totals () noexcept;
+
+#else
+
+inline void enable (sink_type = nullptr, void * = nullptr) {}
+inline void disable () noexcept {}
+inline bool enabled () noexcept { return false; }
+inline stats thread_totals () noexcept { return stats{}; }
+inline void reset_thread_totals () noexcept {}
+
+#endif
+
+}} // namespace jeyson::instrumentation
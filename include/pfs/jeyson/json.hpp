@@ -7,11 +7,21 @@
 //      2022.02.07 Initial version.
 //      2022.07.08 Fixed for MSVC.
 //      2025.04.13 Fixed error usage.
+//      2026.10.15 Real numbers are saved in shortest round-trip form by default.
+//                 Added json_view.
+//                 Copies of JSON values are copy-on-write, added deep_copy().
+//                 Added parsing of selected paths only.
+//                 Scalar getters and decoders are inlined.
+//                 Added native backend.
+//      2026.10.16 Mutable accessors make the value unshareable.
+//                 Added mutable at(), constant at() returns constant reference.
+//                 Added insert() of rvalues for all key types.
 ////////////////////////////////////////////////////////////////////////////////
 #pragma once
 #include "error.hpp"
 #include "exports.hpp"
 #include "backend/jansson.hpp"
+#include "backend/native.hpp"
 #include <pfs/filesystem.hpp>
 #include <pfs/iterator.hpp>
 #include <pfs/optional.hpp>
@@ -19,9 +29,12 @@
 #include <pfs/type_traits.hpp>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <functional>
+#include <limits>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 namespace jeyson {
 
@@ -31,6 +44,9 @@ class json;
 template <typename Backend>
 class json_ref;
 
+template <typename Backend>
+class json_view;
+
 using pfs::string_view;
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -53,6 +69,137 @@ struct decoder
     }
 };
 
+// Decoders of the scalar types are inline except parsing of strings
+
+template <>
+struct decoder<bool>
+{
+    bool operator () () const noexcept
+    {
+        return false;
+    }
+
+    bool operator () (std::nullptr_t, bool *) const noexcept
+    {
+        return false;
+    }
+
+    bool operator () (bool v, bool *) const noexcept
+    {
+        return v;
+    }
+
+    bool operator () (std::intmax_t v, bool *) const noexcept
+    {
+        return static_cast<bool>(v);
+    }
+
+    bool operator () (double v, bool *) const noexcept
+    {
+        return static_cast<bool>(v);
+    }
+
+    JEYSON__EXPORT bool operator () (string_view const & v, bool * success) const noexcept;
+
+    bool operator () (std::size_t size, bool, bool *) const noexcept
+    {
+        return size > 0;
+    }
+
+    bool operator () (char const * s,  bool * success) const noexcept
+    {
+        return this->operator() (string_view(s, std::strlen(s)), success);
+    }
+};
+
+template <>
+struct decoder<std::intmax_t>
+{
+    std::intmax_t operator () () const noexcept
+    {
+        return 0;
+    }
+
+    std::intmax_t operator () (std::nullptr_t, bool *) const noexcept
+    {
+        return 0;
+    }
+
+    std::intmax_t operator () (bool v, bool *) const noexcept
+    {
+        return v ? 1 : 0;
+    }
+
+    std::intmax_t operator () (std::intmax_t v, bool *) const noexcept
+    {
+        return v;
+    }
+
+    std::intmax_t operator () (double v, bool * success) const noexcept
+    {
+        if (v >= static_cast<double>((std::numeric_limits<std::intmax_t>::min)())
+                && v <= static_cast<double>((std::numeric_limits<std::intmax_t>::max)())) {
+            return static_cast<std::intmax_t>(v);
+        }
+
+        *success = false;
+        return this->operator()();
+    }
+
+    JEYSON__EXPORT std::intmax_t operator () (string_view const & v, bool * success) const noexcept;
+
+    std::intmax_t operator () (std::size_t size, bool, bool *) const noexcept
+    {
+        return static_cast<std::intmax_t>(size);
+    }
+
+    std::intmax_t operator () (char const * s,  bool * success) const noexcept
+    {
+        return this->operator() (string_view(s, std::strlen(s)), success);
+    }
+};
+
+template <>
+struct decoder<double>
+{
+    double operator () () const noexcept
+    {
+        return 0.0;
+    }
+
+    double operator () (std::nullptr_t, bool *) const noexcept
+    {
+        return 0.0;
+    }
+
+    double operator () (bool v, bool *) const noexcept
+    {
+        return v ? 1.0 : 0.0;
+    }
+
+    double operator () (std::intmax_t v, bool *) const noexcept
+    {
+        return static_cast<double>(v);
+    }
+
+    double operator () (double v, bool *) const noexcept
+    {
+        return v;
+    }
+
+    JEYSON__EXPORT double operator () (string_view const & v, bool * success) const noexcept;
+
+    double operator () (std::size_t size, bool, bool *) const noexcept
+    {
+        return static_cast<double>(size);
+    }
+
+    double operator () (char const * s,  bool * success) const noexcept
+    {
+        return this->operator() (string_view(s, std::strlen(s)), success);
+    }
+};
+
 template <typename T>
 struct decoder<T, typename
         std::enable_if<
@@ -455,6 +602,18 @@ public:
      */
     JEYSON__EXPORT void insert (key_type const & key, value_type && value);
 
+    // Without these overloads `insert("key", json{})` is ambiguous between
+    // the templates above and `insert (key_type const &, value_type &&)`
+    void insert (string_view const & key, value_type && value)
+    {
+        this->insert(key_type(key.data(), key.size()), std::move(value));
+    }
+
+    void insert (char const * key, value_type && value)
+    {
+        this->insert(key_type{key}, std::move(value));
+    }
+
     /**
      * Appends the given element @a value to the end of the array.
      * The new element is initialized as a deep copy of @a value.
@@ -525,6 +684,10 @@ public:
     //--------------------------------------------------------------------------
     // Stringification
     //--------------------------------------------------------------------------
+    /**
+     * Returns compact JSON representation. Real numbers are written in the
+     * shortest form that reads back to the same value.
+     */
     JEYSON__EXPORT std::string to_string () const;
 };
 
@@ -544,7 +707,7 @@ public:
      * Returns a reference to the element at specified location @a pos.
      * In case of out of bounds, the result is a reference to an invalid value.
      */
-    JEYSON__EXPORT reference operator [] (size_type pos) noexcept;
+    JEYSON__EXPORT reference operator [] (size_type pos);
 
     /**
      * Returns a reference to the element at specified location @a pos.
@@ -559,7 +722,7 @@ public:
 //         return this->operator[] (static_cast<size_type>(pos));
 //     }
 
-    reference operator [] (int pos) noexcept
+    reference operator [] (int pos)
     {
         return this->operator[] (static_cast<size_type>(pos));
     }
@@ -568,14 +731,14 @@ public:
      * Returns a reference to the value that is mapped to a key equivalent
      * to @a key, performing an insertion if such key does not already exist.
      */
-    JEYSON__EXPORT reference operator [] (string_view) noexcept;
+    JEYSON__EXPORT reference operator [] (string_view);
 
-    reference operator [] (key_type const & key) noexcept
+    reference operator [] (key_type const & key)
     {
         return this->operator[] (string_view{key});
     }
 
-    reference operator [] (char const * key) noexcept
+    reference operator [] (char const * key)
     {
         return this->operator[] (string_view{key});
     }
@@ -636,12 +799,22 @@ public:
 
     /**
      * Returns a reference to the element at specified location @a pos.
+     * Like the mutable `operator[]`, makes the value unshareable.
+     *
+     * @throw @c error { @c errc::incopatible_type } if @c this is uninitialized
+     *        or it is not an array.
+     * @throw @c error { @c errc::out_of_range } if @a pos is out of bounds.
+     */
+    JEYSON__EXPORT reference at (size_type pos);
+
+    /**
+     * Returns a constant reference to the element at specified location @a pos.
      *
      * @throw @c error { @c errc::incopatible_type } if @c this is uninitialized
      *        or it is not an array.
      * @throw @c error { @c errc::out_of_range } if @a pos is out of bounds.
      */
-    JEYSON__EXPORT reference at (size_type pos) const;
+    JEYSON__EXPORT const_reference at (size_type pos) const;
 
     /**
      * Returns a reference to the element at specified location @a pos.
@@ -651,6 +824,14 @@ public:
     template <typename IndexT = int>
     typename std::enable_if<std::is_integral<IndexT>::value
         && !std::is_same<size_type, IndexT>::value, reference>::type
+    at (IndexT pos)
+    {
+        return this->at(static_cast<size_type>(pos));
+    }
+
+    template <typename IndexT = int>
+    typename std::enable_if<std::is_integral<IndexT>::value
+        && !std::is_same<size_type, IndexT>::value, const_reference>::type
     at (IndexT pos) const
     {
         return this->at(static_cast<size_type>(pos));
@@ -658,20 +839,40 @@ public:
 
     /**
      * Returns a reference to the value that is mapped to a key equivalent
-     * to @a key.
+     * to @a key. Like the mutable `operator[]`, makes the value unshareable.
      *
      * @throw @c error { @c errc::incopatible_type } if @c this is uninitialized
      *        or it is not an object.
      * @throw @c error { @c errc::out_of_range } if an element by @a key not found.
      */
-    JEYSON__EXPORT reference at (string_view key) const;
+    JEYSON__EXPORT reference at (string_view key);
 
-    reference at (key_type const & key) const
+    /**
+     * Returns a constant reference to the value that is mapped to a key
+     * equivalent to @a key.
+     *
+     * @throw @c error { @c errc::incopatible_type } if @c this is uninitialized
+     *        or it is not an object.
+     * @throw @c error { @c errc::out_of_range } if an element by @a key not found.
+     */
+    JEYSON__EXPORT const_reference at (string_view key) const;
+
+    reference at (key_type const & key)
+    {
+        return at(string_view{key});
+    }
+
+    const_reference at (key_type const & key) const
     {
         return at(string_view{key});
     }
 
-    reference at (char const * key) const
+    reference at (char const * key)
+    {
+        return at(string_view{key});
+    }
+
+    const_reference at (char const * key) const
     {
         return at(string_view{key});
     }
@@ -715,15 +916,55 @@ private:
     JEYSON__EXPORT std::size_t array_size () const noexcept;
     JEYSON__EXPORT std::size_t object_size () const noexcept;
 
-public:
-    /**
-     * Returns the value stored in JSON value/reference.
-     *
-     * @param success Reference to store the result of convertion JSON
-     *        value/reference to specified type.
-     */
+    bool is_null_helper (std::true_type) const noexcept
+    {
+        return Backend::type_of(*static_cast<Derived const *>(this)) == Backend::type_tag::null;
+    }
+
+    bool is_null_helper (std::false_type) const noexcept
+    {
+        return static_cast<Derived const *>(this)->is_null();
+    }
+
+    // Values represented by the backend native pointer: single switch on the
+    // inline type tag, scalars are read inline
     template <typename T>
-    T get (bool & success) const noexcept
+    T get_helper (bool & success, std::true_type) const noexcept
+    {
+        using type_tag = typename Backend::type_tag;
+
+        decoder<T> decode;
+        auto const & r = static_cast<typename Backend::basic_rep const &>(*static_cast<Derived const *>(this));
+        success = true;
+
+        switch (Backend::type_of(*static_cast<Derived const *>(this))) {
+            case type_tag::true_value:
+                return decode(true, & success);
+            case type_tag::false_value:
+                return decode(false, & success);
+            case type_tag::integer:
+                return decode(Backend::integer_of(r), & success);
+            case type_tag::real:
+                return decode(Backend::real_of(r), & success);
+            case type_tag::string:
+                return decode(string_view{Backend::string_data_of(r), Backend::string_length_of(r)}
+                    , & success);
+            case type_tag::array:
+                return decode(array_size(), true, & success);
+            case type_tag::object:
+                return decode(object_size(), true, & success);
+            case type_tag::null:
+                return decode(nullptr, & success);
+            default:
+                break;
+        }
+
+        success = false;
+        return decode();
+    }
+
+    template <typename T>
+    T get_helper (bool & success, std::false_type) const noexcept
     {
         decoder<T> decode;
         auto self = static_cast<Derived const *>(this);
@@ -750,6 +991,19 @@ public:
         return decode();
     }
 
+public:
+    /**
+     * Returns the value stored in JSON value/reference.
+     *
+     * @param success Reference to store the result of convertion JSON
+     *        value/reference to specified type.
+     */
+    template <typename T>
+    T get (bool & success) const noexcept
+    {
+        return get_helper<T>(success, std::is_base_of<typename Backend::basic_rep, Derived>{});
+    }
+
     /**
      * Returns the value stored in JSON value/reference.
      *
@@ -777,9 +1031,7 @@ public:
     template <typename T>
     T get_or (T const & alt) const noexcept
     {
-        auto self = static_cast<Derived const *>(this);
-
-        if (self->is_null())
+        if (is_null_helper(std::is_base_of<typename Backend::basic_rep, Derived>{}))
             return alt;
 
         bool success = true;
@@ -884,7 +1136,7 @@ public:
     using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 
 public:
-    JEYSON__EXPORT iterator begin () noexcept;
+    JEYSON__EXPORT iterator begin ();
     JEYSON__EXPORT const_iterator begin () const noexcept;
 
     const_iterator cbegin () const noexcept
@@ -892,7 +1144,7 @@ public:
         return begin();
     }
 
-    JEYSON__EXPORT iterator end () noexcept;
+    JEYSON__EXPORT iterator end ();
     JEYSON__EXPORT const_iterator end () const noexcept;
 
     const_iterator cend () const noexcept
@@ -900,7 +1152,7 @@ public:
         return end();
     }
 
-    reverse_iterator rbegin () noexcept
+    reverse_iterator rbegin ()
     {
         return reverse_iterator{end()};
     }
@@ -915,7 +1167,7 @@ public:
         return rbegin();
     }
 
-    reverse_iterator rend () noexcept
+    reverse_iterator rend ()
     {
         return reverse_iterator{begin()};
     }
@@ -1017,6 +1269,167 @@ public:
     JEYSON__EXPORT void swap (json_ref & other);
 };
 
+////////////////////////////////////////////////////////////////////////////////
+// JSON view
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * Non-owning read-only view of a JSON value.
+ *
+ * Unlike @c json_ref the view does not own a reference to the value, so it is
+ * trivially copyable and read-only traversal of a value shared between threads
+ * does not modify reference counters. The view, and all views and iterators
+ * obtained from it, are valid while the owning @c json exists and the viewed
+ * element is not replaced or removed.
+ */
+template <typename Backend = backend::jansson>
+class json_view: public Backend::view
+    , public traits_interface<json_view<Backend>>
+    , public capacity_interface<json_view<Backend>, Backend>
+    , public converter_interface<json_view<Backend>>
+    , public getter_interface<json_view<Backend>, Backend>
+{
+public:
+    using value_type = json<Backend>;
+    using rep_type   = typename Backend::view;
+    using size_type  = typename Backend::size_type;
+    using key_type   = typename Backend::key_type;
+    using iterator   = basic_iterator<json_view<Backend> const, json_view<Backend>, Backend>;
+    using const_iterator = iterator;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = reverse_iterator;
+
+public:
+    /// Constructs invalid view.
+    json_view () = default;
+
+    JEYSON__EXPORT json_view (json<Backend> const & j) noexcept;
+    JEYSON__EXPORT json_view (json_ref<Backend> const & j) noexcept;
+
+    /// Check if JSON view is valid.
+    JEYSON__EXPORT operator bool () const noexcept;
+
+    //--------------------------------------------------------------------------
+    // Element access
+    //--------------------------------------------------------------------------
+    /**
+     * Returns a view of the element at specified location @a pos.
+     * In case of out of bounds, the result is an invalid view.
+     */
+    JEYSON__EXPORT json_view operator [] (size_type pos) const noexcept;
+
+    json_view operator [] (int pos) const noexcept
+    {
+        return this->operator[] (static_cast<size_type>(pos));
+    }
+
+    /**
+     * Returns a view of the value that is mapped to a key equivalent
+     * to @a key. In case of out of range, the result is an invalid view.
+     */
+    JEYSON__EXPORT json_view operator [] (string_view key) const noexcept;
+
+    json_view operator [] (key_type const & key) const noexcept
+    {
+        return this->operator[] (string_view{key});
+    }
+
+    json_view operator [] (char const * key) const noexcept
+    {
+        return this->operator[] (string_view{key});
+    }
+
+    /**
+     * Returns a view of the element at specified location @a pos.
+     *
+     * @throw @c error { @c errc::incopatible_type } if @c this is invalid
+     *        or it is not an array.
+     * @throw @c error { @c errc::out_of_range } if @a pos is out of bounds.
+     */
+    JEYSON__EXPORT json_view at (size_type pos) const;
+
+    template <typename IndexT = int>
+    typename std::enable_if<std::is_integral<IndexT>::value
+        && !std::is_same<size_type, IndexT>::value, json_view>::type
+    at (IndexT pos) const
+    {
+        return this->at(static_cast<size_type>(pos));
+    }
+
+    /**
+     * Returns a view of the value that is mapped to a key equivalent
+     * to @a key.
+     *
+     * @throw @c error { @c errc::incopatible_type } if @c this is invalid
+     *        or it is not an object.
+     * @throw @c error { @c errc::out_of_range } if an element by @a key not found.
+     */
+    JEYSON__EXPORT json_view at (string_view key) const;
+
+    json_view at (key_type const & key) const
+    {
+        return at(string_view{key});
+    }
+
+    json_view at (char const * key) const
+    {
+        return at(string_view{key});
+    }
+
+    /**
+     * Checks if JSON value contains element by @a key.
+     *
+     * @note This method is applicable only for objects, in other cases it
+     *       returns @c false.
+     */
+    JEYSON__EXPORT bool contains (string_view key) const;
+
+    bool contains (key_type const & key) const
+    {
+        return contains(string_view{key});
+    }
+
+    bool contains (char const * key) const
+    {
+        return contains(string_view{key});
+    }
+
+    //--------------------------------------------------------------------------
+    // Iterators
+    //--------------------------------------------------------------------------
+    JEYSON__EXPORT iterator begin () const noexcept;
+    JEYSON__EXPORT iterator end () const noexcept;
+
+    iterator cbegin () const noexcept
+    {
+        return begin();
+    }
+
+    iterator cend () const noexcept
+    {
+        return end();
+    }
+
+    reverse_iterator rbegin () const noexcept
+    {
+        return reverse_iterator{end()};
+    }
+
+    reverse_iterator rend () const noexcept
+    {
+        return reverse_iterator{begin()};
+    }
+
+    reverse_iterator crbegin () const noexcept
+    {
+        return rbegin();
+    }
+
+    reverse_iterator crend () const noexcept
+    {
+        return rend();
+    }
+};
+
 ////////////////////////////////////////////////////////////////////////////////
 // JSON value
 ////////////////////////////////////////////////////////////////////////////////
@@ -1118,6 +1531,14 @@ public:
         : json(string_view{value, n})
     {}
 
+    /**
+     * Copies share the tree until the first modification through any of them
+     * (copy-on-write). A value that has given out references or iterators
+     * through mutable accessors (`operator[]`, `at()`, `begin()`, `end()`) is
+     * not shared anymore: its copies are deep until the value is reassigned.
+     * References obtained from constant accessors (`at() const`,
+     * `operator[] const`) of a shared value must not be used for modification.
+     */
     JEYSON__EXPORT json (json const & other);
     JEYSON__EXPORT json (json && other);
     JEYSON__EXPORT explicit json (reference const & other);
@@ -1153,6 +1574,11 @@ public:
      */
     JEYSON__EXPORT void swap (json & other);
 
+    /**
+     * Returns a copy that does not share the tree with this value.
+     */
+    JEYSON__EXPORT json deep_copy () const;
+
     //--------------------------------------------------------------------------
     // Save
     //--------------------------------------------------------------------------
@@ -1164,14 +1590,16 @@ public:
      * @param compact Save in compact representation.
      * @param indent Number of spaces for indentation (ignored if @a compact
      *        is @c true).
-     * @param precision The precision for real numbers output.
+     * @param precision The precision for real numbers output (`%.<precision>g`).
+     *        If zero or negative, real numbers are written in the shortest form
+     *        that reads back to the same value.
      *
      * @throw @c error { @c errc::backend_error } if backend call(s) results a failure.
      */
     JEYSON__EXPORT void save (pfs::filesystem::path const & path
         , bool compact = false
         , int indent = 4
-        , int precision = 17);
+        , int precision = 0);
 
     //--------------------------------------------------------------------------
     // Comparison operators
@@ -1201,6 +1629,40 @@ public:
      * Decodes JSON from file.
      */
     static JEYSON__EXPORT json parse (pfs::filesystem::path const & path, error * perr = nullptr);
+
+    /**
+     * Decodes from string buffer only the values selected by @a paths (JSON
+     * Pointers, RFC 6901, the `*` token matches any member or element, the
+     * empty pointer selects the whole document). Other values are skipped
+     * without building nodes and decoding strings, they are checked for
+     * bracket balance only.
+     *
+     * The result keeps the structure of the document: containers on the
+     * selected paths contain only the members/elements with selected values
+     * (so array elements are renumbered), the root value is always present.
+     *
+     * Invalid pointer is reported as @c std::errc::invalid_argument.
+     */
+    static JEYSON__EXPORT json parse (char const * source, std::size_t len
+        , std::vector<std::string> const & paths, error * perr = nullptr);
+
+    static json parse (string_view source, std::vector<std::string> const & paths
+        , error * perr = nullptr)
+    {
+        return parse(source.data(), source.size(), paths, perr);
+    }
+
+    static json parse (std::string const & source, std::vector<std::string> const & paths
+        , error * perr = nullptr)
+    {
+        return parse(source.data(), source.size(), paths, perr);
+    }
+
+    /**
+     * Decodes from file only the values selected by @a paths (see above).
+     */
+    static JEYSON__EXPORT json parse (pfs::filesystem::path const & path
+        , std::vector<std::string> const & paths, error * perr = nullptr);
 };
 
 template <typename Backend>
@@ -1210,6 +1672,10 @@ template <>
 JEYSON__EXPORT bool operator == <backend::jansson> (json<backend::jansson> const & lhs
     , json<backend::jansson> const & rhs);
 
+template <>
+JEYSON__EXPORT bool operator == <backend::native> (json<backend::native> const & lhs
+    , json<backend::native> const & rhs);
+
 template <typename Backend>
 inline bool operator != (json<Backend> const & lhs, json<Backend> const & rhs)
 {
@@ -1228,6 +1694,12 @@ inline bool is_null (json_ref<Backend> const & j) noexcept
     return j.is_null();
 }
 
+template <typename Backend>
+inline bool is_null (json_view<Backend> const & j) noexcept
+{
+    return j.is_null();
+}
+
 template <typename Backend>
 inline bool is_bool (json<Backend> const & j) noexcept
 {
@@ -1240,6 +1712,12 @@ inline bool is_bool (json_ref<Backend> const & j) noexcept
     return j.is_bool();
 }
 
+template <typename Backend>
+inline bool is_bool (json_view<Backend> const & j) noexcept
+{
+    return j.is_bool();
+}
+
 template <typename Backend>
 inline bool is_integer (json<Backend> const & j) noexcept
 {
@@ -1252,6 +1730,12 @@ inline bool is_integer (json_ref<Backend> const & j) noexcept
     return j.is_integer();
 }
 
+template <typename Backend>
+inline bool is_integer (json_view<Backend> const & j) noexcept
+{
+    return j.is_integer();
+}
+
 template <typename Backend>
 inline bool is_real (json<Backend> const & j) noexcept
 {
@@ -1264,6 +1748,12 @@ inline bool is_real (json_ref<Backend> const & j) noexcept
     return j.is_real();
 }
 
+template <typename Backend>
+inline bool is_real (json_view<Backend> const & j) noexcept
+{
+    return j.is_real();
+}
+
 template <typename Backend>
 inline bool is_string (json<Backend> const & j) noexcept
 {
@@ -1276,6 +1766,12 @@ inline bool is_string (json_ref<Backend> const & j) noexcept
     return j.is_string();
 }
 
+template <typename Backend>
+inline bool is_string (json_view<Backend> const & j) noexcept
+{
+    return j.is_string();
+}
+
 template <typename Backend>
 inline bool is_array (json<Backend> const & j) noexcept
 {
@@ -1288,6 +1784,12 @@ inline bool is_array (json_ref<Backend> const & j) noexcept
     return j.is_array();
 }
 
+template <typename Backend>
+inline bool is_array (json_view<Backend> const & j) noexcept
+{
+    return j.is_array();
+}
+
 template <typename Backend>
 inline bool is_object (json<Backend> const & j) noexcept
 {
@@ -1300,6 +1802,12 @@ inline bool is_object (json_ref<Backend> const & j) noexcept
     return j.is_object();
 }
 
+template <typename Backend>
+inline bool is_object (json_view<Backend> const & j) noexcept
+{
+    return j.is_object();
+}
+
 template <typename Backend>
 inline bool is_scalar (json<Backend> const & j) noexcept
 {
@@ -1312,6 +1820,12 @@ inline bool is_scalar (json_ref<Backend> const & j) noexcept
     return j.is_scalar();
 }
 
+template <typename Backend>
+inline bool is_scalar (json_view<Backend> const & j) noexcept
+{
+    return j.is_scalar();
+}
+
 template <typename Backend>
 inline bool is_structured (json<Backend> const & j) noexcept
 {
@@ -1324,6 +1838,12 @@ inline bool is_structured (json_ref<Backend> const & j) noexcept
     return j.is_structured();
 }
 
+template <typename Backend>
+inline bool is_structured (json_view<Backend> const & j) noexcept
+{
+    return j.is_structured();
+}
+
 template <typename T, typename Backend>
 inline T get (json<Backend> const & j, bool & success) noexcept
 {
@@ -1336,6 +1856,12 @@ inline T get (json_ref<Backend> const & j, bool & success) noexcept
     return j.template get<T>(success);
 }
 
+template <typename T, typename Backend>
+inline T get (json_view<Backend> const & j, bool & success) noexcept
+{
+    return j.template get<T>(success);
+}
+
 template <typename T, typename Backend>
 inline T get (json<Backend> const & j)
 {
@@ -1348,6 +1874,12 @@ inline T get (json_ref<Backend> const & j)
     return j.template get<T>();
 }
 
+template <typename T, typename Backend>
+inline T get (json_view<Backend> const & j)
+{
+    return j.template get<T>();
+}
+
 template <typename T, typename Backend>
 inline T get_or (json<Backend> const & j, T const & alt) noexcept
 {
@@ -1360,6 +1892,12 @@ inline T get_or (json_ref<Backend> const & j, T const & alt) noexcept
     return j.template get_or<T>(alt);
 }
 
+template <typename T, typename Backend>
+inline T get_or (json_view<Backend> const & j, T const & alt) noexcept
+{
+    return j.template get_or<T>(alt);
+}
+
 template <typename Backend>
 inline void swap (json<Backend> & a, json<Backend> & b)
 {
@@ -1378,4 +1916,10 @@ inline std::string to_string (json_ref<Backend> const & j)
     return j.to_string();
 }
 
+template <typename Backend>
+inline std::string to_string (json_view<Backend> const & j)
+{
+    return j.to_string();
+}
+
 } // namespace jeyson
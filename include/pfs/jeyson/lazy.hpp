@@ -0,0 +1,400 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `jeyson-lib`.
+//
+// Changelog:
+//      2026.10.15 Initial version.
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "error.hpp"
+#include "exports.hpp"
+#include "json.hpp"
+#include <pfs/filesystem.hpp>
+#include <pfs/iterator.hpp>
+#include <pfs/string_view.hpp>
+#include <cstddef>
+#include <string>
+#include <type_traits>
+
+namespace jeyson {
+
+class lazy_tape;
+
+template <typename Backend>
+class lazy_document;
+
+template <typename Backend>
+class lazy_value;
+
+/**
+ * Forward iterator over elements of an array or members of an object of
+ * the lazy document. Scalar value is iterated as a single element.
+ */
+template <typename Backend>
+class lazy_iterator : public pfs::iterator_facade<pfs::forward_iterator_tag
+    , lazy_iterator<Backend>
+    , lazy_value<Backend> const
+    , lazy_value<Backend> *
+    , lazy_value<Backend>
+    , std::ptrdiff_t>
+{
+    friend class lazy_value<Backend>;
+
+public:
+    using value_type = lazy_value<Backend>;
+    using key_type   = typename Backend::key_type;
+    using reference  = lazy_value<Backend>;
+    using difference_type = std::ptrdiff_t;
+
+private:
+    lazy_tape const * _tape {nullptr};
+    std::size_t _parent {0}; // Tape position of the iterated value
+    std::size_t _pos {0};    // Tape position of the element (of the key for object member)
+
+public:
+    lazy_iterator () = default;
+
+    JEYSON__EXPORT bool equals (lazy_iterator const & other) const;
+
+    /**
+     * @throw @c error { @c errc::out_of_range } if iterator is out of range.
+     */
+    JEYSON__EXPORT reference ref ();
+
+    /**
+     * @throw @c error { @c errc::out_of_range } if iterator is out of range.
+     */
+    JEYSON__EXPORT void increment (difference_type);
+
+    /**
+     * @throw @c error { @c errc::incopatible_type } if iterator is not an object iterator.
+     * @throw @c error { @c errc::out_of_range } if iterator is out of range.
+     */
+    JEYSON__EXPORT key_type key () const;
+
+    reference value ()
+    {
+        return ref();
+    }
+};
+
+/**
+ * Read-only value of the lazy document (see @c lazy_document).
+ *
+ * Trivially copyable handle: the value, and all values and iterators obtained
+ * from it, are valid while the owning document exists.
+ */
+template <typename Backend = backend::jansson>
+class lazy_value
+    : public traits_interface<lazy_value<Backend>>
+    , public capacity_interface<lazy_value<Backend>, Backend>
+    , public converter_interface<lazy_value<Backend>>
+    , public getter_interface<lazy_value<Backend>, Backend>
+{
+    friend class lazy_document<Backend>;
+    friend class lazy_iterator<Backend>;
+    friend class traits_interface<lazy_value<Backend>>;
+    friend class capacity_interface<lazy_value<Backend>, Backend>;
+    friend class converter_interface<lazy_value<Backend>>;
+    friend class getter_interface<lazy_value<Backend>, Backend>;
+
+public:
+    using value_type = json<Backend>;
+    using size_type  = typename Backend::size_type;
+    using key_type   = typename Backend::key_type;
+    using iterator   = lazy_iterator<Backend>;
+    using const_iterator = iterator;
+
+private:
+    lazy_tape const * _tape {nullptr};
+    std::size_t _pos {0}; // Position of the value in the tape
+
+private:
+    lazy_value (lazy_tape const * tape, std::size_t pos) noexcept
+        : _tape(tape)
+        , _pos(pos)
+    {}
+
+public:
+    /// Constructs invalid value.
+    lazy_value () = default;
+
+    /// Check if value is valid.
+    explicit operator bool () const noexcept
+    {
+        return _tape != nullptr;
+    }
+
+    //--------------------------------------------------------------------------
+    // Element access
+    //--------------------------------------------------------------------------
+    /**
+     * Returns the element at specified location @a pos.
+     * In case of out of bounds, the result is an invalid value.
+     */
+    JEYSON__EXPORT lazy_value operator [] (size_type pos) const noexcept;
+
+    lazy_value operator [] (int pos) const noexcept
+    {
+        return this->operator[] (static_cast<size_type>(pos));
+    }
+
+    /**
+     * Returns the value that is mapped to a key equivalent to @a key (the last
+     * one if the object has duplicate keys). In case of out of range, the
+     * result is an invalid value.
+     */
+    JEYSON__EXPORT lazy_value operator [] (string_view key) const noexcept;
+
+    lazy_value operator [] (key_type const & key) const noexcept
+    {
+        return this->operator[] (string_view{key});
+    }
+
+    lazy_value operator [] (char const * key) const noexcept
+    {
+        return this->operator[] (string_view{key});
+    }
+
+    /**
+     * Returns the element at specified location @a pos.
+     *
+     * @throw @c error { @c errc::incopatible_type } if @c this is invalid
+     *        or it is not an array.
+     * @throw @c error { @c errc::out_of_range } if @a pos is out of bounds.
+     */
+    JEYSON__EXPORT lazy_value at (size_type pos) const;
+
+    template <typename IndexT = int>
+    typename std::enable_if<std::is_integral<IndexT>::value
+        && !std::is_same<size_type, IndexT>::value, lazy_value>::type
+    at (IndexT pos) const
+    {
+        return this->at(static_cast<size_type>(pos));
+    }
+
+    /**
+     * Returns the value that is mapped to a key equivalent to @a key.
+     *
+     * @throw @c error { @c errc::incopatible_type } if @c this is invalid
+     *        or it is not an object.
+     * @throw @c error { @c errc::out_of_range } if an element by @a key not found.
+     */
+    JEYSON__EXPORT lazy_value at (string_view key) const;
+
+    lazy_value at (key_type const & key) const
+    {
+        return at(string_view{key});
+    }
+
+    lazy_value at (char const * key) const
+    {
+        return at(string_view{key});
+    }
+
+    /**
+     * Checks if the value contains element by @a key.
+     *
+     * @note This method is applicable only for objects, in other cases it
+     *       returns @c false.
+     */
+    JEYSON__EXPORT bool contains (string_view key) const;
+
+    bool contains (key_type const & key) const
+    {
+        return contains(string_view{key});
+    }
+
+    bool contains (char const * key) const
+    {
+        return contains(string_view{key});
+    }
+
+    //--------------------------------------------------------------------------
+    // Iterators
+    //--------------------------------------------------------------------------
+    JEYSON__EXPORT iterator begin () const noexcept;
+    JEYSON__EXPORT iterator end () const noexcept;
+
+    iterator cbegin () const noexcept
+    {
+        return begin();
+    }
+
+    iterator cend () const noexcept
+    {
+        return end();
+    }
+
+    //--------------------------------------------------------------------------
+    // Materialization
+    //--------------------------------------------------------------------------
+    /**
+     * Builds the value as @c json (invalid value for invalid @c this).
+     */
+    JEYSON__EXPORT value_type to_json () const;
+};
+
+/**
+ * Lazy (on-demand) JSON document.
+ *
+ * Parsing validates the input in a single pass and records the values into
+ * a compact tape instead of building the tree: strings without escapes
+ * refer to the source text, containers store the number of elements and the
+ * position past their end, so unneeded subtrees are skipped in constant time.
+ * Element lookup in objects is linear. The grammar and the error messages are
+ * the same as for `json::parse()` with the native parser engine. Duplicate
+ * keys are kept: lookup returns the last one (as `json::parse()` does),
+ * iteration and `size()` include all of them.
+ *
+ * The document owns the source text (the file is memory mapped). Use
+ * `to_json()` to get a mutable @c json.
+ *
+ * Example:
+ * @code
+ * auto doc = lazy_document<>::parse(payload);
+ * auto id = get<std::intmax_t>(doc.root()["user"]["id"]);
+ * @endcode
+ */
+template <typename Backend = backend::jansson>
+class lazy_document
+{
+public:
+    using value_type = lazy_value<Backend>;
+    using json_type  = json<Backend>;
+
+private:
+    lazy_tape * _tape {nullptr};
+
+public:
+    /// Constructs empty document (root is invalid).
+    lazy_document () = default;
+
+    JEYSON__EXPORT lazy_document (lazy_document && other) noexcept;
+    JEYSON__EXPORT lazy_document & operator = (lazy_document && other) noexcept;
+
+    lazy_document (lazy_document const &) = delete;
+    lazy_document & operator = (lazy_document const &) = delete;
+
+    JEYSON__EXPORT ~lazy_document ();
+
+    /// Returns the root value.
+    JEYSON__EXPORT value_type root () const noexcept;
+
+    /// Builds the whole document as @c json.
+    json_type to_json () const
+    {
+        return root().to_json();
+    }
+
+    /// Number of tape entries.
+    JEYSON__EXPORT std::size_t tape_size () const noexcept;
+
+    /**
+     * Parses JSON from string buffer (the source is copied).
+     */
+    static JEYSON__EXPORT lazy_document parse (char const * source, std::size_t len
+        , error * perr = nullptr);
+
+    static lazy_document parse (string_view source, error * perr = nullptr)
+    {
+        return parse(source.data(), source.size(), perr);
+    }
+
+    /**
+     * Parses JSON from string taking its ownership (no copy).
+     */
+    static JEYSON__EXPORT lazy_document parse (std::string && source, error * perr = nullptr);
+
+    static lazy_document parse (std::string const & source, error * perr = nullptr)
+    {
+        return parse(source.data(), source.size(), perr);
+    }
+
+    /**
+     * Parses JSON from file.
+     */
+    static JEYSON__EXPORT lazy_document parse (pfs::filesystem::path const & path
+        , error * perr = nullptr);
+};
+
+template <typename Backend>
+inline bool is_null (lazy_value<Backend> const & j) noexcept
+{
+    return j.is_null();
+}
+
+template <typename Backend>
+inline bool is_bool (lazy_value<Backend> const & j) noexcept
+{
+    return j.is_bool();
+}
+
+template <typename Backend>
+inline bool is_integer (lazy_value<Backend> const & j) noexcept
+{
+    return j.is_integer();
+}
+
+template <typename Backend>
+inline bool is_real (lazy_value<Backend> const & j) noexcept
+{
+    return j.is_real();
+}
+
+template <typename Backend>
+inline bool is_string (lazy_value<Backend> const & j) noexcept
+{
+    return j.is_string();
+}
+
+template <typename Backend>
+inline bool is_array (lazy_value<Backend> const & j) noexcept
+{
+    return j.is_array();
+}
+
+template <typename Backend>
+inline bool is_object (lazy_value<Backend> const & j) noexcept
+{
+    return j.is_object();
+}
+
+template <typename Backend>
+inline bool is_scalar (lazy_value<Backend> const & j) noexcept
+{
+    return j.is_scalar();
+}
+
+template <typename Backend>
+inline bool is_structured (lazy_value<Backend> const & j) noexcept
+{
+    return j.is_structured();
+}
+
+template <typename T, typename Backend>
+inline T get (lazy_value<Backend> const & j, bool & success) noexcept
+{
+    return j.template get<T>(success);
+}
+
+template <typename T, typename Backend>
+inline T get (lazy_value<Backend> const & j)
+{
+    return j.template get<T>();
+}
+
+template <typename T, typename Backend>
+inline T get_or (lazy_value<Backend> const & j, T const & alt) noexcept
+{
+    return j.template get_or<T>(alt);
+}
+
+template <typename Backend>
+inline std::string to_string (lazy_value<Backend> const & j)
+{
+    return j.to_string();
+}
+
+} // namespace jeyson
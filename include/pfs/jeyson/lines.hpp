@@ -0,0 +1,138 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `jeyson-lib`.
+//
+// Changelog:
+//      2026.10.15 Initial version.
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "error.hpp"
+#include "exports.hpp"
+#include "json.hpp"
+#include <pfs/filesystem.hpp>
+#include <pfs/string_view.hpp>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace jeyson {
+
+/**
+ * Result of parsing a line of JSON Lines (NDJSON) input.
+ */
+template <typename Backend>
+struct json_line
+{
+    std::size_t line {0};    // One-based line number
+    std::size_t offset {0};  // Byte offset of the line in the input
+    json<Backend> value;     // Parsed value (invalid on error)
+    error err;               // Parse error, `err.code()` is zero on success
+
+    bool ok () const noexcept
+    {
+        return !err.code();
+    }
+};
+
+template <typename Backend>
+using json_line_callback = std::function<void (json_line<Backend> &&)>;
+
+struct parse_lines_options
+{
+    // Number of parsing threads, zero means `std::thread::hardware_concurrency()`
+    std::size_t threads {0};
+
+    // Approximate number of input bytes processed by a thread at once
+    std::size_t batch_size {64 * 1024};
+};
+
+/**
+ * Parses JSON Lines input: each line (terminated by `\n` or `\r\n`) is a
+ * separate JSON value. Lines are parsed in parallel by the thread pool of
+ * @a opts.threads threads, results are passed to @a on_line in the input
+ * order from the calling thread. Empty and whitespace-only lines are
+ * skipped. Parse errors are reported per line and do not abort the batch.
+ *
+ * Exception thrown by @a on_line stops parsing and is rethrown.
+ */
+template <typename Backend>
+JEYSON__EXPORT void parse_lines (char const * data, std::size_t len
+    , json_line_callback<Backend> const & on_line
+    , parse_lines_options const & opts = parse_lines_options{});
+
+/**
+ * Parses JSON Lines file (the file is memory mapped).
+ *
+ * @return @c false if file can not be read (throws `jeyson::error` if
+ *         @a perr is @c nullptr).
+ */
+template <typename Backend>
+JEYSON__EXPORT bool parse_lines (pfs::filesystem::path const & path
+    , json_line_callback<Backend> const & on_line
+    , parse_lines_options const & opts = parse_lines_options{}
+    , error * perr = nullptr);
+
+template <typename Backend>
+inline void parse_lines (string_view source, json_line_callback<Backend> const & on_line
+    , parse_lines_options const & opts = parse_lines_options{})
+{
+    parse_lines<Backend>(source.data(), source.size(), on_line, opts);
+}
+
+template <typename Backend>
+inline void parse_lines (std::string const & source, json_line_callback<Backend> const & on_line
+    , parse_lines_options const & opts = parse_lines_options{})
+{
+    parse_lines<Backend>(source.data(), source.size(), on_line, opts);
+}
+
+/**
+ * Parses JSON Lines input, see above. Returns results in the input order.
+ */
+template <typename Backend>
+std::vector<json_line<Backend>> parse_lines (char const * data, std::size_t len
+    , parse_lines_options const & opts = parse_lines_options{})
+{
+    std::vector<json_line<Backend>> result;
+
+    parse_lines<Backend>(data, len, [& result] (json_line<Backend> && line) {
+        result.push_back(std::move(line));
+    }, opts);
+
+    return result;
+}
+
+template <typename Backend>
+inline std::vector<json_line<Backend>> parse_lines (string_view source
+    , parse_lines_options const & opts = parse_lines_options{})
+{
+    return parse_lines<Backend>(source.data(), source.size(), opts);
+}
+
+template <typename Backend>
+inline std::vector<json_line<Backend>> parse_lines (std::string const & source
+    , parse_lines_options const & opts = parse_lines_options{})
+{
+    return parse_lines<Backend>(source.data(), source.size(), opts);
+}
+
+/**
+ * Parses JSON Lines file, see above. Returns results in the input order.
+ */
+template <typename Backend>
+std::vector<json_line<Backend>> parse_lines (pfs::filesystem::path const & path
+    , parse_lines_options const & opts = parse_lines_options{}, error * perr = nullptr)
+{
+    std::vector<json_line<Backend>> result;
+
+    parse_lines<Backend>(path, [& result] (json_line<Backend> && line) {
+        result.push_back(std::move(line));
+    }, opts, perr);
+
+    return result;
+}
+
+} // namespace jeyson
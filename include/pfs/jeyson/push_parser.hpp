@@ -0,0 +1,123 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `jeyson-lib`.
+//
+// Changelog:
+//      2026.10.15 Initial version.
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "error.hpp"
+#include "exports.hpp"
+#include "json.hpp"
+#include <pfs/string_view.hpp>
+#include <cstddef>
+#include <functional>
+
+namespace jeyson {
+
+/**
+ * Incremental (push) JSON parser.
+ *
+ * Input is fed by chunks of arbitrary size (e.g. as received from network),
+ * the parser keeps its state between the calls and builds the values
+ * directly, without buffering the input (only an incomplete string or
+ * number token is buffered). Each top-level value is passed to the callback
+ * as soon as it is closed. Input may contain a sequence of top-level values
+ * (e.g. JSON Lines), numbers and literals at the top level must be followed
+ * by whitespace. Top-level number is completed by the following whitespace
+ * or by `finish()`.
+ *
+ * Grammar is the same as for `json::parse()` from a string: any value is
+ * accepted at the top level, `\u0000` is not allowed, the last of duplicate
+ * keys wins, maximum nesting depth is 2048.
+ *
+ * After an error the parser rejects input until `reset()` is called.
+ *
+ * Example:
+ * @code
+ * json_push_parser<backend::jansson> parser {[] (json<backend::jansson> && j) {
+ *     process(std::move(j));
+ * }};
+ *
+ * while (auto n = receive(buffer, sizeof(buffer)))
+ *     parser.feed(buffer, n);
+ *
+ * parser.finish();
+ * @endcode
+ */
+template <typename Backend>
+class json_push_parser
+{
+public:
+    using value_type = json<Backend>;
+    using value_callback = std::function<void (value_type &&)>;
+
+private:
+    class state;
+    state * _d {nullptr};
+
+public:
+    /**
+     * Constructs parser passing completed top-level values to @a on_value.
+     * Callback is called from `feed()` or `finish()`.
+     */
+    JEYSON__EXPORT explicit json_push_parser (value_callback on_value);
+
+    JEYSON__EXPORT json_push_parser (json_push_parser && other) noexcept;
+    JEYSON__EXPORT json_push_parser & operator = (json_push_parser && other) noexcept;
+
+    json_push_parser (json_push_parser const &) = delete;
+    json_push_parser & operator = (json_push_parser const &) = delete;
+
+    JEYSON__EXPORT ~json_push_parser ();
+
+    /**
+     * Parses the next chunk of input.
+     *
+     * @return @c true on success. On error throws `jeyson::error` or, if
+     *         @a perr is not @c nullptr, stores error in @a perr and returns
+     *         @c false. Values completed before the error are already passed
+     *         to the callback.
+     */
+    JEYSON__EXPORT bool feed (char const * data, std::size_t len, error * perr = nullptr);
+
+    bool feed (string_view chunk, error * perr = nullptr)
+    {
+        return feed(chunk.data(), chunk.size(), perr);
+    }
+
+    /**
+     * Signals the end of input: completes pending top-level number and checks
+     * that no value is left incomplete. Error reporting is the same as for
+     * `feed()`. The parser is ready for the new input after success.
+     */
+    JEYSON__EXPORT bool finish (error * perr = nullptr);
+
+    /**
+     * Drops incomplete value and error state, resets the byte offset.
+     */
+    JEYSON__EXPORT void reset ();
+
+    /**
+     * Number of bytes consumed since construction or last `reset()`.
+     */
+    JEYSON__EXPORT std::size_t offset () const noexcept;
+
+    /**
+     * Checks if parser is in error state.
+     */
+    JEYSON__EXPORT bool failed () const noexcept;
+
+    /**
+     * Byte offset of the error in the input (valid if `failed()`).
+     */
+    JEYSON__EXPORT std::size_t error_offset () const noexcept;
+
+    /**
+     * Checks if a value is partially parsed.
+     */
+    JEYSON__EXPORT bool incomplete () const noexcept;
+};
+
+} // namespace jeyson
@@ -0,0 +1,953 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `jeyson-lib`.
+//
+// Changelog:
+//      2026.10.15 Initial version.
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "constants.hpp"
+#include "iterator.hpp"
+#include "error.hpp"
+#include "json.hpp"
+#include "pfs/compare.hpp"
+#include "pfs/string_view.hpp"
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace jeyson {
+namespace v1 {
+
+////////////////////////////////////////////////////////////////////////////////
+// compact_value: JSON value with compact layout
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * JSON value occupying 16 bytes, alternative to `value<>` with the same
+ * interface.
+ *
+ * The last byte of the value holds the kind (low 4 bits) and the length of
+ * the inline string (high 4 bits). Strings up to @c max_inline_length bytes
+ * are stored in the value itself (null-terminated), longer strings are
+ * allocated as a single character block. Arrays are single blocks of values,
+ * objects are single blocks of key/value pairs in insertion order (keys are
+ * compared linearly). Size of a string or a container is kept in the value,
+ * capacity of a container is a power of two.
+ *
+ * As for `std::vector`, references to elements and members are invalidated
+ * by adding new ones to the container.
+ */
+class compact_value : public pfs::compare_operations
+{
+public:
+    struct member;
+
+    // Element and member storages as seen by `basic_iterator`
+    struct array_type
+    {
+        using iterator = pfs::pointer_proxy_iterator<compact_value>;
+    };
+
+    struct object_type
+    {
+        using key_type = std::string;
+        using iterator = member *;
+    };
+
+    using boolean_type    = bool;
+    using integer_type    = std::intmax_t;
+    using uinteger_type   = std::uintmax_t;
+    using real_type       = double;
+    using string_type     = std::string;
+    using size_type       = std::size_t;
+    using reference       = compact_value &;
+    using const_reference = compact_value const &;
+
+    using iterator = basic_iterator<compact_value>;
+    using const_iterator = basic_iterator<const compact_value>;
+
+    /// Maximum length of the string stored in the value itself.
+    static constexpr size_type max_inline_length = 14;
+
+private:
+    enum kind: std::uint8_t
+    {
+          null_kind = 0
+        , boolean_kind
+        , integer_kind
+        , uinteger_kind
+        , real_kind
+        , inline_string_kind
+        , string_kind
+        , array_kind
+        , object_kind
+    };
+
+    static constexpr std::uint8_t kind_mask = 0x0F;
+    static constexpr size_type max_container_size = size_type{1} << 31;
+
+    union payload
+    {
+        boolean_type  boolean_value;
+        integer_type  integer_value;
+        uinteger_type uinteger_value;
+        real_type     real_value;
+        char *          chars;
+        compact_value * items;
+        member *        members;
+    };
+
+    // Inline string occupies first `max_inline_length` bytes, the next one is
+    // its terminating null
+    payload _u;
+    std::uint32_t _size;
+    std::uint8_t _capacity_log2;
+    char _spare[2];
+    std::uint8_t _tag;
+
+private:
+    kind get_kind () const noexcept
+    {
+        return static_cast<kind>(_tag & kind_mask);
+    }
+
+    void init (kind k) noexcept
+    {
+        if (k == array_kind)
+            _u.items = nullptr;
+        else if (k == object_kind)
+            _u.members = nullptr;
+        else
+            _u.uinteger_value = 0;
+
+        _size = 0;
+        _capacity_log2 = 0;
+        _spare[0] = '\0';
+        _spare[1] = '\0';
+        _tag = k;
+    }
+
+    char * inline_chars () noexcept
+    {
+        return reinterpret_cast<char *>(this);
+    }
+
+    char const * string_data () const noexcept
+    {
+        return get_kind() == inline_string_kind
+            ? reinterpret_cast<char const *>(this)
+            : _u.chars;
+    }
+
+    size_type string_length () const noexcept
+    {
+        return get_kind() == inline_string_kind
+            ? static_cast<size_type>(_tag >> 4)
+            : static_cast<size_type>(_size);
+    }
+
+    void init_string (char const * s, size_type n)
+    {
+        if (n <= max_inline_length) {
+            init(inline_string_kind);
+
+            if (n > 0)
+                std::memcpy(inline_chars(), s, n);
+
+            _tag = static_cast<std::uint8_t>(inline_string_kind | (n << 4));
+            return;
+        }
+
+        if (n > (std::numeric_limits<std::uint32_t>::max)())
+            throw std::length_error("string is too long");
+
+        init(string_kind);
+        _u.chars = new char[n + 1];
+        std::memcpy(_u.chars, s, n);
+        _u.chars[n] = '\0';
+        _size = static_cast<std::uint32_t>(n);
+    }
+
+    size_type capacity () const noexcept
+    {
+        auto block = is_array()
+            ? static_cast<void const *>(_u.items)
+            : static_cast<void const *>(_u.members);
+
+        return block == nullptr ? 0 : size_type{1} << _capacity_log2;
+    }
+
+    // Capacity (a power of two) enough for @a n elements (members)
+    static std::uint8_t capacity_log2_for (size_type n)
+    {
+        if (n > max_container_size)
+            throw std::length_error("container is too large");
+
+        std::uint8_t result = 2;
+
+        while ((size_type{1} << result) < n)
+            result++;
+
+        return result;
+    }
+
+    template <typename T>
+    static T * allocate (std::uint8_t capacity_log2)
+    {
+        return static_cast<T *>(::operator new((size_type{1} << capacity_log2) * sizeof(T)));
+    }
+
+    // Moves elements (members) of the container into the new block
+    template <typename T>
+    void reallocate (T * & data, size_type n)
+    {
+        auto log2 = capacity_log2_for(n);
+        auto block = allocate<T>(log2);
+
+        for (std::uint32_t i = 0; i < _size; i++) {
+            new (block + i) T(std::move(data[i]));
+            data[i].~T();
+        }
+
+        ::operator delete(data);
+        data = block;
+        _capacity_log2 = log2;
+    }
+
+    template <typename T>
+    void copy_container (T * & data, T const * other_data, std::uint32_t n)
+    {
+        if (n == 0)
+            return;
+
+        _capacity_log2 = capacity_log2_for(n);
+        data = allocate<T>(_capacity_log2);
+
+        try {
+            for (; _size < n; _size++)
+                new (data + _size) T(other_data[_size]);
+        } catch (...) {
+            destroy();
+            init(null_kind);
+            throw;
+        }
+    }
+
+    template <typename T>
+    void destroy_elements (T * data) noexcept
+    {
+        for (std::uint32_t i = 0; i < _size; i++)
+            data[i].~T();
+    }
+
+    void destroy () noexcept;
+
+    member * find_member (char const * key, size_type n) const noexcept;
+
+    template <typename Iterator>
+    Iterator begin () noexcept
+    {
+        switch (get_kind()) {
+            case array_kind:
+                return Iterator{typename array_type::iterator{_u.items}};
+            case object_kind:
+                return Iterator{_u.members};
+            default:
+                break;
+        }
+
+        return Iterator{this};
+    }
+
+    template <typename Iterator>
+    Iterator end () noexcept
+    {
+        switch (get_kind()) {
+            case array_kind:
+                return Iterator{typename array_type::iterator{_u.items + _size}};
+            case object_kind:
+                return Iterator{_u.members + _size};
+            default:
+                break;
+        }
+
+        return Iterator{this + 1};
+    }
+
+public:
+    compact_value (type_enum t)
+    {
+        switch (t) {
+            case type_enum::boolean:  init(boolean_kind); break;
+            case type_enum::integer:  init(integer_kind); break;
+            case type_enum::uinteger: init(uinteger_kind); break;
+            case type_enum::real:     init(real_kind); break;
+            case type_enum::string:   init(inline_string_kind); break;
+            case type_enum::array:    init(array_kind); break;
+            case type_enum::object:   init(object_kind); break;
+            case type_enum::null:
+            default:
+                init(null_kind);
+                break;
+        }
+    }
+
+    compact_value (std::nullptr_t = nullptr) noexcept
+    {
+        init(null_kind);
+    }
+
+    compact_value (bool v) noexcept
+    {
+        init(boolean_kind);
+        _u.boolean_value = v;
+    }
+
+    template <typename T
+            , typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value, int>::type = 0>
+    compact_value (T v) noexcept
+    {
+        init(integer_kind);
+        _u.integer_value = integer_type{v};
+    }
+
+    template <typename T
+            , typename std::enable_if<std::is_integral<T>::value && !std::is_signed<T>::value, int>::type = 0>
+    compact_value (T v) noexcept
+    {
+        init(uinteger_kind);
+        _u.uinteger_value = uinteger_type{v};
+    }
+
+    template <typename T
+            , typename std::enable_if<std::is_floating_point<T>::value, int>::type = 0>
+    compact_value (T v) noexcept
+    {
+        init(real_kind);
+        _u.real_value = real_type{v};
+    }
+
+    compact_value (pfs::string_view v)
+    {
+        init_string(v.data(), v.size());
+    }
+
+    compact_value (string_type const & v)
+    {
+        init_string(v.data(), v.size());
+    }
+
+    /**
+     * C-string must be converted to @c string_type
+     */
+    compact_value (char const * v)
+    {
+        init_string(v, std::strlen(v));
+    }
+
+    compact_value (compact_value const & other)
+    {
+        init(null_kind);
+
+        switch (other.get_kind()) {
+            case string_kind:
+                init_string(other._u.chars, other._size);
+                break;
+
+            case array_kind:
+                init(array_kind);
+                copy_container(_u.items, other._u.items, other._size);
+                break;
+
+            case object_kind:
+                init(object_kind);
+                copy_container(_u.members, other._u.members, other._size);
+                break;
+
+            default:
+                // Scalars and inline strings
+                _u = other._u;
+                _size = other._size;
+                _capacity_log2 = other._capacity_log2;
+                _spare[0] = other._spare[0];
+                _spare[1] = other._spare[1];
+                _tag = other._tag;
+                break;
+        }
+    }
+
+    compact_value (compact_value && other) noexcept
+        : _u(other._u)
+        , _size(other._size)
+        , _capacity_log2(other._capacity_log2)
+        , _spare{other._spare[0], other._spare[1]}
+        , _tag(other._tag)
+    {
+        other.init(null_kind);
+    }
+
+    /**
+     */
+    ~compact_value ()
+    {
+        destroy();
+    }
+
+    compact_value & operator = (compact_value rhs) noexcept
+    {
+        swap(rhs);
+        return *this;
+    }
+
+    void swap (compact_value & other) noexcept
+    {
+        using std::swap;
+
+        swap(_u, other._u);
+        swap(_size, other._size);
+        swap(_capacity_log2, other._capacity_log2);
+        swap(_spare[0], other._spare[0]);
+        swap(_spare[1], other._spare[1]);
+        swap(_tag, other._tag);
+    }
+
+    /**
+     */
+    type_enum type () const noexcept
+    {
+        // Both string kinds are mapped to `type_enum::string`
+        auto k = get_kind();
+        return static_cast<type_enum>(k > inline_string_kind ? k - 1 : k);
+    }
+
+    /**
+     */
+    bool is_null () const noexcept
+    {
+        return get_kind() == null_kind;
+    }
+
+    /**
+     */
+    bool is_boolean () const noexcept
+    {
+        return get_kind() == boolean_kind;
+    }
+
+    /**
+     */
+    bool is_integer () const noexcept
+    {
+        return get_kind() == integer_kind;
+    }
+
+    /**
+     */
+    bool is_uinteger () const noexcept
+    {
+        return get_kind() == uinteger_kind;
+    }
+
+    /**
+     */
+    bool is_real () const noexcept
+    {
+        return get_kind() == real_kind;
+    }
+
+    /**
+     */
+    bool is_integral () const noexcept
+    {
+        return is_integer() || is_uinteger();
+    }
+
+    /**
+     */
+    bool is_number () const noexcept
+    {
+        return is_integer() || is_uinteger() || is_real();
+    }
+
+    /**
+     */
+    bool is_string () const noexcept
+    {
+        return get_kind() == inline_string_kind || get_kind() == string_kind;
+    }
+
+    /**
+     */
+    bool is_array () const noexcept
+    {
+        return get_kind() == array_kind;
+    }
+
+    /**
+     */
+    bool is_object () const noexcept
+    {
+        return get_kind() == object_kind;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Element access
+    ////////////////////////////////////////////////////////////////////////////
+    reference operator [] (size_type pos)
+    {
+        if (is_null())
+            init(array_kind);
+
+        if (!is_array())
+            throw error {errc::type_error};
+
+        if (pos >= _size) {
+            if (pos >= capacity())
+                reallocate(_u.items, pos + 1);
+
+            for (; _size <= pos; _size++)
+                new (_u.items + _size) compact_value;
+        }
+
+        return _u.items[pos];
+    }
+
+    const_reference operator [] (size_type pos) const
+    {
+        if (!is_array())
+            throw error {errc::type_error};
+
+        return _u.items[pos];
+    }
+
+    /**
+     * Returns value of the member with @a key, missing member is added as
+     * null.
+     */
+    reference operator [] (pfs::string_view key);
+
+    /**
+     * Returns value of the member with @a key.
+     *
+     * @throw error {errc::type_error} if value is not an object or it has
+     *        no member with @a key.
+     */
+    const_reference operator [] (pfs::string_view key) const;
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Cast operations
+    ////////////////////////////////////////////////////////////////////////////
+
+    // Casting to boolean
+    template <typename T>
+    typename std::enable_if<std::is_same<bool, T>::value,T>::type
+    get () const
+    {
+        switch (get_kind()) {
+            case boolean_kind:
+                return _u.boolean_value;
+
+            case integer_kind:
+            case uinteger_kind:
+                return _u.integer_value != integer_type(0);
+
+            case real_kind:
+                return _u.real_value != real_type(0.0);
+
+            default:
+                break;
+        }
+
+        throw error {errc::type_cast_error};
+        return T{};
+    }
+
+    // Casting to integers
+    template <typename T>
+    typename std::enable_if<std::is_integral<T>::value
+            && !std::is_same<bool, T>::value, T>::type
+    get () const
+    {
+        switch (get_kind()) {
+            case boolean_kind:  return static_cast<T>(_u.boolean_value);
+            case integer_kind:  return static_cast<T>(_u.integer_value);
+            case uinteger_kind: return static_cast<T>(_u.uinteger_value);
+            case real_kind:     return static_cast<T>(_u.real_value);
+            default: break;
+        }
+
+        throw error {errc::type_cast_error};
+        return T{};
+    }
+
+    // Casting to floating point
+    template <typename T>
+    typename std::enable_if<std::is_floating_point<T>::value, T>::type
+    get () const
+    {
+        switch (get_kind()) {
+            case boolean_kind:  return static_cast<T>(_u.boolean_value);
+            case integer_kind:  return static_cast<T>(_u.integer_value);
+            case uinteger_kind: return static_cast<T>(_u.uinteger_value);
+            case real_kind:     return static_cast<T>(_u.real_value);
+            default: break;
+        }
+
+        throw error {errc::type_cast_error};
+        return T();
+    }
+
+    // Casting to string
+    template <typename T>
+    typename std::enable_if<std::is_same<string_type, T>::value, T>::type
+    get () const
+    {
+        switch (get_kind()) {
+            case boolean_kind:  return stringify<string_type>(_u.boolean_value);
+            case integer_kind:  return stringify<string_type>(_u.integer_value);
+            case uinteger_kind: return stringify<string_type>(_u.uinteger_value);
+            case real_kind:     return stringify<string_type>(_u.real_value);
+            case inline_string_kind:
+            case string_kind:   return string_type(string_data(), string_length());
+            default: break;
+        }
+
+        throw error {errc::type_cast_error};
+        return T();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Iterators
+    ////////////////////////////////////////////////////////////////////////////
+    // Object iterators point to the member values, keys are not accessible
+    // through iterators (as for `value<>`).
+    iterator begin () noexcept
+    {
+        return begin<iterator>();
+    }
+
+    const_iterator begin () const noexcept
+    {
+        return const_cast<compact_value *>(this)->begin<const_iterator>();
+    }
+
+    const_iterator cbegin () const noexcept
+    {
+        return begin();
+    }
+
+    iterator end () noexcept
+    {
+        return end<iterator>();
+    }
+
+    const_iterator end () const noexcept
+    {
+        return const_cast<compact_value *>(this)->end<const_iterator>();
+    }
+
+    const_iterator cend () const noexcept
+    {
+        return end();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Collection specific methods
+    //
+    // Capacity
+    ////////////////////////////////////////////////////////////////////////////
+    /**
+     * @brief Returns the number of elements in a JSON value (see `value<>::size()`).
+     */
+    size_type size () const noexcept
+    {
+        switch (get_kind()) {
+            case null_kind:
+                return 0;
+            case array_kind:
+            case object_kind:
+                return _size;
+            default:
+                break;
+        }
+
+        return 1;
+    }
+
+    /**
+     * @brief Checks whether the JSON value has no elements (see `value<>::empty()`).
+     */
+    bool empty () const noexcept
+    {
+        return size() == 0;
+    }
+
+    /**
+     * @brief Returns the maximum number of elements the JSON value is able
+     *        to hold (see `value<>::max_size()`).
+     */
+    size_type max_size () const noexcept
+    {
+        switch (get_kind()) {
+            case null_kind:
+                return 0;
+            case array_kind:
+            case object_kind:
+                return max_container_size;
+            default:
+                break;
+        }
+
+        return 1;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Collection specific methods
+    //
+    // Modifiers
+    ////////////////////////////////////////////////////////////////////////////
+    void clear () noexcept
+    {
+        switch (get_kind()) {
+            case boolean_kind:
+                _u.boolean_value = boolean_type(false);
+                break;
+
+            case integer_kind:
+                _u.integer_value = integer_type(0);
+                break;
+
+            case uinteger_kind:
+                _u.uinteger_value = uinteger_type(0);
+                break;
+
+            case real_kind:
+                _u.real_value = real_type(0.0);
+                break;
+
+            case inline_string_kind:
+            case string_kind:
+                destroy();
+                init(inline_string_kind);
+                break;
+
+            case array_kind:
+                destroy_elements(_u.items);
+                _size = 0;
+                break;
+
+            case object_kind:
+                destroy_elements(_u.members);
+                _size = 0;
+                break;
+
+            case null_kind:
+            default:
+                break;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Array specific methods
+    ////////////////////////////////////////////////////////////////////////////
+    void push_back (compact_value && v)
+    {
+        if (is_null())
+            init(array_kind);
+
+        if (!is_array())
+            throw error {errc::type_error};
+
+        if (_size == capacity())
+            reallocate(_u.items, size_type{_size} + 1);
+
+        new (_u.items + _size) compact_value(std::move(v));
+        _size++;
+    }
+
+    void push_back (compact_value const & v)
+    {
+        push_back(compact_value{v});
+    }
+
+    reference operator += (compact_value && v)
+    {
+        push_back(std::move(v));
+        return *this;
+    }
+
+    reference operator += (compact_value const & v)
+    {
+        push_back(v);
+        return *this;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Comparison
+    ////////////////////////////////////////////////////////////////////////////
+    friend bool operator == (compact_value const & lhs, compact_value const & rhs);
+};
+
+struct compact_value::member
+{
+    compact_value first;
+    compact_value second;
+};
+
+inline void compact_value::destroy () noexcept
+{
+    static_assert(sizeof(compact_value) == 16, "compact_value must occupy 16 bytes");
+    static_assert(offsetof(compact_value, _tag) == 15, "tag must be the last byte");
+
+    switch (get_kind()) {
+        case string_kind:
+            delete [] _u.chars;
+            break;
+
+        case array_kind:
+            if (_u.items) {
+                destroy_elements(_u.items);
+                ::operator delete(_u.items);
+            }
+            break;
+
+        case object_kind:
+            if (_u.members) {
+                destroy_elements(_u.members);
+                ::operator delete(_u.members);
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+inline compact_value::member *
+compact_value::find_member (char const * key, size_type n) const noexcept
+{
+    for (std::uint32_t i = 0; i < _size; i++) {
+        auto & k = _u.members[i].first;
+
+        if (k.string_length() == n && std::memcmp(k.string_data(), key, n) == 0)
+            return _u.members + i;
+    }
+
+    return nullptr;
+}
+
+inline compact_value::reference
+compact_value::operator [] (pfs::string_view key)
+{
+    if (is_null())
+        init(object_kind);
+
+    if (!is_object())
+        throw error {errc::type_error};
+
+    if (auto m = find_member(key.data(), key.size()))
+        return m->second;
+
+    compact_value k {key};
+
+    if (_size == capacity())
+        reallocate(_u.members, size_type{_size} + 1);
+
+    auto m = new (_u.members + _size) member{std::move(k), compact_value{}};
+    _size++;
+
+    return m->second;
+}
+
+inline compact_value::const_reference
+compact_value::operator [] (pfs::string_view key) const
+{
+    if (!is_object())
+        throw error {errc::type_error};
+
+    auto m = find_member(key.data(), key.size());
+
+    if (m == nullptr)
+        throw error {errc::type_error};
+
+    return m->second;
+}
+
+inline bool operator == (compact_value const & lhs, compact_value const & rhs)
+{
+    if (& lhs == & rhs)
+        return true;
+
+    if (lhs.type() != rhs.type()) {
+        if (lhs.is_integral() && rhs.is_integral()) {
+            auto & i = lhs.is_integer() ? lhs : rhs;
+            auto & u = lhs.is_integer() ? rhs : lhs;
+
+            return i._u.integer_value < 0
+                ? false
+                : static_cast<compact_value::uinteger_type>(i._u.integer_value)
+                    == u._u.uinteger_value;
+        } else if (lhs.is_number() && rhs.is_number()) {
+            return lhs.get<compact_value::real_type>() == rhs.get<compact_value::real_type>();
+        }
+
+        return false;
+    }
+
+    switch (lhs.get_kind()) {
+        case compact_value::boolean_kind:
+            return lhs._u.boolean_value == rhs._u.boolean_value;
+
+        case compact_value::integer_kind:
+            return lhs._u.integer_value == rhs._u.integer_value;
+
+        case compact_value::uinteger_kind:
+            return lhs._u.uinteger_value == rhs._u.uinteger_value;
+
+        case compact_value::real_kind:
+            return lhs._u.real_value == rhs._u.real_value;
+
+        case compact_value::inline_string_kind:
+        case compact_value::string_kind:
+            return lhs.string_length() == rhs.string_length()
+                && std::memcmp(lhs.string_data(), rhs.string_data(), lhs.string_length()) == 0;
+
+        case compact_value::array_kind:
+            if (lhs._size != rhs._size)
+                return false;
+
+            for (std::uint32_t i = 0; i < lhs._size; i++) {
+                if (!(lhs._u.items[i] == rhs._u.items[i]))
+                    return false;
+            }
+
+            return true;
+
+        case compact_value::object_kind:
+            if (lhs._size != rhs._size)
+                return false;
+
+            // Order of members does not matter
+            for (std::uint32_t i = 0; i < lhs._size; i++) {
+                auto & m = lhs._u.members[i];
+                auto other = rhs.find_member(m.first.string_data(), m.first.string_length());
+
+                if (other == nullptr || !(m.second == other->second))
+                    return false;
+            }
+
+            return true;
+
+        case compact_value::null_kind:
+        default:
+            return true;
+    }
+}
+
+}} // namespace jeyson::v1
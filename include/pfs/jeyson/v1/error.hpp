@@ -6,6 +6,8 @@
 // Changelog:
 //      2019.12.05 Initial version (pfs-json).
 //      2022.02.07 Initial version (jeyson-lib).
+//      2026.10.15 Added max_depth_exceeded error.
+//      2026.10.16 Moved max_depth_exceeded to the end of the error codes.
 ////////////////////////////////////////////////////////////////////////////////
 #pragma once
 #include "pfs/error.hpp"
@@ -30,6 +32,9 @@ enum class errc
     , type_error
     , type_cast_error
     , null_pointer
+
+// Parser errors (appended to keep the values of the codes above)
+    , max_depth_exceeded
 };
 
 class error_category : public std::error_category
@@ -71,6 +76,9 @@ public:
             case static_cast<int>(errc::null_pointer):
                 return std::string{"null pointer"};
 
+            case static_cast<int>(errc::max_depth_exceeded):
+                return std::string{"maximum nesting depth exceeded"};
+
             default: return std::string{"unknown JSON error"};
         }
     }
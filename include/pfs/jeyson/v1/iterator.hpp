@@ -6,10 +6,12 @@
 // Changelog:
 //      2020.03.13 Initial version (pfs-json).
 //      2022.02.07 Initial version (jeyson-lib).
+//      2026.10.15 Fixed `error.hpp` include.
+//                 Fixed array and object iterators.
 ////////////////////////////////////////////////////////////////////////////////
 #pragma once
 #include "constants.hpp"
-#include "pfs/jeyson/error.hpp"
+#include "error.hpp"
 #include "pfs/iterator.hpp"
 #include "pfs/variant.hpp"
 #include <cassert>
@@ -68,8 +70,7 @@ protected:
     basic_iterator (array_iterator it) noexcept
         : _index(array_iterator_index)
     {
-        auto & native_it = pfs::get<array_iterator_index>(_mit);
-        native_it = it;
+        _mit.template emplace<array_iterator_index>(it);
     }
 
     ////////////////////////////////////////////////////////////////////////////
@@ -78,8 +79,7 @@ protected:
     basic_iterator (object_iterator it) noexcept
         : _index(object_iterator_index)
     {
-        auto & native_it = pfs::get<object_iterator_index>(_mit);
-        native_it = it;
+        _mit.template emplace<object_iterator_index>(it);
     }
 
     const reference ref () const
@@ -156,12 +156,26 @@ public:
         }
     }
 
+    // End iterators of containers can not be dereferenced, so the native
+    // iterators are compared
     bool equals (basic_iterator const & rhs) const
     {
         if (_index != rhs._index)
             return false;
 
-        return this->ptr() == rhs.ptr();
+        switch (_index) {
+            case array_iterator_index:
+                return pfs::get<array_iterator_index>(_mit)
+                    == pfs::get<array_iterator_index>(rhs._mit);
+            case object_iterator_index:
+                return pfs::get<object_iterator_index>(_mit)
+                    == pfs::get<object_iterator_index>(rhs._mit);
+            default:
+                break;
+        }
+
+        return pfs::get<scalar_iterator_index>(_mit)
+            == pfs::get<scalar_iterator_index>(rhs._mit);
     }
 };
 
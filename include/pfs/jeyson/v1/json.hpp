@@ -7,16 +7,22 @@
 //      2019.10.05 Initial version (pfs-json).
 //      2019.12.05 Error-specific code moved into `error.h`
 //      2022.02.07 Initial version (jeyson-lib).
+//      2026.10.15 Fixed includes.
+//                 Iteration over array and object elements.
+//      2026.10.16 Allocator for string, array and object storages.
 ////////////////////////////////////////////////////////////////////////////////
 #pragma once
 #include "constants.hpp"
 #include "iterator.hpp"
-#include "pfs/jeyson/error.hpp"
+#include "error.hpp"
 #include "pfs/compare.hpp"
 #include "pfs/fmt.hpp"
+#include <iostream>
 #include <list>
 #include <map>
+#include <memory>
 #include <utility>
+#include <vector>
 #include <cassert>
 
 namespace jeyson {
@@ -94,13 +100,19 @@ StringType stringify (bool value)
 }
 
 // Reference JSON class
+//
+// String, array and object storages of the value are allocated by
+// `Allocator` (rebound to the storage type, a default constructed instance
+// is used for every allocation). Elements of the storages are allocated by
+// the allocators of `StringType`, `ArrayType` and `ObjectType`.
 template <typename BoolType = bool
     , typename IntegerType = std::intmax_t
     , typename UIntegerType = std::uintmax_t
     , typename RealType = double
     , typename StringType = std::string
     , template <typename> class ArrayType = array_type
-    , template <typename, typename> class ObjectType = object_type>
+    , template <typename, typename> class ObjectType = object_type
+    , typename Allocator = std::allocator<char>>
 class value : public pfs::compare_operations
 {
 public:
@@ -111,6 +123,7 @@ public:
     using string_type     = StringType;
     using array_type      = ArrayType<value>;
     using object_type     = ObjectType<StringType, value>;
+    using allocator_type  = Allocator;
     using size_type       = std::size_t;
     using reference       = value &;
     using const_reference = value const &;
@@ -137,26 +150,26 @@ protected:
         value_rep (integer_type v)  noexcept : integer_value(v) {}
         value_rep (uinteger_type v) noexcept : uinteger_value(v) {}
         value_rep (real_type v)     noexcept : real_value(v) {}
-        value_rep (string_type const & v) : string_value(new string_type(v)) {}
-        value_rep (string_type && v) : string_value(new string_type(std::forward<string_type>(v))) {}
-        value_rep (array_type const & v) : array_value(new array_type(v)) {}
-        value_rep (array_type && v) : array_value(new array_type(std::forward<array_type>(v))) {}
-        value_rep (object_type const & v) : object_value(new object_type(v)) {}
-        value_rep (object_type && v) : object_value(new object_type(std::forward<object_type>(v))) {}
+        value_rep (string_type const & v) : string_value(create<string_type>(v)) {}
+        value_rep (string_type && v) : string_value(create<string_type>(std::forward<string_type>(v))) {}
+        value_rep (array_type const & v) : array_value(create<array_type>(v)) {}
+        value_rep (array_type && v) : array_value(create<array_type>(std::forward<array_type>(v))) {}
+        value_rep (object_type const & v) : object_value(create<object_type>(v)) {}
+        value_rep (object_type && v) : object_value(create<object_type>(std::forward<object_type>(v))) {}
 
         value_rep (type_enum t)
         {
             switch (t) {
                 case type_enum::object:
-                    object_value = new object_type;
+                    object_value = create<object_type>();
                     break;
 
                 case type_enum::array:
-                    array_value = new array_type;
+                    array_value = create<array_type>();
                     break;
 
                 case type_enum::string:
-                    string_value = new string_type("");
+                    string_value = create<string_type>("");
                     break;
 
                 case type_enum::boolean:
@@ -182,6 +195,39 @@ protected:
             }
         }
 
+        template <typename T, typename ...Args>
+        static T * create (Args &&... args)
+        {
+            using allocator_traits = std::allocator_traits<
+                typename std::allocator_traits<Allocator>::template rebind_alloc<T>>;
+
+            static_assert(std::is_same<typename allocator_traits::pointer, T *>::value
+                , "allocator must use raw pointers");
+
+            typename allocator_traits::allocator_type a;
+            auto p = allocator_traits::allocate(a, 1);
+
+            try {
+                allocator_traits::construct(a, p, std::forward<Args>(args)...);
+            } catch (...) {
+                allocator_traits::deallocate(a, p, 1);
+                throw;
+            }
+
+            return p;
+        }
+
+        template <typename T>
+        static void dispose (T * p) noexcept
+        {
+            using allocator_traits = std::allocator_traits<
+                typename std::allocator_traits<Allocator>::template rebind_alloc<T>>;
+
+            typename allocator_traits::allocator_type a;
+            allocator_traits::destroy(a, p);
+            allocator_traits::deallocate(a, p, 1);
+        }
+
         void nullify ()
         {
             object_value = nullptr;
@@ -192,21 +238,21 @@ protected:
             switch (t) {
                 case type_enum::string:
                     if (string_value) {
-                        delete string_value;
+                        dispose(string_value);
                         string_value = nullptr;
                     }
                     break;
 
                 case type_enum::array:
                     if (array_value) {
-                        delete array_value;
+                        dispose(array_value);
                         array_value = nullptr;
                     }
                     break;
 
                 case type_enum::object:
                     if (object_value) {
-                        delete object_value;
+                        dispose(object_value);
                         object_value = nullptr;
                     }
                     break;
@@ -337,6 +383,18 @@ public:
         return *this;
     }
 
+    /**
+     * Makes the value null without destroying its contents. Nothing is
+     * deallocated, so this is for values allocated from memory released
+     * at once (e.g. a monotonic buffer) only: the tree is dropped without
+     * walking it.
+     */
+    void discard () noexcept
+    {
+        _type = type_enum::null;
+        _value.nullify();
+    }
+
     /**
      */
     type_enum type () const noexcept
@@ -575,6 +633,15 @@ private:
     template <typename Iterator>
     Iterator begin () noexcept
     {
+        switch (_type) {
+            case type_enum::array:
+                return Iterator{_value.array_value->begin()};
+            case type_enum::object:
+                return Iterator{_value.object_value->begin()};
+            default:
+                break;
+        }
+
         return Iterator{this};
     }
 
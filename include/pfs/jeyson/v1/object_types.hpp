@@ -0,0 +1,744 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `jeyson-lib`.
+//
+// Changelog:
+//      2026.10.16 Initial version.
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace jeyson {
+namespace v1 {
+
+// Object storages to use as `ObjectType` of the `value` template instead of
+// the default `std::map`, e.g.:
+//
+//      using json_value = value<bool, std::intmax_t, std::uintmax_t, double
+//          , std::string, array_type, ordered_object>;
+//
+// Members are `std::pair<key_type, mapped_type>`, keys must not be modified
+// through iterators. Unlike `std::map`, adding a member invalidates references
+// and iterators to members. Objects are compared regardless of the member
+// order.
+
+////////////////////////////////////////////////////////////////////////////////
+// sorted_object: members in a vector sorted by key
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * Members are kept in a single vector sorted by key. Lookup is a binary
+ * search, insertion shifts the members after the insertion point. Iteration
+ * is in key order, as for `std::map`.
+ */
+template <typename KeyType, typename ValueType>
+class sorted_object
+{
+public:
+    using key_type       = KeyType;
+    using mapped_type    = ValueType;
+    using value_type     = std::pair<KeyType, ValueType>;
+    using size_type      = std::size_t;
+    using container_type = std::vector<value_type>;
+    using iterator       = typename container_type::iterator;
+    using const_iterator = typename container_type::const_iterator;
+
+private:
+    container_type _members;
+
+private:
+    iterator lower_bound (key_type const & key)
+    {
+        return std::lower_bound(_members.begin(), _members.end(), key
+            , [] (value_type const & m, key_type const & k) { return m.first < k; });
+    }
+
+    bool matches (iterator pos, key_type const & key) const
+    {
+        return pos != _members.end() && !(key < pos->first);
+    }
+
+public:
+    iterator begin () noexcept { return _members.begin(); }
+    iterator end () noexcept { return _members.end(); }
+    const_iterator begin () const noexcept { return _members.begin(); }
+    const_iterator end () const noexcept { return _members.end(); }
+
+    size_type size () const noexcept { return _members.size(); }
+    bool empty () const noexcept { return _members.empty(); }
+    size_type max_size () const noexcept { return _members.max_size(); }
+
+    void reserve (size_type n) { _members.reserve(n); }
+    void clear () noexcept { _members.clear(); }
+
+    iterator find (key_type const & key)
+    {
+        auto pos = lower_bound(key);
+        return matches(pos, key) ? pos : _members.end();
+    }
+
+    const_iterator find (key_type const & key) const
+    {
+        return const_cast<sorted_object *>(this)->find(key);
+    }
+
+    size_type count (key_type const & key) const
+    {
+        return find(key) != end() ? 1 : 0;
+    }
+
+    mapped_type & operator [] (key_type const & key)
+    {
+        auto pos = lower_bound(key);
+
+        if (!matches(pos, key))
+            pos = _members.emplace(pos, key, mapped_type{});
+
+        return pos->second;
+    }
+
+    mapped_type & operator [] (key_type && key)
+    {
+        auto pos = lower_bound(key);
+
+        if (!matches(pos, key))
+            pos = _members.emplace(pos, std::move(key), mapped_type{});
+
+        return pos->second;
+    }
+
+    template <typename ...Args>
+    std::pair<iterator, bool> emplace (Args &&... args)
+    {
+        value_type m(std::forward<Args>(args)...);
+        auto pos = lower_bound(m.first);
+
+        if (matches(pos, m.first))
+            return std::make_pair(pos, false);
+
+        return std::make_pair(_members.insert(pos, std::move(m)), true);
+    }
+
+    friend bool operator == (sorted_object const & lhs, sorted_object const & rhs)
+    {
+        return lhs._members == rhs._members;
+    }
+
+    friend bool operator != (sorted_object const & lhs, sorted_object const & rhs)
+    {
+        return !(lhs == rhs);
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// basic_ordered_object: members in a vector in insertion order
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * Members are kept in a single vector in insertion order. Objects with up to
+ * @a Threshold members are searched linearly. Larger objects are additionally
+ * indexed by an open addressing hash table of member positions, built when
+ * the object outgrows the threshold.
+ */
+template <typename KeyType, typename ValueType, std::size_t Threshold>
+class basic_ordered_object
+{
+public:
+    using key_type       = KeyType;
+    using mapped_type    = ValueType;
+    using value_type     = std::pair<KeyType, ValueType>;
+    using size_type      = std::size_t;
+    using container_type = std::vector<value_type>;
+    using iterator       = typename container_type::iterator;
+    using const_iterator = typename container_type::const_iterator;
+
+    /// Objects with more members are indexed by a hash table.
+    static constexpr size_type index_threshold = Threshold;
+
+private:
+    container_type _members;
+
+    // Slots hold the position of the member plus one, zero is a free slot
+    std::vector<std::uint32_t> _index;
+
+private:
+    static std::size_t hash_of (key_type const & key)
+    {
+        return std::hash<key_type>{}(key);
+    }
+
+    // Returns size() if there is no member with the key
+    size_type position_of (key_type const & key) const
+    {
+        auto n = _members.size();
+
+        if (_index.empty()) {
+            for (size_type i = 0; i < n; i++) {
+                if (_members[i].first == key)
+                    return i;
+            }
+
+            return n;
+        }
+
+        auto mask = _index.size() - 1;
+
+        for (auto slot = hash_of(key) & mask;; slot = (slot + 1) & mask) {
+            auto pos = _index[slot];
+
+            if (pos == 0)
+                return n;
+
+            if (_members[pos - 1].first == key)
+                return pos - 1;
+        }
+    }
+
+    void index_member (size_type pos)
+    {
+        auto mask = _index.size() - 1;
+        auto slot = hash_of(_members[pos].first) & mask;
+
+        while (_index[slot] != 0)
+            slot = (slot + 1) & mask;
+
+        _index[slot] = static_cast<std::uint32_t>(pos + 1);
+    }
+
+    // Load factor of the index is kept within 1/4..1/2
+    void rebuild_index ()
+    {
+        size_type capacity = 4;
+
+        while (capacity < 4 * _members.size())
+            capacity <<= 1;
+
+        _index.assign(capacity, 0);
+
+        for (size_type pos = 0; pos < _members.size(); pos++)
+            index_member(pos);
+    }
+
+    // Must be called after the member is appended
+    iterator appended ()
+    {
+        auto n = _members.size();
+
+        if (n > index_threshold) {
+            if (2 * n > _index.size())
+                rebuild_index();
+            else
+                index_member(n - 1);
+        }
+
+        return _members.begin() + (n - 1);
+    }
+
+public:
+    iterator begin () noexcept { return _members.begin(); }
+    iterator end () noexcept { return _members.end(); }
+    const_iterator begin () const noexcept { return _members.begin(); }
+    const_iterator end () const noexcept { return _members.end(); }
+
+    size_type size () const noexcept { return _members.size(); }
+    bool empty () const noexcept { return _members.empty(); }
+
+    size_type max_size () const noexcept
+    {
+        return (std::min)(_members.max_size()
+            , static_cast<size_type>((std::numeric_limits<std::uint32_t>::max)() - 1));
+    }
+
+    void reserve (size_type n) { _members.reserve(n); }
+
+    void clear () noexcept
+    {
+        _members.clear();
+        _index.clear();
+    }
+
+    iterator find (key_type const & key)
+    {
+        return _members.begin() + position_of(key);
+    }
+
+    const_iterator find (key_type const & key) const
+    {
+        return _members.begin() + position_of(key);
+    }
+
+    size_type count (key_type const & key) const
+    {
+        return position_of(key) != _members.size() ? 1 : 0;
+    }
+
+    mapped_type & operator [] (key_type const & key)
+    {
+        auto pos = position_of(key);
+
+        if (pos != _members.size())
+            return _members[pos].second;
+
+        _members.emplace_back(key, mapped_type{});
+        return appended()->second;
+    }
+
+    mapped_type & operator [] (key_type && key)
+    {
+        auto pos = position_of(key);
+
+        if (pos != _members.size())
+            return _members[pos].second;
+
+        _members.emplace_back(std::move(key), mapped_type{});
+        return appended()->second;
+    }
+
+    template <typename ...Args>
+    std::pair<iterator, bool> emplace (Args &&... args)
+    {
+        value_type m(std::forward<Args>(args)...);
+        auto pos = position_of(m.first);
+
+        if (pos != _members.size())
+            return std::make_pair(_members.begin() + pos, false);
+
+        _members.push_back(std::move(m));
+        return std::make_pair(appended(), true);
+    }
+
+    friend bool operator == (basic_ordered_object const & lhs, basic_ordered_object const & rhs)
+    {
+        if (lhs.size() != rhs.size())
+            return false;
+
+        for (auto const & m: lhs._members) {
+            auto pos = rhs.position_of(m.first);
+
+            if (pos == rhs.size() || !(rhs._members[pos].second == m.second))
+                return false;
+        }
+
+        return true;
+    }
+
+    friend bool operator != (basic_ordered_object const & lhs, basic_ordered_object const & rhs)
+    {
+        return !(lhs == rhs);
+    }
+};
+
+template <typename KeyType, typename ValueType, std::size_t Threshold>
+constexpr std::size_t basic_ordered_object<KeyType, ValueType, Threshold>::index_threshold;
+
+template <typename KeyType, typename ValueType>
+using ordered_object = basic_ordered_object<KeyType, ValueType, 16>;
+
+////////////////////////////////////////////////////////////////////////////////
+// hashed_object: open addressing hash table of members
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * Members are stored in the slots of an open addressing hash table with
+ * linear probing. Each slot has a control byte: zero for a free slot, or
+ * the high bit with the 7 upper bits of the key hash, so most mismatching
+ * keys are rejected without comparing them. The table grows twice when
+ * the load factor exceeds 3/4. Iteration is in slot order (unspecified).
+ */
+template <typename KeyType, typename ValueType>
+class hashed_object
+{
+public:
+    using key_type    = KeyType;
+    using mapped_type = ValueType;
+    using value_type  = std::pair<KeyType, ValueType>;
+    using size_type   = std::size_t;
+
+    template <typename Member>
+    class slot_iterator
+    {
+        friend class hashed_object;
+        template <typename> friend class slot_iterator;
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type        = typename std::remove_const<Member>::type;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = Member *;
+        using reference         = Member &;
+
+    private:
+        Member * _slots {nullptr};
+        std::uint8_t const * _ctrl {nullptr};
+        size_type _index {0};
+        size_type _capacity {0};
+
+    private:
+        slot_iterator (Member * slots, std::uint8_t const * ctrl
+                , size_type index, size_type capacity) noexcept
+            : _slots(slots)
+            , _ctrl(ctrl)
+            , _index(index)
+            , _capacity(capacity)
+        {
+            while (_index < _capacity && _ctrl[_index] == 0)
+                ++_index;
+        }
+
+    public:
+        slot_iterator () = default;
+
+        // Conversion to the constant iterator
+        template <typename M, typename = typename std::enable_if<
+            std::is_same<M const, Member>::value && !std::is_same<M, Member>::value>::type>
+        slot_iterator (slot_iterator<M> const & other) noexcept
+            : _slots(other._slots)
+            , _ctrl(other._ctrl)
+            , _index(other._index)
+            , _capacity(other._capacity)
+        {}
+
+        reference operator * () const noexcept { return _slots[_index]; }
+        pointer operator -> () const noexcept { return _slots + _index; }
+
+        slot_iterator & operator ++ () noexcept
+        {
+            do {
+                ++_index;
+            } while (_index < _capacity && _ctrl[_index] == 0);
+
+            return *this;
+        }
+
+        slot_iterator & operator -- () noexcept
+        {
+            do {
+                --_index;
+            } while (_ctrl[_index] == 0);
+
+            return *this;
+        }
+
+        slot_iterator operator ++ (int) noexcept
+        {
+            auto result = *this;
+            ++*this;
+            return result;
+        }
+
+        slot_iterator operator -- (int) noexcept
+        {
+            auto result = *this;
+            --*this;
+            return result;
+        }
+
+        friend bool operator == (slot_iterator const & lhs, slot_iterator const & rhs) noexcept
+        {
+            return lhs._index == rhs._index && lhs._slots == rhs._slots;
+        }
+
+        friend bool operator != (slot_iterator const & lhs, slot_iterator const & rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+    };
+
+    using iterator       = slot_iterator<value_type>;
+    using const_iterator = slot_iterator<value_type const>;
+
+private:
+    static constexpr size_type min_capacity = 8;
+
+    value_type * _slots {nullptr};
+    std::uint8_t * _ctrl {nullptr};
+    size_type _capacity {0}; // Zero or power of two
+    size_type _size {0};
+
+private:
+    static std::size_t hash_of (key_type const & key)
+    {
+        return std::hash<key_type>{}(key);
+    }
+
+    static std::uint8_t tag_of (std::size_t h) noexcept
+    {
+        return static_cast<std::uint8_t>(0x80 | (h >> (sizeof(std::size_t) * 8 - 7)));
+    }
+
+    // Returns capacity if there is no member with the key
+    size_type slot_of (key_type const & key, std::size_t h) const
+    {
+        if (_size == 0)
+            return _capacity;
+
+        auto mask = _capacity - 1;
+        auto tag = tag_of(h);
+
+        for (auto i = h & mask;; i = (i + 1) & mask) {
+            if (_ctrl[i] == 0)
+                return _capacity;
+
+            if (_ctrl[i] == tag && _slots[i].first == key)
+                return i;
+        }
+    }
+
+    // Returns free slot for the key hash, the table must not be full
+    size_type free_slot (std::size_t h) const noexcept
+    {
+        auto mask = _capacity - 1;
+        auto i = h & mask;
+
+        while (_ctrl[i] != 0)
+            i = (i + 1) & mask;
+
+        return i;
+    }
+
+    void destroy () noexcept
+    {
+        for (size_type i = 0; i < _capacity; i++) {
+            if (_ctrl[i] != 0)
+                _slots[i].~value_type();
+        }
+    }
+
+    void allocate (size_type capacity)
+    {
+        _slots = static_cast<value_type *>(::operator new(capacity * sizeof(value_type)));
+
+        try {
+            _ctrl = new std::uint8_t[capacity];
+        } catch (...) {
+            ::operator delete(_slots);
+            _slots = nullptr;
+            throw;
+        }
+
+        std::memset(_ctrl, 0, capacity);
+        _capacity = capacity;
+    }
+
+    void deallocate () noexcept
+    {
+        ::operator delete(_slots);
+        delete [] _ctrl;
+        _slots = nullptr;
+        _ctrl = nullptr;
+        _capacity = 0;
+    }
+
+    void rehash (size_type capacity)
+    {
+        auto slots = _slots;
+        auto ctrl = _ctrl;
+        auto old_capacity = _capacity;
+
+        allocate(capacity);
+
+        for (size_type i = 0; i < old_capacity; i++) {
+            if (ctrl[i] != 0) {
+                auto h = hash_of(slots[i].first);
+                auto j = free_slot(h);
+                new (_slots + j) value_type(std::move(slots[i]));
+                _ctrl[j] = ctrl[i];
+                slots[i].~value_type();
+            }
+        }
+
+        ::operator delete(slots);
+        delete [] ctrl;
+    }
+
+    template <typename ...Args>
+    size_type insert_new (std::size_t h, Args &&... args)
+    {
+        if (4 * (_size + 1) > 3 * _capacity)
+            rehash(_capacity == 0 ? min_capacity : 2 * _capacity);
+
+        auto i = free_slot(h);
+        new (_slots + i) value_type(std::forward<Args>(args)...);
+        _ctrl[i] = tag_of(h);
+        ++_size;
+        return i;
+    }
+
+    iterator iterator_at (size_type i) noexcept
+    {
+        return iterator{_slots, _ctrl, i, _capacity};
+    }
+
+    const_iterator iterator_at (size_type i) const noexcept
+    {
+        return const_iterator{_slots, _ctrl, i, _capacity};
+    }
+
+public:
+    hashed_object () = default;
+
+    hashed_object (hashed_object const & other)
+        : hashed_object()
+    {
+        if (other._size == 0)
+            return;
+
+        allocate(other._capacity);
+
+        // Members are copied to the same slots. Control byte is set after
+        // the member is constructed, so the destructor releases constructed
+        // members only if copying throws.
+        for (size_type i = 0; i < _capacity; i++) {
+            if (other._ctrl[i] != 0) {
+                new (_slots + i) value_type(other._slots[i]);
+                _ctrl[i] = other._ctrl[i];
+                ++_size;
+            }
+        }
+    }
+
+    hashed_object (hashed_object && other) noexcept
+    {
+        swap(other);
+    }
+
+    ~hashed_object ()
+    {
+        if (_capacity != 0) {
+            destroy();
+            deallocate();
+        }
+    }
+
+    hashed_object & operator = (hashed_object other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    void swap (hashed_object & other) noexcept
+    {
+        std::swap(_slots, other._slots);
+        std::swap(_ctrl, other._ctrl);
+        std::swap(_capacity, other._capacity);
+        std::swap(_size, other._size);
+    }
+
+    iterator begin () noexcept { return iterator_at(0); }
+    iterator end () noexcept { return iterator_at(_capacity); }
+    const_iterator begin () const noexcept { return iterator_at(0); }
+    const_iterator end () const noexcept { return iterator_at(_capacity); }
+
+    size_type size () const noexcept { return _size; }
+    bool empty () const noexcept { return _size == 0; }
+
+    size_type max_size () const noexcept
+    {
+        return (std::numeric_limits<size_type>::max)() / 2 / sizeof(value_type);
+    }
+
+    void reserve (size_type n)
+    {
+        size_type capacity = _capacity == 0 ? min_capacity : _capacity;
+
+        while (4 * n > 3 * capacity)
+            capacity <<= 1;
+
+        if (capacity != _capacity)
+            rehash(capacity);
+    }
+
+    void clear () noexcept
+    {
+        if (_capacity != 0) {
+            destroy();
+            std::memset(_ctrl, 0, _capacity);
+            _size = 0;
+        }
+    }
+
+    iterator find (key_type const & key)
+    {
+        return iterator_at(slot_of(key, hash_of(key)));
+    }
+
+    const_iterator find (key_type const & key) const
+    {
+        return iterator_at(slot_of(key, hash_of(key)));
+    }
+
+    size_type count (key_type const & key) const
+    {
+        return slot_of(key, hash_of(key)) != _capacity ? 1 : 0;
+    }
+
+    mapped_type & operator [] (key_type const & key)
+    {
+        auto h = hash_of(key);
+        auto i = slot_of(key, h);
+
+        if (i == _capacity)
+            i = insert_new(h, key, mapped_type{});
+
+        return _slots[i].second;
+    }
+
+    mapped_type & operator [] (key_type && key)
+    {
+        auto h = hash_of(key);
+        auto i = slot_of(key, h);
+
+        if (i == _capacity)
+            i = insert_new(h, std::move(key), mapped_type{});
+
+        return _slots[i].second;
+    }
+
+    template <typename ...Args>
+    std::pair<iterator, bool> emplace (Args &&... args)
+    {
+        value_type m(std::forward<Args>(args)...);
+        auto h = hash_of(m.first);
+        auto i = slot_of(m.first, h);
+
+        if (i != _capacity)
+            return std::make_pair(iterator_at(i), false);
+
+        i = insert_new(h, std::move(m));
+        return std::make_pair(iterator_at(i), true);
+    }
+
+    friend bool operator == (hashed_object const & lhs, hashed_object const & rhs)
+    {
+        if (lhs._size != rhs._size)
+            return false;
+
+        for (auto const & m: lhs) {
+            auto i = rhs.slot_of(m.first, hash_of(m.first));
+
+            if (i == rhs._capacity || !(rhs._slots[i].second == m.second))
+                return false;
+        }
+
+        return true;
+    }
+
+    friend bool operator != (hashed_object const & lhs, hashed_object const & rhs)
+    {
+        return !(lhs == rhs);
+    }
+};
+
+template <typename KeyType, typename ValueType>
+constexpr typename hashed_object<KeyType, ValueType>::size_type
+hashed_object<KeyType, ValueType>::min_capacity;
+
+}} // namespace jeyson::v1
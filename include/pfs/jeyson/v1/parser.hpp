@@ -6,20 +6,30 @@
 // Changelog:
 //      2019.10.05 Initial version (pfs-json).
 //      2022.02.07 Initial version (jeyson-lib).
+//      2026.10.15 Callbacks are passed by reference (static dispatch).
+//                 Allocation-free number parsing.
+//                 Non-recursive parsing with nesting depth limit.
+//                 Fast path for contiguous input.
+//                 Strings can be delivered as views.
 ////////////////////////////////////////////////////////////////////////////////
 #pragma once
 #include "json.hpp"
+#include "../number.hpp"
+#include "pfs/string_view.hpp"
 #include <algorithm>
 #include <bitset>
 #include <functional>
 #include <iterator>
+#include <limits>
 #include <memory>
 #include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 #include <cassert>
-#include <clocale>
-#include <cstdlib>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 
 namespace jeyson {
 namespace v1 {
@@ -218,9 +228,52 @@ enum parse_policy_flag {
 
 using parse_policy_set = std::bitset<parse_policy_count>;
 
+/**
+ * Parser limits (in addition to the policy).
+ */
+struct parse_options
+{
+    // Maximum nesting depth of arrays and objects
+    std::size_t max_depth {2048};
+
+    // Number of nesting levels to allocate in advance
+    std::size_t stack_reserve {0};
+};
+
 ////////////////////////////////////////////////////////////////////////////////
 // basic_callbacks
 ////////////////////////////////////////////////////////////////////////////////
+/**
+ * Parser handler requirements (@c CallbacksType in the parser functions):
+ *
+ *      using number_type = <number type>
+ *      using string_type = <string type>
+ *
+ *      on_error (std::error_code const &)
+ *      on_null ()
+ *      on_true ()
+ *      on_false ()
+ *      on_number (number_type &&)
+ *      on_string (string_type &&)
+ *      on_member_name (string_type &&)
+ *      on_begin_array ()
+ *      on_end_array ()
+ *      on_begin_object ()
+ *      on_end_object ()
+ *
+ * Handler is passed by reference through the whole parsing and never copied,
+ * so calls are dispatched statically for handlers with member functions.
+ *
+ * Strings are delivered decoded into a new @c string_type object ("owned"
+ * delivery). Handler opts into "view" delivery by declaring @c string_type
+ * as @c pfs::string_view: strings without escapes refer to the contiguous
+ * input (see `is_contiguous_char_iterator`), other strings are decoded into
+ * the scratch buffer reused by the parser. The view is valid only during the
+ * callback.
+ *
+ * @c basic_callbacks is a type-erased handler: each callback is
+ * a @c std::function that can be replaced separately.
+ */
 template <typename StringType, typename NumberType>
 struct basic_callbacks
 {
@@ -351,65 +404,6 @@ inline parse_policy_set default_policy ()
     return relaxed_policy();
 }
 
-////////////////////////////////////////////////////////////////////////////////
-// locale_decimal_point
-////////////////////////////////////////////////////////////////////////////////
-/**
- * Get locale-specific decimal point character.
- */
-inline char locale_decimal_point ()
-{
-    std::lconv const * loc = std::localeconv();
-    assert(loc);
-    return (loc->decimal_point && *loc->decimal_point != '\x0')
-            ? *loc->decimal_point : '.';
-}
-
-////////////////////////////////////////////////////////////////////////////////
-// Convert string to number functions
-////////////////////////////////////////////////////////////////////////////////
-inline bool strtointeger (long int & n, std::string const & numstr)
-{
-    char * endptr = nullptr;
-    n = std::strtol(numstr.c_str(), & endptr, 10);
-    return (errno != ERANGE && endptr == & *numstr.end());
-}
-
-inline bool strtointeger (long long int & n, std::string const & numstr)
-{
-    char * endptr = nullptr;
-    n = std::strtoll(numstr.c_str(), & endptr, 10);
-    return (errno != ERANGE && endptr == & *numstr.end());
-}
-
-inline bool strtouinteger (unsigned long int & n, std::string const & numstr)
-{
-    char * endptr = nullptr;
-    n = std::strtoul(numstr.c_str(), & endptr, 10);
-    return (errno != ERANGE && endptr == & *numstr.end());
-}
-
-inline bool strtouinteger (unsigned long long int & n, std::string const & numstr)
-{
-    char * endptr = nullptr;
-    n = std::strtoull(numstr.c_str(), & endptr, 10);
-    return (errno != ERANGE && endptr == & *numstr.end());
-}
-
-inline bool strtoreal (float & n, std::string const & numstr)
-{
-    char * endptr = nullptr;
-    n = std::strtof(numstr.c_str(), & endptr);
-    return (errno != ERANGE && endptr == & *numstr.end());
-}
-
-inline bool strtoreal (double & n, std::string const & numstr)
-{
-    char * endptr = nullptr;
-    n = std::strtod(numstr.c_str(), & endptr);
-    return (errno != ERANGE && endptr == & *numstr.end());
-}
-
 ////////////////////////////////////////////////////////////////////////////////
 // compare_and_assign
 ////////////////////////////////////////////////////////////////////////////////
@@ -560,6 +554,102 @@ bool advance_whitespaces (ForwardIterator & pos, ForwardIterator last)
     return compare_and_assign(pos, p);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// Contiguous input
+////////////////////////////////////////////////////////////////////////////////
+// Overloads for `char const *` scan the input by machine words. Contiguous
+// iterators (see `is_contiguous_char_iterator`) are converted to pointers by
+// `parse()`. The input is read only inside [pos, last), no padding is needed.
+
+template <typename Iterator>
+struct is_contiguous_char_iterator : std::integral_constant<bool,
+       std::is_same<Iterator, char const *>::value
+    || std::is_same<Iterator, char *>::value
+    || std::is_same<Iterator, std::string::iterator>::value
+    || std::is_same<Iterator, std::string::const_iterator>::value
+    || std::is_same<Iterator, std::vector<char>::iterator>::value
+    || std::is_same<Iterator, std::vector<char>::const_iterator>::value>
+{};
+
+namespace details {
+
+constexpr std::uint64_t word_ones = 0x0101010101010101;
+constexpr std::uint64_t word_highs = 0x8080808080808080;
+
+inline std::uint64_t load_word (char const * p) noexcept
+{
+    std::uint64_t w = 0;
+    std::memcpy(& w, p, sizeof(w));
+    return w;
+}
+
+// Non-zero if any byte of @a w equals to @a ch
+inline std::uint64_t has_byte (std::uint64_t w, char ch) noexcept
+{
+    auto x = w ^ (word_ones * static_cast<unsigned char>(ch));
+    return (x - word_ones) & ~x & word_highs;
+}
+
+// Returns position of the first @a quotation_mark or backslash in [p, last)
+inline char const * find_string_special (char const * p, char const * last
+    , char quotation_mark) noexcept
+{
+    while (last - p >= 8) {
+        auto w = load_word(p);
+
+        if (has_byte(w, quotation_mark) | has_byte(w, '\\'))
+            break;
+
+        p += 8;
+    }
+
+    while (p != last && *p != quotation_mark && *p != '\\')
+        ++p;
+
+    return p;
+}
+
+template <typename Container>
+struct back_insert_access : std::back_insert_iterator<Container>
+{
+    static Container & container_of (std::back_insert_iterator<Container> & it)
+    {
+        return *(it.*(& back_insert_access::container));
+    }
+};
+
+template <typename OutputIterator>
+inline OutputIterator append_run (OutputIterator output, char const * first, char const * last)
+{
+    return std::copy(first, last, output);
+}
+
+template <typename CharTraits, typename Allocator>
+inline std::back_insert_iterator<std::basic_string<char, CharTraits, Allocator>>
+append_run (std::back_insert_iterator<std::basic_string<char, CharTraits, Allocator>> output
+    , char const * first, char const * last)
+{
+    using string_type = std::basic_string<char, CharTraits, Allocator>;
+    back_insert_access<string_type>::container_of(output).append(first, last);
+    return output;
+}
+
+} // namespace details
+
+inline bool advance_whitespaces (char const *& pos, char const * last)
+{
+    auto p = pos;
+
+    // Indentation runs
+    while (last - p >= 8 && details::load_word(p) == details::word_ones * ' ')
+        p += 8;
+
+    while (p != last && is_whitespace(*p))
+        ++p;
+
+    return compare_and_assign(pos, p);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // advance_sequence
 // Based on pfs/algo/advance.hpp:advance_sequence
@@ -577,8 +667,11 @@ inline bool advance_sequence (ForwardIterator1 & pos, ForwardIterator1 last
 {
     auto p = pos;
 
-    while (p != last && first2 != last2 && *p++ == *first2++)
-        ;
+    // Iterators are advanced by matched characters only
+    while (p != last && first2 != last2 && *p == *first2) {
+        ++p;
+        ++first2;
+    }
 
     if (first2 == last2) {
         pos = p;
@@ -607,6 +700,15 @@ inline bool advance_null (ForwardIterator & pos, ForwardIterator last)
     return advance_sequence(pos, last, s.begin(), s.end());
 }
 
+inline bool advance_null (char const *& pos, char const * last)
+{
+    if (last - pos < 4 || std::memcmp(pos, "null", 4) != 0)
+        return false;
+
+    pos += 4;
+    return true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // advance_true
 ////////////////////////////////////////////////////////////////////////////////
@@ -626,6 +728,15 @@ inline bool advance_true (ForwardIterator & pos, ForwardIterator last)
     return advance_sequence(pos, last, s.begin(), s.end());
 }
 
+inline bool advance_true (char const *& pos, char const * last)
+{
+    if (last - pos < 4 || std::memcmp(pos, "true", 4) != 0)
+        return false;
+
+    pos += 4;
+    return true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // advance_false
 ////////////////////////////////////////////////////////////////////////////////
@@ -645,6 +756,15 @@ inline bool advance_false (ForwardIterator & pos, ForwardIterator last)
     return advance_sequence(pos, last, s.begin(), s.end());
 }
 
+inline bool advance_false (char const *& pos, char const * last)
+{
+    if (last - pos < 5 || std::memcmp(pos, "false", 5) != 0)
+        return false;
+
+    pos += 5;
+    return true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // advance_encoded_char
 ////////////////////////////////////////////////////////////////////////////////
@@ -740,7 +860,7 @@ inline bool advance_string (ForwardIterator & pos, ForwardIterator last
 
 //     auto output = std::back_inserter(result);
 
-    while (p != last && *p != quotation_mark) {
+    while (p != last && (escaped || *p != quotation_mark)) {
         if (encoded) {
             int32_t encoded_char = 0;
 
@@ -814,6 +934,106 @@ inline bool advance_string (ForwardIterator & pos, ForwardIterator last
     return compare_and_assign(pos, p);
 }
 
+/**
+ * Advance by string in contiguous input: runs of characters without escapes
+ * are found by machine words and copied at once.
+ */
+template <typename OutputIterator>
+inline bool advance_string (char const *& pos, char const * last
+    , parse_policy_set const & parse_policy
+    , OutputIterator output
+    , std::error_code & ec)
+{
+    auto p = pos;
+
+    if (p == last)
+        return false;
+
+    if (!is_quotation_mark(*p, parse_policy))
+        return false;
+
+    auto quotation_mark = *p;
+
+    ++p;
+
+    for (;;) {
+        auto run_end = details::find_string_special(p, last, quotation_mark);
+        output = details::append_run(output, p, run_end);
+        p = run_end;
+
+        // ERROR: unquoted string
+        if (p == last) {
+            ec = make_error_code(errc::unbalanced_quote);
+            return false;
+        }
+
+        if (*p == quotation_mark)
+            break;
+
+        // Escape character
+        ++p;
+
+        if (p == last) {
+            ec = make_error_code(errc::unbalanced_quote);
+            return false;
+        }
+
+        auto escaped_char = *p;
+
+        switch (escaped_char) {
+            case '"':
+            case '\\':
+            case '/': break;
+
+            case '\'':
+                if (quotation_mark != '\'') {
+                    ec = make_error_code(errc::bad_escaped_char);
+                    return false;
+                }
+                break;
+
+            case 'b': escaped_char = '\b'; break;
+            case 'f': escaped_char = '\f'; break;
+            case 'n': escaped_char = '\n'; break;
+            case 'r': escaped_char = '\r'; break;
+            case 't': escaped_char = '\t'; break;
+
+            case 'u': {
+                ++p;
+
+                if (p == last) {
+                    ec = make_error_code(errc::unbalanced_quote);
+                    return false;
+                }
+
+                int32_t encoded_char = 0;
+
+                if (!advance_encoded_char(p, last, encoded_char)) {
+                    ec = make_error_code(errc::bad_encoded_char);
+                    return false;
+                }
+
+                *output++ = char(encoded_char);
+                continue;
+            }
+
+            default:
+                if (!parse_policy.test(allow_any_char_escaped)) {
+                    ec = make_error_code(errc::bad_escaped_char);
+                    return false;
+                }
+        }
+
+        *output++ = escaped_char;
+        ++p;
+    }
+
+    // Skip quotation mark
+    ++p;
+
+    return compare_and_assign(pos, p);
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 // advance_number
@@ -848,161 +1068,40 @@ bool advance_number (ForwardIterator & pos, ForwardIterator last
     , std::error_code & /*ec*/)
 {
     auto p = pos;
-    std::string numstr;
-    int sign = 1;
-    bool is_integer = true;
-
-    ////////////////////////////////////////////////////////////////////////////
-    // Advance sign
-    ////////////////////////////////////////////////////////////////////////////
-    if (p != last) {
-        if (*p == '-') {
-            sign = -1;
-            numstr.push_back('-');
-            ++p;
-        } else if (*p == '+') {
-            if (parse_policy.test(allow_positive_signed_number)) {
-                ++p;
-            } else {
-                return false;
-            }
-        }
-    }
-
-    auto last_pos = p;
-
-    ////////////////////////////////////////////////////////////////////////////
-    // Advance integral part
-    //
-    // Mandatory
-    // int = zero / ( digit1-9 *DIGIT )
-    ////////////////////////////////////////////////////////////////////////////
-    if (p != last) {
-        if (*p == '0') {
-            numstr.push_back('0');
-            ++p;
-        } else {
-            while (p != last && is_digit(*p)) {
-                numstr.push_back(*p);
-                ++p;
-            }
-        }
-    }
+    number::decimal d;
 
-    // No digit found
-    if (p == last_pos)
+    if (!number::scan(p, last, d, parse_policy.test(allow_positive_signed_number)))
         return false;
 
-    last_pos = p;
-
-    ////////////////////////////////////////////////////////////////////////////
-    // Fractional part
-    //
-    // Optional
-    // frac = decimal-point 1*DIGIT
-    ////////////////////////////////////////////////////////////////////////////
-    if (p != last) {
-        if (*p == '.') {
-            is_integer = false;
-            numstr.push_back(locale_decimal_point());
-
-            ++p;
-
-            if (p == last)
-                return false;
-
-            if (!is_digit(*p))
-                return false;
-
-            numstr.push_back(*p);
-            ++p;
-
-            while (p != last && is_digit(*p)) {
-                numstr.push_back(*p);
-                ++p;
-            }
+    if (d.is_integer && !d.integer_overflow) {
+        if (!d.negative) {
+            *pnum = static_cast<uintmax_t>(d.integer);
+            return compare_and_assign(pos, p);
         }
-    }
-
-    last_pos = p;
-
-    ////////////////////////////////////////////////////////////////////////////
-    // Exponential part
-    //
-    // Optional
-    // exp = e [ minus / plus ] 1*DIGIT
-    ////////////////////////////////////////////////////////////////////////////
-    if (p != last) {
-        if (*p == 'e' || *p == 'E') {
-            is_integer = false;
-            numstr.push_back('e');
-            ++p;
-
-            if (p != last) {
-                if (*p == '-') {
-                    numstr.push_back('-');
-                    ++p;
-                } else if (*p == '+') {
-                    ++p;
-                }
-            }
-
-            if (p == last)
-                return false;
-
-            if (!is_digit(*p))
-                return false;
 
-            numstr.push_back(*p);
-            ++p;
+        auto max_abs = static_cast<uintmax_t>((std::numeric_limits<intmax_t>::max)());
 
-            while (p != last && is_digit(*p)) {
-                numstr.push_back(*p);
-                ++p;
-            }
+        if (d.integer <= max_abs + 1) {
+            *pnum = static_cast<intmax_t>(~d.integer + 1);
+            return compare_and_assign(pos, p);
         }
     }
 
-    bool integer_accepted = false;
-
-    if (is_integer) {
-        if (sign > 0) {
-            uintmax_t n = 0;
+    // Too big integer is stored as floating point
+    double n = 0;
+    auto rc = number::to_double(d, n);
 
-            if (strtouinteger(n, numstr)) {
-                *pnum = n;
-                integer_accepted = true;
-            }
-        } else {
-            intmax_t n = 0;
-
-            if (strtointeger(n, numstr)) {
-                *pnum = n;
-                integer_accepted = true;
-            }
-        }
-    }
+    if (rc == number::conversion::inexact)
+        rc = number::strtod(pos, p, n);
 
-    if (!integer_accepted) {
-        double n = 0;
-        if (!strtoreal(n, numstr)) {
-            return false;
-        }
+    if (rc != number::conversion::success)
+        return false;
 
-        *pnum = n;
-    }
+    *pnum = n;
 
     return compare_and_assign(pos, p);
 }
 
-////////////////////////////////////////////////////////////////////////////////
-// Forward declaration for advance_value
-////////////////////////////////////////////////////////////////////////////////
-template <typename ForwardIterator, typename CallbacksType>
-bool advance_value (ForwardIterator & pos, ForwardIterator last
-    , parse_policy_set const & parse_policy
-    , CallbacksType callbacks);
-
 ////////////////////////////////////////////////////////////////////////////////
 // advance_value_separator
 ////////////////////////////////////////////////////////////////////////////////
@@ -1077,194 +1176,182 @@ inline bool advance_value_separator (ForwardIterator & pos, ForwardIterator last
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-// advance_array
+// parse_stack
 ////////////////////////////////////////////////////////////////////////////////
 /**
- *
- * @note Grammar:
- * array = begin-array [ value *( value-separator value ) ] end-array
- * begin-array     = ws %x5B ws  ; [ left square bracket
- * end-array       = ws %x5D ws  ; ] right square bracket
- * value-separator = ws %x2C ws  ; , comma
- * value = false / null / true / object / array / number / string
+ * Explicit stack of the open arrays and objects used by the parser instead
+ * of recursion. First @c inline_capacity levels need no allocation.
  */
-template <typename ForwardIterator, typename CallbacksType>
-bool advance_array (ForwardIterator & pos, ForwardIterator last
-    , parse_policy_set const & parse_policy
-    , CallbacksType callbacks)
+class parse_stack
 {
-    auto p = pos;
+public:
+    enum class frame : char { array, object };
 
-    if (!advance_begin_array(p, last))
-        return false;
+    static constexpr std::size_t inline_capacity = 64;
 
-    callbacks.on_begin_array();
+private:
+    frame _inline[inline_capacity];
+    std::vector<frame> _heap; // Levels above inline capacity
+    std::size_t _size {0};
 
-    // Check empty array
-    if (advance_end_array(p, last)) {
-        callbacks.on_end_array();
-    } else {
-        do {
-            if (!advance_value(p, last, parse_policy, callbacks))
-                return false;
-        } while(advance_value_separator(p, last));
+public:
+    void reserve (std::size_t n)
+    {
+        if (n > inline_capacity)
+            _heap.reserve(n - inline_capacity);
+    }
 
-        if (!advance_end_array(p, last)) {
-            callbacks.on_error(make_error_code(errc::unbalanced_array_bracket));
-            return false;
-        }
+    std::size_t size () const noexcept
+    {
+        return _size;
+    }
 
-        callbacks.on_end_array();
+    bool empty () const noexcept
+    {
+        return _size == 0;
     }
 
-    return compare_and_assign(pos, p);
-}
+    frame top () const noexcept
+    {
+        return _size > inline_capacity ? _heap.back() : _inline[_size - 1];
+    }
+
+    void push (frame f)
+    {
+        if (_size < inline_capacity)
+            _inline[_size] = f;
+        else
+            _heap.push_back(f);
+
+        ++_size;
+    }
+
+    void pop () noexcept
+    {
+        if (_size > inline_capacity)
+            _heap.pop_back();
+
+        --_size;
+    }
+};
 
 ////////////////////////////////////////////////////////////////////////////////
-// advance_member
+// read_string
 ////////////////////////////////////////////////////////////////////////////////
-// Note: std::size() available since C++17
-template <typename C>
-inline auto size (C const & c) -> decltype(c.size())
-{
-    return c.size();
-}
+template <typename StringType>
+struct is_string_view : std::is_same<StringType, pfs::string_view> {};
 
 /**
- * @note Grammar:
- * member = string name-separator value
- * name-separator  = ws %x3A ws  ; : colon
- * value = false / null / true / object / array / number / string
+ * Reads string into @a result according to the delivery mode of the handler
+ * string type (see @c basic_callbacks). Owned strings are decoded by
+ * @c advance_string().
  */
-template <typename ForwardIterator, typename CallbacksType>
-bool advance_member (ForwardIterator & pos, ForwardIterator last
+template <typename ForwardIterator, typename StringType>
+inline bool read_string (ForwardIterator & pos, ForwardIterator last
     , parse_policy_set const & parse_policy
-    , CallbacksType callbacks)
+    , StringType & result
+    , std::string & /*scratch*/
+    , std::error_code & ec
+    , std::false_type /*view*/)
 {
-    auto p = pos;
-
-    typename CallbacksType::string_type name;
-    std::error_code ec;
+    return advance_string(pos, last, parse_policy, std::back_inserter(result), ec);
+}
 
-    if (!advance_string(p, last, parse_policy, std::back_inserter(name), ec)) {
-        // Error while parsing value
-        if (ec) {
-            callbacks.on_error(ec);
-            return false;
-        } else {
-            // is not a string
-            callbacks.on_error(make_error_code(errc::bad_member_name));
-        }
-    }
+template <typename ForwardIterator, typename StringType>
+inline bool read_string (ForwardIterator & pos, ForwardIterator last
+    , parse_policy_set const & parse_policy
+    , StringType & result
+    , std::string & scratch
+    , std::error_code & ec
+    , std::true_type /*view*/)
+{
+    scratch.clear();
 
-    // Member name must be non-empty
-    if (size(name) == 0) {
-        callbacks.on_error(make_error_code(errc::bad_member_name));
+    if (!advance_string(pos, last, parse_policy, std::back_inserter(scratch), ec))
         return false;
-    }
 
-    if (!advance_name_separator(p, last))
-        return false;
+    result = StringType{scratch.data(), scratch.size()};
+    return true;
+}
 
-    callbacks.on_member_name(std::move(name));
+template <typename StringType>
+inline bool read_string (char const *& pos, char const * last
+    , parse_policy_set const & parse_policy
+    , StringType & result
+    , std::string & scratch
+    , std::error_code & ec
+    , std::true_type /*view*/)
+{
+    // String without escapes refers to the input
+    if (pos != last && is_quotation_mark(*pos, parse_policy)) {
+        auto first = pos + 1;
+        auto run_end = details::find_string_special(first, last, *pos);
+
+        if (run_end != last && *run_end == *pos) {
+            result = StringType{first, static_cast<std::size_t>(run_end - first)};
+            pos = run_end + 1;
+            return true;
+        }
+    }
 
-    if (!advance_value(p, last, parse_policy, callbacks))
+    scratch.clear();
+
+    if (!advance_string(pos, last, parse_policy, std::back_inserter(scratch), ec))
         return false;
 
-    return compare_and_assign(pos, p);
+    result = StringType{scratch.data(), scratch.size()};
+    return true;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-// advance_object
+// advance_scalar
 ////////////////////////////////////////////////////////////////////////////////
 /**
- * @details ObjectType traits:
- *  - provides @code key_type @endcode typename
- *  - provides @code mapped_type @endcode typename
- *  - provides @code emplace(std::pair<key_type, mapped_type> &&) @endcode method
- *
  * @note Grammar:
- * object = begin-object [ member *( value-separator member ) ] end-object
- * member = string name-separator value
- * begin-object    = ws %x7B ws  ; { left curly bracket
- * end-object      = ws %x7D ws  ; } right curly bracket
- * name-separator  = ws %x3A ws  ; : colon
- * value-separator = ws %x2C ws  ; , comma
- * value = false / null / true / object / array / number / string
+ * value = false / null / true / number / string
+ *
+ * If @a root is @c true, the value is checked against root element policy.
+ * @a scratch is the buffer for strings delivered as views.
  */
 template <typename ForwardIterator, typename CallbacksType>
-bool advance_object (ForwardIterator & pos, ForwardIterator last
-        , parse_policy_set const & parse_policy
-        , CallbacksType callbacks)
-{
-    auto p = pos;
-
-    if (!advance_begin_object(p, last))
-        return false;
-
-    callbacks.on_begin_object();
-
-    // Check empty object
-    if (advance_end_object(p, last)) {
-        callbacks.on_end_object();
-    } else {
-        do {
-            if (!advance_member(p, last, parse_policy, callbacks))
-                return false;
-        } while(advance_value_separator(p, last));
-
-        if (!advance_end_object(p, last)) {
-            callbacks.on_error(make_error_code(errc::unbalanced_object_bracket));
-            return false;
-        }
-
-        callbacks.on_end_object();
-    }
-
-    return compare_and_assign(pos, p);
-}
-
-////////////////////////////////////////////////////////////////////////////////
-// advance_value
-//
-// Specialization: no, for values of any type
-////////////////////////////////////////////////////////////////////////////////
-template <typename ForwardIterator, typename CallbacksType>
-bool advance_value (ForwardIterator & pos, ForwardIterator last
+bool advance_scalar (ForwardIterator & pos, ForwardIterator last
     , parse_policy_set const & parse_policy
-    , CallbacksType callbacks)
+    , bool root
+    , std::string & scratch
+    , CallbacksType & callbacks)
 {
     auto p = pos;
 
-    // Skip head witespaces
-    advance_whitespaces(p, last);
-
-    do {
-        // Array marker
-        if (*p == '[') {
-            if (advance_array(p, last, parse_policy, callbacks)) {
-                break;
-            }
+    auto forbidden = [& parse_policy, & callbacks, root] (parse_policy_flag flag) {
+        if (root && !parse_policy.test(flag)) {
+            callbacks.on_error(make_error_code(errc::forbidden_root_element));
+            return true;
         }
 
-        // Object marker
-        if (*p == '{') {
-            if (advance_object(p, last, parse_policy, callbacks)) {
-                break;
-            }
-        }
+        return false;
+    };
 
+    do {
         if (advance_null(p, last)) {
+            if (forbidden(allow_null_root_element))
+                return false;
+
             callbacks.on_null();
             break;
         }
 
         if (advance_true(p, last)) {
+            if (forbidden(allow_boolean_root_element))
+                return false;
+
             callbacks.on_true();
             break;
         }
 
         if (advance_false(p, last)) {
+            if (forbidden(allow_boolean_root_element))
+                return false;
+
             callbacks.on_false();
             break;
         }
@@ -1273,6 +1360,9 @@ bool advance_value (ForwardIterator & pos, ForwardIterator last
         std::error_code ec;
 
         if (advance_number(p, last, parse_policy, & num, ec)) {
+            if (forbidden(allow_number_root_element))
+                return false;
+
             callbacks.on_number(std::move(num));
             break;
         } else if (ec) {
@@ -1280,9 +1370,13 @@ bool advance_value (ForwardIterator & pos, ForwardIterator last
             return false;
         }
 
-        typename CallbacksType::string_type str;
+        using string_type = typename CallbacksType::string_type;
+        string_type str;
+
+        if (read_string(p, last, parse_policy, str, scratch, ec, is_string_view<string_type>{})) {
+            if (forbidden(allow_string_root_element))
+                return false;
 
-        if (advance_string(p, last, parse_policy, std::back_inserter(str), ec)) {
             callbacks.on_string(std::move(str));
             break;
         } else if (ec) {
@@ -1295,137 +1389,391 @@ bool advance_value (ForwardIterator & pos, ForwardIterator last
         return false;
     } while (false);
 
-    // Skip tail witespaces
-    advance_whitespaces(p, last);
+    return compare_and_assign(pos, p);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// advance_member_name
+////////////////////////////////////////////////////////////////////////////////
+// Note: std::size() available since C++17
+template <typename C>
+inline auto size (C const & c) -> decltype(c.size())
+{
+    return c.size();
+}
+
+/**
+ * @note Grammar:
+ * member-name = string name-separator
+ * name-separator  = ws %x3A ws  ; : colon
+ */
+template <typename ForwardIterator, typename CallbacksType>
+bool advance_member_name (ForwardIterator & pos, ForwardIterator last
+    , parse_policy_set const & parse_policy
+    , std::string & scratch
+    , CallbacksType & callbacks)
+{
+    using string_type = typename CallbacksType::string_type;
+
+    auto p = pos;
+
+    string_type name;
+    std::error_code ec;
+
+    if (!read_string(p, last, parse_policy, name, scratch, ec, is_string_view<string_type>{})) {
+        // Error while parsing value or is not a string
+        callbacks.on_error(ec ? ec : make_error_code(errc::bad_member_name));
+        return false;
+    }
+
+    // Member name must be non-empty
+    if (v1::size(name) == 0) {
+        callbacks.on_error(make_error_code(errc::bad_member_name));
+        return false;
+    }
+
+    if (!advance_name_separator(p, last)) {
+        callbacks.on_error(make_error_code(errc::bad_json_sequence));
+        return false;
+    }
+
+    callbacks.on_member_name(std::move(name));
 
     return compare_and_assign(pos, p);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-// advance_json
+// advance_value
 ////////////////////////////////////////////////////////////////////////////////
+/**
+ * Advances by value of any type.
+ *
+ * Arrays and objects are parsed by the state machine with the explicit
+ * stack (see @c parse_stack), so the C++ stack usage does not depend on the
+ * nesting depth. Nesting deeper than @a options.max_depth is reported as
+ * @c errc::max_depth_exceeded.
+ *
+ * If @a root is @c true, the value is checked against root element policy.
+ *
+ * @note Grammar:
+ * value = false / null / true / object / array / number / string
+ * array = begin-array [ value *( value-separator value ) ] end-array
+ * object = begin-object [ member *( value-separator member ) ] end-object
+ * member = string name-separator value
+ */
 template <typename ForwardIterator, typename CallbacksType>
-bool advance_json (ForwardIterator & pos, ForwardIterator last
+bool advance_value (ForwardIterator & pos, ForwardIterator last
     , parse_policy_set const & parse_policy
-    , CallbacksType callbacks)
+    , parse_options const & options
+    , bool root
+    , CallbacksType & callbacks)
 {
-    // Doublicated advance_value
+    enum class state { value, member, next };
+
+    using frame = parse_stack::frame;
+
+    parse_stack stack;
+    stack.reserve((std::min)(options.stack_reserve, options.max_depth));
+
+    // Buffer for decoded strings delivered as views
+    std::string scratch;
 
     auto p = pos;
+    auto st = state::value;
 
     // Skip head witespaces
     advance_whitespaces(p, last);
 
-    do {
-        // Array marker
-        if (*p == '[') {
-            if (!parse_policy.test(allow_array_root_element)) {
-                callbacks.on_error(make_error_code(errc::forbidden_root_element));
-                return false;
-            }
-
-            if (advance_array(p, last, parse_policy, callbacks))
-                break;
-        } else if (*p == '{') {  // Object marker
-            if (!parse_policy.test(allow_object_root_element)) {
-                callbacks.on_error(make_error_code(errc::forbidden_root_element));
-                return false;
-            }
+    for (;;) {
+        switch (st) {
+            // Value is expected, whitespaces are skipped
+            case state::value: {
+                if (p == last) {
+                    callbacks.on_error(make_error_code(errc::bad_json_sequence));
+                    return false;
+                }
 
-            if (advance_object(p, last, parse_policy, callbacks))
-                break;
-        } else if (advance_null(p, last)) {
-            if (!parse_policy.test(allow_null_root_element)) {
-                callbacks.on_error(make_error_code(errc::forbidden_root_element));
-                return false;
-            }
+                auto is_root = root && stack.empty();
 
-            callbacks.on_null();
-            break;
-        } else if (advance_true(p, last)) {
-            if (!parse_policy.test(allow_boolean_root_element)) {
-                callbacks.on_error(make_error_code(errc::forbidden_root_element));
-                return false;
-            }
+                if (*p == '[' || *p == '{') {
+                    auto is_array = *p == '[';
 
-            callbacks.on_true();
-            break;
-        } else if (advance_false(p, last)) {
-            if (!parse_policy.test(allow_boolean_root_element)) {
-                callbacks.on_error(make_error_code(errc::forbidden_root_element));
-                return false;
-            }
+                    if (is_root && !parse_policy.test(is_array
+                            ? allow_array_root_element : allow_object_root_element)) {
+                        callbacks.on_error(make_error_code(errc::forbidden_root_element));
+                        return false;
+                    }
 
-            callbacks.on_false();
-            break;
-        } else {
-            typename CallbacksType::number_type num;
-            typename CallbacksType::string_type str;
+                    if (stack.size() >= options.max_depth) {
+                        callbacks.on_error(make_error_code(errc::max_depth_exceeded));
+                        return false;
+                    }
 
-            std::error_code ec;
+                    ++p;
+                    advance_whitespaces(p, last);
+
+                    if (is_array) {
+                        callbacks.on_begin_array();
+
+                        // Check empty array
+                        if (advance_end_array(p, last)) {
+                            callbacks.on_end_array();
+                            st = state::next;
+                        } else {
+                            stack.push(frame::array);
+                        }
+                    } else {
+                        callbacks.on_begin_object();
+
+                        // Check empty object
+                        if (advance_end_object(p, last)) {
+                            callbacks.on_end_object();
+                            st = state::next;
+                        } else {
+                            stack.push(frame::object);
+                            st = state::member;
+                        }
+                    }
+                } else {
+                    if (!advance_scalar(p, last, parse_policy, is_root, scratch, callbacks))
+                        return false;
 
-            if (advance_number(p, last, parse_policy, & num, ec)) {
-                if (!parse_policy.test(allow_number_root_element)) {
-                    callbacks.on_error(make_error_code(errc::forbidden_root_element));
-                    return false;
+                    // Skip tail witespaces
+                    advance_whitespaces(p, last);
+                    st = state::next;
                 }
 
-                callbacks.on_number(std::move(num));
                 break;
-            } else if (ec) {
-                callbacks.on_error(ec);
-                return false;
             }
 
-            if (advance_string(p, last, parse_policy, std::back_inserter(str), ec)) {
-                if (!parse_policy.test(allow_string_root_element)) {
-                    callbacks.on_error(make_error_code(errc::forbidden_root_element));
+            // Member name is expected
+            case state::member:
+                if (!advance_member_name(p, last, parse_policy, scratch, callbacks))
                     return false;
+
+                st = state::value;
+                break;
+
+            // Value is complete
+            case state::next:
+                if (stack.empty())
+                    return compare_and_assign(pos, p);
+
+                if (stack.top() == frame::array) {
+                    if (advance_value_separator(p, last)) {
+                        st = state::value;
+                    } else if (advance_end_array(p, last)) {
+                        stack.pop();
+                        callbacks.on_end_array();
+                    } else {
+                        callbacks.on_error(make_error_code(errc::unbalanced_array_bracket));
+                        return false;
+                    }
+                } else {
+                    if (advance_value_separator(p, last)) {
+                        st = state::member;
+                    } else if (advance_end_object(p, last)) {
+                        stack.pop();
+                        callbacks.on_end_object();
+                    } else {
+                        callbacks.on_error(make_error_code(errc::unbalanced_object_bracket));
+                        return false;
+                    }
                 }
 
-                callbacks.on_string(std::move(str));
                 break;
-            } else if (ec) {
-                callbacks.on_error(ec);
-                return false;
-            }
         }
+    }
+}
 
-        // Not JSON sequence
-        callbacks.on_error(make_error_code(errc::bad_json_sequence));
-        return false;
-    } while (false);
+template <typename ForwardIterator, typename CallbacksType>
+inline bool advance_value (ForwardIterator & pos, ForwardIterator last
+    , parse_policy_set const & parse_policy
+    , CallbacksType & callbacks)
+{
+    return advance_value(pos, last, parse_policy, parse_options{}, false, callbacks);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// advance_array
+////////////////////////////////////////////////////////////////////////////////
+/**
+ *
+ * @note Grammar:
+ * array = begin-array [ value *( value-separator value ) ] end-array
+ * begin-array     = ws %x5B ws  ; [ left square bracket
+ * end-array       = ws %x5D ws  ; ] right square bracket
+ * value-separator = ws %x2C ws  ; , comma
+ * value = false / null / true / object / array / number / string
+ */
+template <typename ForwardIterator, typename CallbacksType>
+bool advance_array (ForwardIterator & pos, ForwardIterator last
+    , parse_policy_set const & parse_policy
+    , CallbacksType & callbacks)
+{
+    auto p = pos;
 
-    // Skip tail witespaces
     advance_whitespaces(p, last);
 
+    if (p == last || *p != '[')
+        return false;
+
+    return advance_value(pos, last, parse_policy, callbacks);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// advance_member
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * @note Grammar:
+ * member = string name-separator value
+ * name-separator  = ws %x3A ws  ; : colon
+ * value = false / null / true / object / array / number / string
+ */
+template <typename ForwardIterator, typename CallbacksType>
+bool advance_member (ForwardIterator & pos, ForwardIterator last
+    , parse_policy_set const & parse_policy
+    , CallbacksType & callbacks)
+{
+    auto p = pos;
+    std::string scratch;
+
+    if (!advance_member_name(p, last, parse_policy, scratch, callbacks))
+        return false;
+
+    if (!advance_value(p, last, parse_policy, callbacks))
+        return false;
+
     return compare_and_assign(pos, p);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// advance_object
+////////////////////////////////////////////////////////////////////////////////
+/**
+ * @details ObjectType traits:
+ *  - provides @code key_type @endcode typename
+ *  - provides @code mapped_type @endcode typename
+ *  - provides @code emplace(std::pair<key_type, mapped_type> &&) @endcode method
+ *
+ * @note Grammar:
+ * object = begin-object [ member *( value-separator member ) ] end-object
+ * member = string name-separator value
+ * begin-object    = ws %x7B ws  ; { left curly bracket
+ * end-object      = ws %x7D ws  ; } right curly bracket
+ * name-separator  = ws %x3A ws  ; : colon
+ * value-separator = ws %x2C ws  ; , comma
+ * value = false / null / true / object / array / number / string
+ */
+template <typename ForwardIterator, typename CallbacksType>
+bool advance_object (ForwardIterator & pos, ForwardIterator last
+        , parse_policy_set const & parse_policy
+        , CallbacksType & callbacks)
+{
+    auto p = pos;
+
+    advance_whitespaces(p, last);
+
+    if (p == last || *p != '{')
+        return false;
+
+    return advance_value(pos, last, parse_policy, callbacks);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// advance_json
+////////////////////////////////////////////////////////////////////////////////
+template <typename ForwardIterator, typename CallbacksType>
+inline bool advance_json (ForwardIterator & pos, ForwardIterator last
+    , parse_policy_set const & parse_policy
+    , parse_options const & options
+    , CallbacksType & callbacks)
+{
+    return advance_value(pos, last, parse_policy, options, true, callbacks);
+}
+
+template <typename ForwardIterator, typename CallbacksType>
+inline bool advance_json (ForwardIterator & pos, ForwardIterator last
+    , parse_policy_set const & parse_policy
+    , CallbacksType & callbacks)
+{
+    return advance_json(pos, last, parse_policy, parse_options{}, callbacks);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 //
 ////////////////////////////////////////////////////////////////////////////////
 template <typename ForwardIterator, typename CallbacksType>
-inline ForwardIterator parse (ForwardIterator first
+inline ForwardIterator parse_sequence (ForwardIterator first
     , ForwardIterator last
     , parse_policy_set const & parse_policy
-    , CallbacksType callbacks)
+    , parse_options const & options
+    , CallbacksType & callbacks
+    , std::false_type /*contiguous*/)
 {
     auto pos = first;
 
-    if (advance_json(pos, last, parse_policy, callbacks))
+    if (advance_json(pos, last, parse_policy, options, callbacks))
         return pos;
 
     return first;
 }
 
+template <typename ContiguousIterator, typename CallbacksType>
+inline ContiguousIterator parse_sequence (ContiguousIterator first
+    , ContiguousIterator last
+    , parse_policy_set const & parse_policy
+    , parse_options const & options
+    , CallbacksType & callbacks
+    , std::true_type /*contiguous*/)
+{
+    if (first == last) {
+        return parse_sequence(first, last, parse_policy, options, callbacks
+            , std::false_type{});
+    }
+
+    char const * data = & *first;
+    auto pos = parse_sequence(data, data + (last - first), parse_policy, options
+        , callbacks, std::false_type{});
+
+    return first + (pos - data);
+}
+
+/**
+ * Parses JSON from [@a first, @a last). Contiguous input (pointers,
+ * @c std::string and @c std::vector<char> iterators) is processed by the
+ * fast path.
+ *
+ * @return Position following the parsed value (and whitespaces) or @a first
+ *         on error.
+ */
+template <typename ForwardIterator, typename CallbacksType>
+inline ForwardIterator parse (ForwardIterator first
+    , ForwardIterator last
+    , parse_policy_set const & parse_policy
+    , parse_options const & options
+    , CallbacksType && callbacks)
+{
+    return parse_sequence(first, last, parse_policy, options, callbacks
+        , is_contiguous_char_iterator<ForwardIterator>{});
+}
+
+template <typename ForwardIterator, typename CallbacksType>
+inline ForwardIterator parse (ForwardIterator first
+    , ForwardIterator last
+    , parse_policy_set const & parse_policy
+    , CallbacksType && callbacks)
+{
+    return parse(first, last, parse_policy, parse_options{}, callbacks);
+}
+
 /**
  *
  */
 template <typename ForwardIterator, typename CallbacksType>
 inline ForwardIterator parse (ForwardIterator first
     , ForwardIterator last
-    , CallbacksType callbacks)
+    , CallbacksType && callbacks)
 {
     return parse(first, last, default_policy(), callbacks);
 }
@@ -0,0 +1,157 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `jeyson-lib`.
+//
+// Changelog:
+//      2026.10.16 Initial version.
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "json.hpp"
+
+#if !(__cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L))
+#   error "pmr.hpp requires C++17"
+#endif
+
+#include <functional>
+#include <map>
+#include <memory_resource>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <cstddef>
+
+namespace jeyson {
+namespace v1 {
+namespace pmr {
+
+// Resource of the innermost `resource_scope` of the thread (null outside of
+// scopes)
+inline std::pmr::memory_resource *& scoped_resource () noexcept
+{
+    static thread_local std::pmr::memory_resource * r = nullptr;
+    return r;
+}
+
+/**
+ * Returns the memory resource of the innermost `resource_scope` of the
+ * calling thread or `std::pmr::get_default_resource()` outside of scopes.
+ */
+inline std::pmr::memory_resource * current_resource () noexcept
+{
+    auto r = scoped_resource();
+    return r ? r : std::pmr::get_default_resource();
+}
+
+/**
+ * Makes the memory resource current for the thread while the scope exists:
+ * values, strings and containers created in the scope allocate from it.
+ * Scopes can be nested.
+ */
+class resource_scope
+{
+    std::pmr::memory_resource * _prev {nullptr};
+
+public:
+    explicit resource_scope (std::pmr::memory_resource * r) noexcept
+        : _prev(scoped_resource())
+    {
+        scoped_resource() = r;
+    }
+
+    ~resource_scope ()
+    {
+        scoped_resource() = _prev;
+    }
+
+    resource_scope (resource_scope const &) = delete;
+    resource_scope & operator = (resource_scope const &) = delete;
+};
+
+/**
+ * Allocator bound to the memory resource current for the thread at the
+ * construction of the allocator. Unlike `std::pmr::polymorphic_allocator` it
+ * is default constructed to the resource of the scope, so `value` storages
+ * and nested containers created in the scope use the same resource without
+ * passing it explicitly. Copies of containers allocate from the resource
+ * current at copying, moved containers keep their resource.
+ */
+template <typename T>
+class resource_allocator
+{
+    template <typename> friend class resource_allocator;
+
+    std::pmr::memory_resource * _resource;
+
+public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+public:
+    resource_allocator () noexcept
+        : _resource(current_resource())
+    {}
+
+    explicit resource_allocator (std::pmr::memory_resource * r) noexcept
+        : _resource(r)
+    {}
+
+    template <typename U>
+    resource_allocator (resource_allocator<U> const & other) noexcept
+        : _resource(other._resource)
+    {}
+
+    T * allocate (std::size_t n)
+    {
+        return static_cast<T *>(_resource->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate (T * p, std::size_t n) noexcept
+    {
+        _resource->deallocate(p, n * sizeof(T), alignof(T));
+    }
+
+    resource_allocator select_on_container_copy_construction () const noexcept
+    {
+        return resource_allocator{};
+    }
+
+    std::pmr::memory_resource * resource () const noexcept
+    {
+        return _resource;
+    }
+
+    template <typename U>
+    friend bool operator == (resource_allocator const & lhs, resource_allocator<U> const & rhs) noexcept
+    {
+        return lhs.resource() == rhs.resource() || lhs.resource()->is_equal(*rhs.resource());
+    }
+
+    template <typename U>
+    friend bool operator != (resource_allocator const & lhs, resource_allocator<U> const & rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+};
+
+using string = std::basic_string<char, std::char_traits<char>, resource_allocator<char>>;
+
+template <typename ValueType>
+using array_type = std::vector<ValueType, resource_allocator<ValueType>>;
+
+template <typename KeyType, typename ValueType>
+using object_type = std::map<KeyType, ValueType, std::less<KeyType>
+    , resource_allocator<std::pair<KeyType const, ValueType>>>;
+
+/**
+ * JSON value allocating everything from the current memory resource. A whole
+ * tree built in the scope of a `std::pmr::monotonic_buffer_resource` can be
+ * dropped by `value::discard()` and released with the resource.
+ */
+using value = v1::value<bool, std::intmax_t, std::uintmax_t, double
+    , string, array_type, object_type, resource_allocator<char>>;
+
+}}} // namespace jeyson::v1::pmr
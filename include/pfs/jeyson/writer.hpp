@@ -0,0 +1,247 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `jeyson-lib`.
+//
+// Changelog:
+//      2026.10.15 Initial version.
+//      2026.10.16 Non-finite real numbers are rejected.
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "error.hpp"
+#include "exports.hpp"
+#include "json.hpp"
+#include <pfs/string_view.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace jeyson {
+
+struct json_writer_options
+{
+    // Write in compact representation (no spaces and line breaks)
+    bool compact {true};
+
+    // Number of spaces for indentation (ignored if `compact` is `true`)
+    int indent {4};
+
+    // The precision for real numbers output (`%.<precision>g`), if zero or
+    // negative, real numbers are written in the shortest round-trip form
+    int precision {0};
+};
+
+/**
+ * Streaming (SAX-style) JSON writer.
+ *
+ * Serializes events directly into the output without building the tree.
+ * Output is the same as `to_string()` (compact mode) or `save()` (pretty
+ * mode) produce for the equivalent @c json value. Values are converted by
+ * the same @c encoder<T> specializations as used by `insert()` and
+ * `push_back()`. Keys and strings must be valid UTF-8, keys are not checked
+ * for duplicates.
+ *
+ * Event sequence is checked in debug builds only (mismatched end of
+ * container, key outside of object, value without key, more than one
+ * top-level value).
+ *
+ * Example:
+ * @code
+ * std::string out;
+ * json_writer<> w {out};
+ * w.begin_object()
+ *     .member("id", 42)
+ *     .key("tags").begin_array().value("a").value("b").end_array()
+ *     .end_object();
+ * @endcode
+ */
+template <typename Backend = backend::jansson>
+class json_writer
+{
+public:
+    using value_type = json<Backend>;
+    using sink_type  = std::function<void (char const *, std::size_t)>;
+
+    // Buffered output size that triggers passing it to the sink
+    static constexpr std::size_t sink_threshold = 64 * 1024;
+
+private:
+    struct level
+    {
+        bool object;
+        bool empty;
+    };
+
+    std::string _buffer;
+    std::string * _out {nullptr};
+    sink_type _sink;
+    std::size_t _flags {0};
+    int _precision {0};
+    std::vector<level> _levels;
+    bool _key_pending {false};
+    bool _complete {false};
+
+private:
+    JEYSON__EXPORT void init (json_writer_options const & opts);
+    JEYSON__EXPORT void before_value ();
+    JEYSON__EXPORT void after_value ();
+
+public:
+    /**
+     * Constructs writer to the internal buffer (see `str()` and `take()`).
+     */
+    explicit json_writer (json_writer_options const & opts = json_writer_options{})
+        : _out(& _buffer)
+    {
+        init(opts);
+    }
+
+    /**
+     * Constructs writer appending output to @a out.
+     */
+    explicit json_writer (std::string & out
+        , json_writer_options const & opts = json_writer_options{})
+        : _out(& out)
+    {
+        init(opts);
+    }
+
+    /**
+     * Constructs writer passing output to @a sink by chunks of about
+     * @c sink_threshold bytes. The rest is passed when the top-level value is
+     * completed or by `flush()`.
+     */
+    explicit json_writer (sink_type sink
+        , json_writer_options const & opts = json_writer_options{})
+        : _out(& _buffer)
+        , _sink(std::move(sink))
+    {
+        init(opts);
+    }
+
+    json_writer (json_writer const &) = delete;
+    json_writer & operator = (json_writer const &) = delete;
+
+    //--------------------------------------------------------------------------
+    // Events
+    //--------------------------------------------------------------------------
+    JEYSON__EXPORT json_writer & begin_object ();
+    JEYSON__EXPORT json_writer & end_object ();
+    JEYSON__EXPORT json_writer & begin_array ();
+    JEYSON__EXPORT json_writer & end_array ();
+
+    /**
+     * Writes the key of the next object member.
+     */
+    JEYSON__EXPORT json_writer & key (string_view k);
+
+    JEYSON__EXPORT json_writer & write_value (std::nullptr_t);
+    JEYSON__EXPORT json_writer & write_value (bool b);
+    JEYSON__EXPORT json_writer & write_value (std::intmax_t n);
+
+    /**
+     * Writes the real number @a n.
+     *
+     * @throw @c error { @c errc::invalid_argument } if @a n is NaN or infinity.
+     */
+    JEYSON__EXPORT json_writer & write_value (double n);
+
+    JEYSON__EXPORT json_writer & write_value (string_view s);
+
+    /**
+     * Writes the whole @a j.
+     *
+     * @throw @c error { @c errc::invalid_argument } if @a j is uninitialized.
+     * @throw @c error { @c errc::backend_error } if backend call(s) results a failure.
+     */
+    JEYSON__EXPORT json_writer & write_value (value_type const & j);
+
+    json_writer & write_value (std::string const & s)
+    {
+        return write_value(string_view{s});
+    }
+
+    json_writer & write_value (char const * s)
+    {
+        return write_value(string_view{s});
+    }
+
+    /**
+     * Writes @a value converted by @c encoder<T>.
+     */
+    template <typename T>
+    json_writer & value (T const & value)
+    {
+        encoder<T> encode;
+        return write_value(encode(value));
+    }
+
+    json_writer & value (char const * value)
+    {
+        encoder<char const *> encode;
+        return write_value(encode(value));
+    }
+
+    /**
+     * Writes object member, same as `key(k).value(value)`.
+     */
+    template <typename T>
+    json_writer & member (string_view k, T const & value)
+    {
+        return key(k).value(value);
+    }
+
+    json_writer & member (string_view k, char const * value)
+    {
+        return key(k).value(value);
+    }
+
+    //--------------------------------------------------------------------------
+    // State and output
+    //--------------------------------------------------------------------------
+    /// Current nesting level.
+    std::size_t depth () const noexcept
+    {
+        return _levels.size();
+    }
+
+    /// Checks if the top-level value is written completely.
+    bool complete () const noexcept
+    {
+        return _complete;
+    }
+
+    /**
+     * Output written to the internal buffer (not yet passed to the sink).
+     */
+    std::string const & str () const noexcept
+    {
+        return _buffer;
+    }
+
+    /**
+     * Moves out the output written to the internal buffer.
+     */
+    std::string take ()
+    {
+        std::string result;
+        result.swap(_buffer);
+        return result;
+    }
+
+    /**
+     * Passes the buffered output to the sink (if any).
+     */
+    void flush ()
+    {
+        if (_sink && !_buffer.empty()) {
+            _sink(_buffer.data(), _buffer.size());
+            _buffer.clear();
+        }
+    }
+};
+
+} // namespace jeyson
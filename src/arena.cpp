@@ -0,0 +1,309 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `jeyson-lib`.
+//
+// Changelog:
+//      2026.10.15 Initial version.
+//      2026.10.16 Lock-free lookup of arena chunks.
+////////////////////////////////////////////////////////////////////////////////
+#include "arena.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace jeyson {
+
+struct arena::chunk
+{
+    chunk * next;
+    std::size_t size; // Size of data following the header
+
+    char * data () noexcept
+    {
+        return reinterpret_cast<char *>(this) + header_size();
+    }
+
+    static constexpr std::size_t header_size () noexcept
+    {
+        return (sizeof(chunk *) + sizeof(std::size_t) + arena::alignment - 1)
+            & ~(arena::alignment - 1);
+    }
+};
+
+namespace {
+
+constexpr std::size_t max_chunk_size = 16 * 1024 * 1024;
+
+thread_local arena * t_current_arena = nullptr;
+
+// Registry of chunks of all alive arenas sorted by address.
+//
+// Lookups are made by every deallocation of the process once the allocation
+// hooks are installed, so they take no lock and write no shared memory: the
+// table is guarded by a sequence counter (odd while the table is modified)
+// and the lookup is retried if the table was modified meanwhile. Tables are
+// replaced by larger ones when full, replaced tables are never released
+// (lookups may still read them), the total size is bounded by twice the
+// size of the largest table.
+class chunk_registry
+{
+    struct table
+    {
+        std::size_t capacity;
+        std::atomic<std::size_t> size;
+        std::unique_ptr<std::atomic<std::uintptr_t>[]> begins;
+        std::unique_ptr<std::atomic<std::uintptr_t>[]> ends;
+
+        explicit table (std::size_t cap)
+            : capacity(cap)
+            , size(0)
+            , begins(new std::atomic<std::uintptr_t>[cap])
+            , ends(new std::atomic<std::uintptr_t>[cap])
+        {}
+    };
+
+    std::mutex _mtx; // Serializes modifications
+    std::atomic<unsigned> _seq {0};
+    std::atomic<table *> _table {nullptr};
+    std::atomic<std::size_t> _count {0};
+
+private:
+    // Modification of the table, called with the mutex locked
+    template <typename F>
+    void modify (F && f)
+    {
+        auto seq = _seq.load(std::memory_order_relaxed);
+        _seq.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        f(*_table.load(std::memory_order_relaxed));
+
+        _seq.store(seq + 2, std::memory_order_release);
+    }
+
+    static std::size_t lower_bound (table const & t, std::size_t n, std::uintptr_t x)
+    {
+        std::size_t first = 0;
+
+        while (n > 0) {
+            auto half = n / 2;
+
+            if (t.begins[first + half].load(std::memory_order_relaxed) < x) {
+                first += half + 1;
+                n -= half + 1;
+            } else {
+                n = half;
+            }
+        }
+
+        return first;
+    }
+
+public:
+    void add (void const * begin, std::size_t size)
+    {
+        auto b = reinterpret_cast<std::uintptr_t>(begin);
+        std::lock_guard<std::mutex> locker{_mtx};
+        auto t = _table.load(std::memory_order_relaxed);
+        auto n = t ? t->size.load(std::memory_order_relaxed) : 0;
+
+        // Copy to the larger table, the old one is left to lookups
+        if (!t || n == t->capacity) {
+            auto larger = new table(t ? 2 * t->capacity : 64);
+
+            for (std::size_t i = 0; i < n; i++) {
+                larger->begins[i].store(t->begins[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+                larger->ends[i].store(t->ends[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+            }
+
+            larger->size.store(n, std::memory_order_relaxed);
+
+            auto seq = _seq.load(std::memory_order_relaxed);
+            _seq.store(seq + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            _table.store(larger, std::memory_order_relaxed);
+            _seq.store(seq + 2, std::memory_order_release);
+        }
+
+        modify([b, size] (table & t) {
+            auto n = t.size.load(std::memory_order_relaxed);
+            auto pos = lower_bound(t, n, b);
+
+            for (auto i = n; i > pos; i--) {
+                t.begins[i].store(t.begins[i - 1].load(std::memory_order_relaxed), std::memory_order_relaxed);
+                t.ends[i].store(t.ends[i - 1].load(std::memory_order_relaxed), std::memory_order_relaxed);
+            }
+
+            t.begins[pos].store(b, std::memory_order_relaxed);
+            t.ends[pos].store(b + size, std::memory_order_relaxed);
+            t.size.store(n + 1, std::memory_order_relaxed);
+        });
+
+        _count.fetch_add(1, std::memory_order_release);
+    }
+
+    void remove (void const * begin)
+    {
+        auto b = reinterpret_cast<std::uintptr_t>(begin);
+        std::lock_guard<std::mutex> locker{_mtx};
+
+        if (!_table.load(std::memory_order_relaxed))
+            return;
+
+        bool removed = false;
+
+        modify([b, & removed] (table & t) {
+            auto n = t.size.load(std::memory_order_relaxed);
+            auto pos = lower_bound(t, n, b);
+
+            if (pos == n || t.begins[pos].load(std::memory_order_relaxed) != b)
+                return;
+
+            for (auto i = pos + 1; i < n; i++) {
+                t.begins[i - 1].store(t.begins[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+                t.ends[i - 1].store(t.ends[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+            }
+
+            t.size.store(n - 1, std::memory_order_relaxed);
+            removed = true;
+        });
+
+        if (removed)
+            _count.fetch_sub(1, std::memory_order_release);
+    }
+
+    bool contains (void const * p) const noexcept
+    {
+        // Fast path: no arenas
+        if (_count.load(std::memory_order_acquire) == 0)
+            return false;
+
+        auto x = reinterpret_cast<std::uintptr_t>(p);
+
+        for (;;) {
+            auto seq = _seq.load(std::memory_order_acquire);
+
+            if (seq & 1) {
+                std::this_thread::yield();
+                continue;
+            }
+
+            auto t = _table.load(std::memory_order_acquire);
+            bool result = false;
+
+            if (t) {
+                // Size is limited by the capacity: the table may be read
+                // while modified
+                auto n = (std::min)(t->size.load(std::memory_order_relaxed), t->capacity);
+                auto pos = lower_bound(*t, n, x + 1);
+
+                if (pos > 0) {
+                    result = x >= t->begins[pos - 1].load(std::memory_order_relaxed)
+                        && x < t->ends[pos - 1].load(std::memory_order_relaxed);
+                }
+            }
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+            if (_seq.load(std::memory_order_relaxed) == seq)
+                return result;
+        }
+    }
+};
+
+chunk_registry & registry ()
+{
+    static chunk_registry * instance = new chunk_registry; // Never destroyed
+    return *instance;
+}
+
+} // namespace
+
+arena::arena (std::size_t initial_size) noexcept
+    : _next_chunk_size((std::max)(initial_size, std::size_t{4096}))
+{}
+
+arena::~arena ()
+{
+    while (_head) {
+        auto next = _head->next;
+        registry().remove(_head->data());
+        std::free(_head);
+        _head = next;
+    }
+}
+
+void * arena::allocate_slow (std::size_t n) noexcept
+{
+    auto size = (std::max)(_next_chunk_size, n);
+    auto c = static_cast<chunk *>(std::malloc(chunk::header_size() + size));
+
+    if (!c)
+        return nullptr;
+
+    try {
+        registry().add(c->data(), size);
+    } catch (...) {
+        std::free(c);
+        return nullptr;
+    }
+
+    c->next = _head;
+    c->size = size;
+    _head = c;
+
+    _reserved += size;
+    _used += n;
+    ++_chunk_count;
+    ++_allocation_count;
+
+    // Block is larger than regular chunk: the chunk is dedicated to it,
+    // the current chunk remains in use
+    if (size == n && _cursor != nullptr)
+        return c->data();
+
+    _cursor = c->data() + n;
+    _limit = c->data() + size;
+
+    if (_next_chunk_size < max_chunk_size)
+        _next_chunk_size = (std::min)(_next_chunk_size * 2, max_chunk_size);
+
+    return c->data();
+}
+
+bool arena::contains (void const * p) const noexcept
+{
+    auto x = static_cast<char const *>(p);
+
+    for (auto c = _head; c; c = c->next) {
+        if (x >= c->data() && x < c->data() + c->size)
+            return true;
+    }
+
+    return false;
+}
+
+arena * arena::current () noexcept
+{
+    return t_current_arena;
+}
+
+bool arena::owns (void const * p) noexcept
+{
+    return registry().contains(p);
+}
+
+arena * arena::exchange_current (arena * a) noexcept
+{
+    auto prev = t_current_arena;
+    t_current_arena = a;
+    return prev;
+}
+
+} // namespace jeyson
@@ -0,0 +1,101 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `jeyson-lib`.
+//
+// Changelog:
+//      2026.10.15 Initial version.
+//      2026.10.16 Lock-free `owns()`.
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include <cstddef>
+
+namespace jeyson {
+
+/**
+ * Bump allocator: memory is allocated from chunks and released all at once
+ * when the arena is destroyed. Individual deallocation is a no-op.
+ *
+ * Chunks of all alive arenas are registered process-wide, so `owns()` can
+ * recognize memory allocated from any arena. `owns()` takes no lock, only
+ * registration of chunks is serialized.
+ */
+class arena
+{
+public:
+    /// Alignment of allocated blocks.
+    static constexpr std::size_t alignment = 16;
+
+private:
+    struct chunk;
+
+    chunk * _head {nullptr};
+    char * _cursor {nullptr};
+    char * _limit {nullptr};
+    std::size_t _next_chunk_size {0};
+
+    std::size_t _reserved {0};
+    std::size_t _used {0};
+    std::size_t _chunk_count {0};
+    std::size_t _allocation_count {0};
+
+public:
+    /**
+     * Constructs arena with the first chunk size @a initial_size (chunks are
+     * allocated on demand).
+     */
+    explicit arena (std::size_t initial_size = 64 * 1024) noexcept;
+    ~arena ();
+
+    arena (arena const &) = delete;
+    arena & operator = (arena const &) = delete;
+
+    /**
+     * Allocates @a n bytes aligned as `malloc()` does.
+     * @return Pointer to memory or @c nullptr on failure.
+     */
+    void * allocate (std::size_t n) noexcept
+    {
+        n = (n + alignment - 1) & ~(alignment - 1);
+
+        if (static_cast<std::size_t>(_limit - _cursor) >= n) {
+            auto p = _cursor;
+            _cursor += n;
+            _used += n;
+            ++_allocation_count;
+            return p;
+        }
+
+        return allocate_slow(n);
+    }
+
+    /// Bytes allocated from the system.
+    std::size_t reserved () const noexcept { return _reserved; }
+
+    /// Bytes handed out by `allocate()` (including alignment padding).
+    std::size_t used () const noexcept { return _used; }
+
+    std::size_t chunk_count () const noexcept { return _chunk_count; }
+
+    std::size_t allocation_count () const noexcept { return _allocation_count; }
+
+    /// Checks if @a p belongs to this arena.
+    bool contains (void const * p) const noexcept;
+
+    /// Arena for allocations in the current thread.
+    static arena * current () noexcept;
+
+    /// Checks if @a p belongs to any alive arena.
+    static bool owns (void const * p) noexcept;
+
+    /**
+     * Makes @a a current arena for the current thread.
+     * @return Previous current arena.
+     */
+    static arena * exchange_current (arena * a) noexcept;
+
+private:
+    void * allocate_slow (std::size_t n) noexcept;
+};
+
+} // namespace jeyson
@@ -0,0 +1,130 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `jeyson-lib`.
+//
+// Changelog:
+//      2026.10.15 Initial version.
+////////////////////////////////////////////////////////////////////////////////
+#include "instrumentation.hpp"
+#include <algorithm>
+
+#if JEYSON__INSTRUMENTATION_ENABLED
+
+namespace jeyson {
+namespace instrumentation {
+
+namespace {
+
+struct thread_state
+{
+    bool enabled {false};
+    sink_type sink {nullptr};
+    void * user_data {nullptr};
+    stats * current {nullptr};
+    stats totals;
+};
+
+thread_local thread_state t_state;
+
+void accumulate (stats & totals, stats const & r) noexcept
+{
+    totals.op = r.op;
+    totals.calls += r.calls;
+    totals.failures += r.failures;
+    totals.bytes_in += r.bytes_in;
+    totals.bytes_out += r.bytes_out;
+    totals.nulls += r.nulls;
+    totals.booleans += r.booleans;
+    totals.integers += r.integers;
+    totals.reals += r.reals;
+    totals.strings += r.strings;
+    totals.arrays += r.arrays;
+    totals.objects += r.objects;
+    totals.max_depth = (std::max)(totals.max_depth, r.max_depth);
+    totals.allocations += r.allocations;
+    totals.allocated_bytes += r.allocated_bytes;
+    totals.total_ns += r.total_ns;
+
+    for (int i = 0; i < phase_count; i++)
+        totals.phase_ns[i] += r.phase_ns[i];
+}
+
+} // namespace
+
+void enable (sink_type sink, void * user_data)
+{
+    // Allocations are counted by the backend allocation functions
+    backend::install_alloc_hooks();
+
+    t_state.enabled = true;
+    t_state.sink = sink;
+    t_state.user_data = user_data;
+}
+
+void disable () noexcept
+{
+    t_state.enabled = false;
+    t_state.sink = nullptr;
+    t_state.user_data = nullptr;
+}
+
+bool enabled () noexcept
+{
+    return t_state.enabled;
+}
+
+stats thread_totals () noexcept
+{
+    return t_state.totals;
+}
+
+void reset_thread_totals () noexcept
+{
+    t_state.totals = stats{};
+}
+
+stats * current_record () noexcept
+{
+    return t_state.current;
+}
+
+call_record::call_record (operation op) noexcept
+{
+    if (t_state.enabled && t_state.current == nullptr) {
+        _record.op = op;
+        _record.calls = 1;
+        _active = true;
+        t_state.current = & _record;
+        _start = std::chrono::steady_clock::now();
+    }
+}
+
+void call_record::stop () noexcept
+{
+    if (!_active || _stopped)
+        return;
+
+    auto elapsed = std::chrono::steady_clock::now() - _start;
+    _record.total_ns = static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    _stopped = true;
+}
+
+call_record::~call_record ()
+{
+    if (!_active)
+        return;
+
+    stop();
+
+    t_state.current = nullptr;
+    accumulate(t_state.totals, _record);
+
+    if (t_state.sink)
+        t_state.sink(_record, t_state.user_data);
+}
+
+}} // namespace jeyson::instrumentation
+
+#endif // JEYSON__INSTRUMENTATION_ENABLED
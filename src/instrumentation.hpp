@@ -0,0 +1,136 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `jeyson-lib`.
+//
+// Changelog:
+//      2026.10.15 Initial version.
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "jeyson/instrumentation.hpp"
+#include <chrono>
+#include <cstddef>
+
+// Library side of the instrumentation. If instrumentation is disabled the
+// classes below are empty and `call_record::get()` returns constant
+// @c nullptr, so the instrumented code is removed by the compiler.
+
+namespace jeyson {
+
+namespace backend {
+
+/**
+ * Installs backend allocation functions (defined by the backend).
+ */
+void install_alloc_hooks ();
+
+} // namespace backend
+
+namespace instrumentation {
+
+#if JEYSON__INSTRUMENTATION_ENABLED
+
+/**
+ * Record of the call in progress in the current thread or @c nullptr.
+ */
+stats * current_record () noexcept;
+
+/**
+ * Accounts backend allocation of @a n bytes.
+ */
+inline void count_allocation (std::size_t n) noexcept
+{
+    if (auto r = current_record()) {
+        r->allocations++;
+        r->allocated_bytes += n;
+    }
+}
+
+/**
+ * Record of the instrumented call. Record is active if instrumentation is
+ * enabled for the thread and no other call is recorded (nested calls are
+ * accounted in the outer call). Record is completed by the destructor.
+ */
+class call_record
+{
+    stats _record;
+    bool _active {false};
+    bool _stopped {false};
+    std::chrono::steady_clock::time_point _start;
+
+public:
+    explicit call_record (operation op) noexcept;
+    ~call_record ();
+
+    call_record (call_record const &) = delete;
+    call_record & operator = (call_record const &) = delete;
+
+    stats * get () noexcept
+    {
+        return _active ? & _record : nullptr;
+    }
+
+    /**
+     * Stops the call timer, so the following accounting (e.g. node counting)
+     * is not included in the call time.
+     */
+    void stop () noexcept;
+};
+
+/**
+ * Measures the phase of the active call record (if any).
+ */
+class phase_timer
+{
+    stats * _record {nullptr};
+    phase _phase;
+    std::chrono::steady_clock::time_point _start;
+
+public:
+    explicit phase_timer (phase p) noexcept
+        : _record(current_record())
+        , _phase(p)
+    {
+        if (_record)
+            _start = std::chrono::steady_clock::now();
+    }
+
+    ~phase_timer ()
+    {
+        if (_record) {
+            auto elapsed = std::chrono::steady_clock::now() - _start;
+            _record->phase_ns[static_cast<int>(_phase)] += static_cast<std::uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+        }
+    }
+
+    phase_timer (phase_timer const &) = delete;
+    phase_timer & operator = (phase_timer const &) = delete;
+};
+
+#else
+
+inline void count_allocation (std::size_t) noexcept {}
+
+class call_record
+{
+public:
+    explicit call_record (operation) noexcept {}
+
+    constexpr stats * get () const noexcept
+    {
+        return nullptr;
+    }
+
+    void stop () noexcept {}
+};
+
+class phase_timer
+{
+public:
+    explicit phase_timer (phase) noexcept {}
+};
+
+#endif
+
+}} // namespace jeyson::instrumentation
@@ -6,25 +6,48 @@
 // Changelog:
 //      2022.02.07 Initial version.
 //      2022.07.08 Fixed for MSVC.
+//      2026.10.15 Added native parser engine.
+//                 Real numbers are serialized in shortest round-trip form.
+//                 Added arena-backed documents.
+//                 Object member references do not copy keys.
+//                 Added json_view.
+//                 Copies of JSON values are copy-on-write.
+//                 Added instrumentation of parsing and serialization.
+//                 Files are memory mapped for parsing.
+//                 Added parallel parsing of large top-level arrays.
+//                 Added parsing of selected paths only.
+//                 Scalar getters and decoders are inlined.
+//      2026.10.16 Mutable references and iterators make the value unshareable.
+//                 Scalars are read by jansson API calls.
+//                 Document modification outside of the document scope is rejected.
 ////////////////////////////////////////////////////////////////////////////////
 #include "jeyson/json.hpp"
+#include "jeyson/document.hpp"
 #include "jeyson/error.hpp"
 #include "jeyson/backend/jansson.hpp"
+#include "arena.hpp"
+#include "instrumentation.hpp"
+#include "native_dumper.hpp"
+#include "native_loader.hpp"
 #include <pfs/assert.hpp>
 #include <pfs/i18n.hpp>
 #include <jansson.h>
 #include <algorithm>
+#include <atomic>
+#include <mutex>
 #include <limits>
 #include <sstream>
 #include <cassert>
 #include <cctype>
 #include <cstdlib>
+#include <cstring>
 
 namespace jeyson {
 
 using BACKEND  = backend::jansson;
 using JSON     = json<BACKEND>;
 using JSON_REF = json_ref<BACKEND>;
+using JSON_VIEW = json_view<BACKEND>;
 
 #define NATIVE(x) ((x)._ptr)
 #define INATIVE(x) (reinterpret_cast<BACKEND::basic_rep *>(& x)->_ptr)
@@ -34,6 +57,22 @@ static_assert((std::numeric_limits<std::intmax_t>::max)()
     == (std::numeric_limits<json_int_t>::max)()
     , "");
 
+// Inline access to the type in `backend::jansson` relies on this layout
+static_assert(sizeof(json_type) == sizeof(int)
+    && sizeof(json_t) == sizeof(BACKEND::layout::header)
+    && offsetof(json_t, type) == offsetof(BACKEND::layout::header, type)
+    , "");
+
+static_assert(JSON_OBJECT == static_cast<int>(BACKEND::type_tag::object)
+    && JSON_ARRAY == static_cast<int>(BACKEND::type_tag::array)
+    && JSON_STRING == static_cast<int>(BACKEND::type_tag::string)
+    && JSON_INTEGER == static_cast<int>(BACKEND::type_tag::integer)
+    && JSON_REAL == static_cast<int>(BACKEND::type_tag::real)
+    && JSON_TRUE == static_cast<int>(BACKEND::type_tag::true_value)
+    && JSON_FALSE == static_cast<int>(BACKEND::type_tag::false_value)
+    && JSON_NULL == static_cast<int>(BACKEND::type_tag::null)
+    , "");
+
 inline bool case_eq (string_view const & a, string_view const & b)
 {
     auto first1 = a.begin();
@@ -51,6 +90,237 @@ inline bool case_eq (string_view const & a, string_view const & b)
 
 namespace backend {
 
+#ifndef JEYSON__NATIVE_PARSER_DEFAULT
+#   define JEYSON__NATIVE_PARSER_DEFAULT 0
+#endif
+
+static std::atomic<jansson::parser_engine> s_parser_engine {
+    JEYSON__NATIVE_PARSER_DEFAULT ? jansson::parser_engine::native : jansson::parser_engine::jansson
+};
+
+void jansson::set_parser_engine (parser_engine engine) noexcept
+{
+    s_parser_engine.store(engine, std::memory_order_relaxed);
+}
+
+jansson::parser_engine jansson::get_parser_engine () noexcept
+{
+    return s_parser_engine.load(std::memory_order_relaxed);
+}
+
+static std::atomic<std::size_t> s_parallel_threshold {0};
+static std::atomic<std::size_t> s_parallel_threads {0};
+
+void jansson::set_parallel_parsing (parallel_parsing const & settings) noexcept
+{
+    s_parallel_threshold.store(settings.threshold, std::memory_order_relaxed);
+    s_parallel_threads.store(settings.threads, std::memory_order_relaxed);
+}
+
+jansson::parallel_parsing jansson::get_parallel_parsing () noexcept
+{
+    parallel_parsing result;
+    result.threshold = s_parallel_threshold.load(std::memory_order_relaxed);
+    result.threads = s_parallel_threads.load(std::memory_order_relaxed);
+    return result;
+}
+
+std::intmax_t jansson::integer_of (basic_rep const & r) noexcept
+{
+    return static_cast<std::intmax_t>(json_integer_value(r._ptr));
+}
+
+double jansson::real_of (basic_rep const & r) noexcept
+{
+    return json_real_value(r._ptr);
+}
+
+char const * jansson::string_data_of (basic_rep const & r) noexcept
+{
+    return json_string_value(r._ptr);
+}
+
+std::size_t jansson::string_length_of (basic_rep const & r) noexcept
+{
+    return json_string_length(r._ptr);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Allocation hooks for arena-backed documents and instrumentation
+////////////////////////////////////////////////////////////////////////////////
+static json_malloc_t s_prev_malloc = std::malloc;
+static json_free_t s_prev_free = std::free;
+
+static void * arena_malloc (size_t size)
+{
+    instrumentation::count_allocation(size);
+
+    auto a = arena::current();
+    return a ? a->allocate(size) : s_prev_malloc(size);
+}
+
+// Memory of the arena is released when the document is destroyed
+static void arena_free (void * ptr)
+{
+    if (!ptr)
+        return;
+
+    auto a = arena::current();
+
+    if ((a && a->contains(ptr)) || arena::owns(ptr))
+        return;
+
+    s_prev_free(ptr);
+}
+
+// Hooks are installed once, before the first arena is used or instrumentation
+// is enabled. Memory allocated before is released by the previous deallocation
+// function.
+void install_alloc_hooks ()
+{
+    static std::once_flag flag;
+
+    std::call_once(flag, [] {
+#if JANSSON_VERSION_HEX >= 0x020800
+        json_get_alloc_funcs(& s_prev_malloc, & s_prev_free);
+#endif
+        json_set_alloc_funcs(arena_malloc, arena_free);
+    });
+}
+
+// Nodes of a document can be modified in the document scope only: nodes
+// created outside of it are not allocated from the document arena and would
+// leak (or dangle, if allocated from another arena) when the document is
+// destroyed.
+static bool in_scope (json_t const * node) noexcept
+{
+    auto a = arena::current();
+
+    if (node == nullptr || (a != nullptr && a->contains(node)))
+        return true;
+
+    return !arena::owns(node);
+}
+
+// @a value (new reference, if any) is released on failure
+static void check_scope (json_t const * node, json_t * value = nullptr)
+{
+    if (!in_scope(node)) {
+        if (value)
+            json_decref(value);
+
+        throw error {make_error_code(std::errc::operation_not_permitted)
+            , tr::_("document modified outside of the document scope")};
+    }
+}
+
+// Value moved into a document node must be allocated from the document arena
+// too: value created outside of the document scope is replaced by its copy
+static void adopt (json_t const * node, json_t *& value)
+{
+    auto a = arena::current();
+
+    if (a == nullptr || !a->contains(node) || a->contains(value))
+        return;
+
+    auto copy = json_deep_copy(value);
+
+    if (!copy)
+        throw error {make_error_code(pfs::errc::backend_error), tr::_("deep copy failure")};
+
+    json_decref(value);
+    value = copy;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Copy-on-write
+////////////////////////////////////////////////////////////////////////////////
+// Copies of a value share the tree and the group counter. The tree is copied
+// by the member of the group that modifies it first (see `detach()`).
+//
+// Trees in an arena and copies made inside a document scope are not shared:
+// arena memory is released with the document regardless of reference counts.
+//
+// A value that has given out mutable references or iterators is marked by
+// `s_leaked` instead of a group (see `leak()`): writes through them must not
+// be visible in copies, so the tree is copied by `share()` until the value
+// is reassigned.
+static jansson::share_counter s_leaked {0};
+
+static void share (jansson::rep & rep, jansson::rep const & other)
+{
+    auto group = other._shares.load(std::memory_order_acquire);
+
+    if (group == & s_leaked || arena::current() != nullptr || arena::owns(other._ptr)) {
+        rep._ptr = json_deep_copy(other._ptr);
+
+        if (!rep._ptr)
+            throw error {make_error_code(pfs::errc::backend_error), tr::_("deep copy failure")};
+
+        return;
+    }
+
+    if (!group) {
+        auto new_group = new jansson::share_counter {1};
+
+        if (other._shares.compare_exchange_strong(group, new_group, std::memory_order_acq_rel))
+            group = new_group;
+        else
+            delete new_group;
+    }
+
+    group->fetch_add(1, std::memory_order_relaxed);
+    rep._ptr = json_incref(other._ptr);
+    rep._shares.store(group, std::memory_order_relaxed);
+}
+
+// Leaves the group, the tree is not modified
+static void unshare (jansson::rep & rep) noexcept
+{
+    auto group = rep._shares.exchange(nullptr, std::memory_order_acq_rel);
+
+    if (group && group != & s_leaked && group->fetch_sub(1, std::memory_order_acq_rel) == 1)
+        delete group;
+}
+
+// Makes the tree exclusively owned by @a rep before modification.
+// The tree is copied before leaving the group, so concurrently detaching
+// members never see the tree being modified.
+void detach (jansson::rep & rep)
+{
+    auto group = rep._shares.load(std::memory_order_acquire);
+
+    if (!group || group == & s_leaked)
+        return;
+
+    if (group->load(std::memory_order_acquire) > 1) {
+        auto copy = json_deep_copy(rep._ptr);
+
+        if (!copy)
+            throw error {make_error_code(pfs::errc::backend_error), tr::_("deep copy failure")};
+
+        json_decref(rep._ptr);
+        rep._ptr = copy;
+    }
+
+    unshare(rep);
+}
+
+// Detaches the tree and marks it as modifiable through references or
+// iterators given out by @a rep
+void leak (jansson::rep & rep)
+{
+    detach(rep);
+    rep._shares.store(& s_leaked, std::memory_order_release);
+}
+
+// References are not the members of copy-on-write groups
+inline void detach (jansson::ref &) noexcept
+{}
+
+inline void leak (jansson::ref &) noexcept
+{}
+
 ////////////////////////////////////////////////////////////////////////////////
 // rep
 ////////////////////////////////////////////////////////////////////////////////
@@ -60,13 +330,14 @@ jansson::rep::rep ()
 jansson::rep::rep (rep const & other)
 {
     if (other._ptr)
-        _ptr = json_deep_copy(other._ptr);
+        share(*this, other);
 }
 
 jansson::rep::rep (rep && other)
 {
     if (other._ptr) {
         _ptr = other._ptr;
+        _shares.store(other._shares.exchange(nullptr, std::memory_order_relaxed), std::memory_order_relaxed);
         other._ptr = nullptr;
     }
 }
@@ -78,6 +349,8 @@ jansson::rep::rep (json_t * p) : basic_rep()
 
 jansson::rep::~rep ()
 {
+    unshare(*this);
+
     if (_ptr)
         json_decref(_ptr);
 
@@ -88,6 +361,10 @@ inline void swap (jansson::rep & a, jansson::rep & b)
 {
     using std::swap;
     swap(a._ptr, b._ptr);
+
+    auto shares = a._shares.load(std::memory_order_relaxed);
+    a._shares.store(b._shares.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    b._shares.store(shares, std::memory_order_relaxed);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -103,11 +380,7 @@ jansson::ref::ref (ref const & other)
 
     if (other._parent) {
         _parent = json_incref(other._parent);
-
-        if (json_is_object(_parent))
-            new (& _index.key) key_type(std::move(other._index.key));
-        else
-            _index.i = other._index.i;
+        _index = other._index;
     }
 }
 
@@ -115,13 +388,7 @@ jansson::ref::ref (ref && other)
 {
     _ptr = other._ptr;
     _parent = other._parent;
-
-    if (_parent) {
-        if (json_is_object(_parent))
-            new (& _index.key) key_type(std::move(other._index.key));
-        else
-            _index.i = other._index.i;
-    }
+    _index = other._index;
 
     other._ptr = nullptr;
     other._parent = nullptr;
@@ -138,24 +405,19 @@ jansson::ref::ref (json_t * ptr, json_t * parent, size_type index)
     }
 }
 
-jansson::ref::ref (json_t * ptr, json_t * parent, std::string const & key)
+jansson::ref::ref (json_t * ptr, json_t * parent, void * iter)
 {
     if (ptr)
         _ptr = json_incref(ptr);
 
     if (parent) {
         _parent = json_incref(parent);
-        new (& _index.key) key_type(key);
+        _index.iter = iter;
     }
 }
 
 jansson::ref::~ref ()
 {
-    if (_parent) {
-        if (json_is_object(_parent))
-            _index.key.~basic_string();
-    }
-
     if (_ptr) {
         json_decref(_ptr);
         _ptr = nullptr;
@@ -170,31 +432,102 @@ jansson::ref::~ref ()
 void swap (jansson::ref & a, jansson::ref & b)
 {
     using std::swap;
+    swap(a._ptr, b._ptr);
+    swap(a._parent, b._parent);
+    swap(a._index, b._index);
+}
 
-    if (json_is_array(a._parent)) {
-        // Both are arrays
-        if (json_is_array(b._parent)) {
-            swap(a._index.i, b._index.i);
-        } else {
-            auto i = a._index.i;
-            new (& a._index.key) std::string(std::move(b._index.key));
-            b._index.key.~basic_string();
-            b._index.i = i;
+// Releases the tree, @a rep becomes uninitialized
+inline void reset (jansson::rep & rep) noexcept
+{
+    jansson::rep empty;
+    swap(rep, empty);
+}
+
+// Releases the referenced value and its parent, @a ref becomes invalid
+inline void reset (jansson::ref & ref) noexcept
+{
+    jansson::ref empty;
+    swap(ref, empty);
+}
+
+// Returns object iterator for the member with @a key or @c nullptr if not found.
+// The iterator (and the key it points to) belongs to the object, so it can be
+// stored in `jansson::ref` without copying the key.
+void * object_iter (json_t * obj, string_view const & key)
+{
+    // `json_object_iter_at()` accepts null-terminated keys only
+    char buf[256];
+
+    if (key.size() < sizeof(buf)) {
+        if (std::memchr(key.data(), '\0', key.size()) == nullptr) {
+            std::memcpy(buf, key.data(), key.size());
+            buf[key.size()] = '\0';
+            return json_object_iter_at(obj, buf);
         }
-    } else {
-        // Both are objects
-        if (json_is_object(b._parent)) {
-            swap(a._index.key, b._index.key);
-        } else {
-            auto i = b._index.i;
-            new (& b._index.key) std::string(std::move(a._index.key));
-            a._index.key.~basic_string();
-            a._index.i = i;
+    } else if (std::memchr(key.data(), '\0', key.size()) == nullptr) {
+        return json_object_iter_at(obj, std::string(key.data(), key.size()).c_str());
+    }
+
+    // Key with embedded null characters
+    for (auto iter = json_object_iter(obj); iter != nullptr; iter = json_object_iter_next(obj, iter)) {
+        if (json_object_iter_key_len(iter) == key.size()
+                && std::memcmp(json_object_iter_key(iter), key.data(), key.size()) == 0) {
+            return iter;
         }
     }
 
-    swap(a._ptr, b._ptr);
-    swap(a._parent, b._parent);
+    return nullptr;
+}
+
+inline JSON_VIEW make_view (json_t * ptr) noexcept
+{
+    JSON_VIEW result;
+
+    if (ptr) {
+        result._ptr = ptr;
+        result._type = json_typeof(ptr);
+    }
+
+    return result;
+}
+
+// Accounts nodes of the tree for the instrumentation record
+static void collect_node_stats (json_t * j, instrumentation::stats & s, std::size_t depth = 0)
+{
+    if (!j)
+        return;
+
+    switch (json_typeof(j)) {
+        case JSON_NULL: s.nulls++; break;
+        case JSON_TRUE:
+        case JSON_FALSE: s.booleans++; break;
+        case JSON_INTEGER: s.integers++; break;
+        case JSON_REAL: s.reals++; break;
+        case JSON_STRING: s.strings++; break;
+
+        case JSON_ARRAY: {
+            s.arrays++;
+            s.max_depth = (std::max)(s.max_depth, depth + 1);
+
+            for (std::size_t i = 0, n = json_array_size(j); i < n; i++)
+                collect_node_stats(json_array_get(j, i), s, depth + 1);
+
+            return;
+        }
+
+        case JSON_OBJECT: {
+            s.objects++;
+            s.max_depth = (std::max)(s.max_depth, depth + 1);
+
+            for (auto it = json_object_iter(j); it; it = json_object_iter_next(j, it))
+                collect_node_stats(json_object_iter_value(it), s, depth + 1);
+
+            return;
+        }
+    }
+
+    s.max_depth = (std::max)(s.max_depth, depth);
 }
 
 // value must be a new reference
@@ -203,6 +536,8 @@ void assign (jansson::rep & rep, json_t * value)
     if (!value)
         throw error {make_error_code(std::errc::invalid_argument), tr::_("attempt to assign null value")};
 
+    unshare(rep);
+
     if (rep._ptr) {
         json_decref(rep._ptr);
         rep._ptr = nullptr;
@@ -217,6 +552,8 @@ void assign (jansson::ref & ref, json_t * value)
     if (!value)
         throw error {make_error_code(std::errc::invalid_argument), tr::_("attempt to assign null value")};
 
+    check_scope(ref._parent, value);
+
     if (ref._ptr) {
         json_decref(ref._ptr);
         ref._ptr = nullptr;
@@ -234,16 +571,14 @@ void assign (jansson::ref & ref, json_t * value)
             // `json_array_set()` function
             ref._ptr = value; // json_incref(ref._ptr);
         } else if (json_is_object(ref._parent)) {
-            auto rc = json_object_setn_nocheck(ref._parent
-                , ref._index.key.c_str()
-                , ref._index.key.size()
-                , value);
+            // Do not steal reference
+            auto rc = json_object_iter_set(ref._parent, ref._index.iter, value);
 
             if (rc != 0)
                 throw error {make_error_code(pfs::errc::backend_error), tr::_("replace object element failure")};
 
             // Not need `json_incref(value)`, we use non-steal variant of
-            // `json_object_setn_nocheck()` function
+            // `json_object_iter_set()` function
             ref._ptr = value;
         } else {
             throw error {make_error_code(errc::incopatible_type), tr::_("array or object expected for parent")};
@@ -259,6 +594,8 @@ void insert (json_t * obj, string_view const & key, json_t * value)
     if (!value)
         throw error {make_error_code(std::errc::invalid_argument), tr::_("attempt to insert null value")};
 
+    check_scope(obj, value);
+
     if (!json_is_object(obj))
         throw error {make_error_code(errc::incopatible_type), tr::_("object expected")};
 
@@ -274,6 +611,8 @@ void push_back (json_t * arr, json_t * value)
     if (!value)
         throw error {make_error_code(std::errc::invalid_argument), tr::_("attempt to push back null value")};
 
+    check_scope(arr, value);
+
     if (!json_is_array(arr))
         throw error {make_error_code(errc::incopatible_type), tr::_("array expected")};
 
@@ -359,7 +698,7 @@ template <>
 json<BACKEND>::json (json_ref<BACKEND> && j)
 {
     backend::assign(*this, json_deep_copy(j._ptr));
-    j.~json_ref<BACKEND>();
+    backend::reset(j);
 }
 
 template <>
@@ -371,10 +710,10 @@ json<BACKEND> & json<BACKEND>::operator = (json const & other)
 {
     if (this != & other) {
         if (NATIVE(*this) != NATIVE(other)) {
-            this->~json();
+            backend::reset(*this);
 
             if (NATIVE(other))
-                NATIVE(*this) = json_deep_copy(NATIVE(other));
+                backend::share(*this, other);
         }
     }
 
@@ -387,12 +726,9 @@ json<BACKEND>::operator = (json && other)
 {
     if (this != & other) {
         if (NATIVE(*this) != NATIVE(other)) {
-            this->~json();
-
-            if (NATIVE(other)) {
-                NATIVE(*this) = NATIVE(other);
-                NATIVE(other) = nullptr;
-            }
+            // Previous tree is released by the temporary
+            rep_type tmp {std::move(other)};
+            backend::swap(*this, tmp);
         }
     }
 
@@ -412,7 +748,7 @@ json<BACKEND> &
 json<BACKEND>::operator = (json_ref<BACKEND> && j)
 {
     backend::assign(*this, json_deep_copy(j._ptr));
-    j.~json_ref<BACKEND>();
+    backend::reset(j);
     return *this;
 }
 
@@ -437,8 +773,11 @@ json<BACKEND>::assign_helper (std::intmax_t n)
 {
     if (!json_is_integer(_ptr))
         backend::assign(*this, json_integer(n));
-    else
+    else {
+        backend::detach(*this);
+        backend::check_scope(_ptr);
         json_integer_set(_ptr, n);
+    }
 }
 
 template <>
@@ -447,8 +786,11 @@ json<BACKEND>::assign_helper (double n)
 {
     if (!json_is_real(_ptr))
         backend::assign(*this, json_real(n));
-    else
+    else {
+        backend::detach(*this);
+        backend::check_scope(_ptr);
         json_real_set(_ptr, n);
+    }
 }
 
 template <>
@@ -457,8 +799,11 @@ json<BACKEND>::assign_helper (string_view const & s)
 {
     if (!json_is_string(_ptr))
         backend::assign(*this, json_stringn_nocheck(s.data(), s.size()));
-    else
+    else {
+        backend::detach(*this);
+        backend::check_scope(_ptr);
         json_string_setn_nocheck(_ptr, s.data(), s.size());
+    }
 }
 
 //------------------------------------------------------------------------------
@@ -471,6 +816,22 @@ json<BACKEND>::swap (json & other)
     backend::swap(*this, other);
 }
 
+template <>
+json<BACKEND>
+json<BACKEND>::deep_copy () const
+{
+    json result;
+
+    if (NATIVE(*this)) {
+        NATIVE(result) = json_deep_copy(NATIVE(*this));
+
+        if (!NATIVE(result))
+            throw error {make_error_code(pfs::errc::backend_error), tr::_("deep copy failure")};
+    }
+
+    return result;
+}
+
 //------------------------------------------------------------------------------
 // Save
 //------------------------------------------------------------------------------
@@ -498,9 +859,26 @@ void json<BACKEND>::save (pfs::filesystem::path const & path
     if (precision > 0)
         flags |= JSON_REAL_PRECISION(precision);
 
-    auto rc = json_dump_file(NATIVE(*this)
-        , pfs::utf8_encode_path(path).c_str()
-        , flags);
+    instrumentation::call_record record {instrumentation::operation::save};
+    int rc = 0;
+
+    {
+        instrumentation::phase_timer timer {instrumentation::phase::dump};
+        rc = backend::native_dump_file(NATIVE(*this), pfs::utf8_encode_path(path).c_str(), flags);
+    }
+
+    if (auto r = record.get()) {
+        record.stop();
+        backend::collect_node_stats(NATIVE(*this), *r);
+
+        std::error_code ec;
+        auto size = pfs::filesystem::file_size(path, ec);
+
+        if (rc < 0)
+            r->failures++;
+        else if (!ec)
+            r->bytes_out = static_cast<std::size_t>(size);
+    }
 
     if (rc < 0) {
         throw error {
@@ -518,8 +896,30 @@ json<BACKEND>
 json<BACKEND>::parse (char const * source, std::size_t len, error * perr)
 {
     json_error_t jerror;
+    instrumentation::call_record record {instrumentation::operation::parse};
+    json_t * j = nullptr;
+    auto native = BACKEND::get_parser_engine() == BACKEND::parser_engine::native;
+    auto parallel = BACKEND::get_parallel_parsing();
+
+    // Worker threads allocate from the heap, not from the document arena
+    if (parallel.threshold > 0 && len >= parallel.threshold && arena::current() == nullptr)
+        j = backend::parallel_loadb(source, len, JSON_DECODE_ANY, native, parallel.threads);
+
+    if (j == nullptr) {
+        if (native) {
+            j = backend::native_loadb(source, len, JSON_DECODE_ANY, & jerror);
+        } else {
+            instrumentation::phase_timer timer {instrumentation::phase::build};
+            j = json_loadb(source, len, JSON_DECODE_ANY, & jerror);
+        }
+    }
 
-    auto j = json_loadb(source, len, JSON_DECODE_ANY, & jerror);
+    if (auto r = record.get()) {
+        record.stop();
+        r->bytes_in = len;
+        r->failures += j ? 0 : 1;
+        backend::collect_node_stats(j, *r);
+    }
 
     if (!j) {
         pfs::throw_or(perr, make_error_code(pfs::errc::backend_error)
@@ -553,12 +953,133 @@ json<BACKEND>
 json<BACKEND>::parse (pfs::filesystem::path const & path, error * perr)
 {
     json_error_t jerror;
+    auto flags = JSON_DECODE_ANY | JSON_REJECT_DUPLICATES | JSON_ALLOW_NUL;
+    instrumentation::call_record record {instrumentation::operation::parse};
+    json_t * j = nullptr;
+
+    auto parallel = BACKEND::get_parallel_parsing();
 
-    auto j = json_load_file(pfs::utf8_encode_path(path).c_str()
-        ,     JSON_DECODE_ANY
-            | JSON_REJECT_DUPLICATES
-            | JSON_ALLOW_NUL
-        , & jerror);
+    // Worker threads allocate from the heap, not from the document arena
+    if (arena::current() != nullptr)
+        parallel.threshold = 0;
+
+    if (BACKEND::get_parser_engine() == BACKEND::parser_engine::native) {
+        j = backend::native_load_file(pfs::utf8_encode_path(path).c_str(), flags, & jerror
+            , parallel.threshold, parallel.threads);
+    } else {
+        j = backend::jansson_load_file(pfs::utf8_encode_path(path).c_str(), flags, & jerror
+            , parallel.threshold, parallel.threads);
+    }
+
+    if (auto r = record.get()) {
+        record.stop();
+        std::error_code ec;
+        auto size = pfs::filesystem::file_size(path, ec);
+
+        if (!ec)
+            r->bytes_in = static_cast<std::size_t>(size);
+
+        r->failures += j ? 0 : 1;
+        backend::collect_node_stats(j, *r);
+    }
+
+    if (!j) {
+        pfs::throw_or(perr, make_error_code(pfs::errc::backend_error)
+            , tr::f_("parse error at {}:{}: {}"
+                , jerror.line
+                , pfs::utf8_encode_path(path)
+                , jerror.text));
+
+        return json<BACKEND>{};
+    }
+
+    json<BACKEND> result;
+    NATIVE(result) = j;
+
+    return result;
+}
+
+namespace {
+
+bool compile_projection (std::vector<std::string> const & paths
+    , backend::projection & proj, error * perr)
+{
+    for (auto const & p: paths) {
+        if (!proj.add(p.data(), p.size())) {
+            pfs::throw_or(perr, make_error_code(std::errc::invalid_argument)
+                , tr::f_("invalid JSON Pointer: {}", p));
+
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} // namespace
+
+// Projection is always parsed by the native parser engine
+template <>
+json<BACKEND>
+json<BACKEND>::parse (char const * source, std::size_t len
+    , std::vector<std::string> const & paths, error * perr)
+{
+    backend::projection proj;
+
+    if (!compile_projection(paths, proj, perr))
+        return json<BACKEND>{};
+
+    json_error_t jerror;
+    instrumentation::call_record record {instrumentation::operation::parse};
+    auto j = backend::native_load_projection(source, len, JSON_DECODE_ANY, proj, & jerror);
+
+    if (auto r = record.get()) {
+        record.stop();
+        r->bytes_in = len;
+        r->failures += j ? 0 : 1;
+        backend::collect_node_stats(j, *r);
+    }
+
+    if (!j) {
+        pfs::throw_or(perr, make_error_code(pfs::errc::backend_error)
+            , tr::f_("parse error at line {}: {}", jerror.line, jerror.text));
+
+        return json<BACKEND>{};
+    }
+
+    json<BACKEND> result;
+    NATIVE(result) = j;
+
+    return result;
+}
+
+template <>
+json<BACKEND>
+json<BACKEND>::parse (pfs::filesystem::path const & path
+    , std::vector<std::string> const & paths, error * perr)
+{
+    backend::projection proj;
+
+    if (!compile_projection(paths, proj, perr))
+        return json<BACKEND>{};
+
+    json_error_t jerror;
+    auto flags = JSON_DECODE_ANY | JSON_REJECT_DUPLICATES | JSON_ALLOW_NUL;
+    instrumentation::call_record record {instrumentation::operation::parse};
+    auto j = backend::native_load_file_projection(pfs::utf8_encode_path(path).c_str()
+        , flags, proj, & jerror);
+
+    if (auto r = record.get()) {
+        record.stop();
+        std::error_code ec;
+        auto size = pfs::filesystem::file_size(path, ec);
+
+        if (!ec)
+            r->bytes_in = static_cast<std::size_t>(size);
+
+        r->failures += j ? 0 : 1;
+        backend::collect_node_stats(j, *r);
+    }
 
     if (!j) {
         pfs::throw_or(perr, make_error_code(pfs::errc::backend_error)
@@ -589,6 +1110,108 @@ operator == (json<BACKEND> const & lhs, json<BACKEND> const & rhs)
     return json_equal(NATIVE(lhs), NATIVE(rhs)) == 1;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// JSON document
+////////////////////////////////////////////////////////////////////////////////
+template <>
+json_document<BACKEND>::scope::scope (json_document & doc)
+    : _prev(arena::exchange_current(doc._arena))
+{}
+
+template <>
+json_document<BACKEND>::scope::~scope ()
+{
+    arena::exchange_current(_prev);
+}
+
+template <>
+json_document<BACKEND>::json_document (std::size_t initial_size)
+    : _arena(new arena(initial_size))
+{
+    backend::install_alloc_hooks();
+}
+
+template <>
+json_document<BACKEND>::~json_document ()
+{
+    // Nodes are not released one by one: all of them are in the arena.
+    // Root assigned outside of a document scope is released as usual.
+    if (_arena && _arena->contains(NATIVE(_root)))
+        NATIVE(_root) = nullptr;
+
+    delete _arena;
+    _arena = nullptr;
+}
+
+template <>
+json_document<BACKEND>::json_document (json_document && other) noexcept
+    : _arena(other._arena)
+    , _root(std::move(other._root))
+{
+    other._arena = nullptr;
+}
+
+template <>
+json_document<BACKEND> & json_document<BACKEND>::operator = (json_document && other) noexcept
+{
+    if (this != & other) {
+        // Previous arena and root are released by the temporary
+        json_document tmp {std::move(other)};
+        std::swap(_arena, tmp._arena);
+        _root.swap(tmp._root);
+    }
+
+    return *this;
+}
+
+template <>
+json_document<BACKEND>::memory_stats json_document<BACKEND>::stats () const noexcept
+{
+    memory_stats result;
+
+    if (_arena) {
+        result.reserved = _arena->reserved();
+        result.used = _arena->used();
+        result.chunks = _arena->chunk_count();
+        result.allocations = _arena->allocation_count();
+    }
+
+    return result;
+}
+
+// Tree takes about twice as much memory as the text (for texts with short
+// strings), so the first chunk is large enough in most cases.
+static std::size_t initial_arena_size (std::uintmax_t text_size)
+{
+    constexpr std::uintmax_t min_size = 64 * 1024;
+    constexpr std::uintmax_t max_size = 256 * 1024 * 1024;
+
+    return static_cast<std::size_t>((std::min)((std::max)(text_size * 2, min_size), max_size));
+}
+
+template <>
+json_document<BACKEND>
+json_document<BACKEND>::parse (char const * source, std::size_t len, error * perr)
+{
+    json_document doc {initial_arena_size(len)};
+    scope s {doc};
+    doc._root = JSON::parse(source, len, perr);
+    return doc;
+}
+
+template <>
+json_document<BACKEND>
+json_document<BACKEND>::parse (pfs::filesystem::path const & path, error * perr)
+{
+    std::error_code ec;
+    auto size = pfs::filesystem::file_size(path, ec);
+
+    json_document doc {initial_arena_size(ec ? 0 : size)};
+    scope s {doc};
+    doc._root = JSON::parse(path, perr);
+    return doc;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // JSON reference
 ////////////////////////////////////////////////////////////////////////////////
@@ -614,6 +1237,8 @@ json_ref<BACKEND>::json_ref (BACKEND::ref && other)
 template <>
 json_ref<BACKEND>::json_ref (json<BACKEND> & j)
 {
+    backend::leak(j);
+
     if (j._ptr)
         backend::assign(*this, json_incref(j._ptr));
 }
@@ -621,9 +1246,11 @@ json_ref<BACKEND>::json_ref (json<BACKEND> & j)
 template <>
 json_ref<BACKEND>::json_ref (json<BACKEND> && j)
 {
+    backend::detach(j);
+
     if (j._ptr) {
         backend::assign(*this, json_incref(j._ptr));
-        j.~json<BACKEND>();
+        backend::reset(j);
     }
 }
 
@@ -643,7 +1270,7 @@ json_ref<BACKEND>::operator = (json_ref && j)
 {
     if (j._ptr) {
         backend::assign(*this, json_deep_copy(j._ptr));
-        j.~json_ref();
+        backend::reset(j);
     }
 
     return *this;
@@ -663,7 +1290,7 @@ json_ref<BACKEND> & json_ref<BACKEND>::operator = (json<BACKEND> && j)
 {
     if (j._ptr) {
         backend::assign(*this, json_deep_copy(j._ptr));
-        j.~json<BACKEND>();
+        backend::reset(j);
     }
 
     return *this;
@@ -786,19 +1413,63 @@ traits_interface<Derived>::is_array () const noexcept
     return CINATIVE(*self) ? json_is_array(CINATIVE(*self)) : false;
 }
 
-template bool traits_interface<JSON>::is_array() const noexcept;
-template bool traits_interface<JSON_REF>::is_array() const noexcept;
+template bool traits_interface<JSON>::is_array() const noexcept;
+template bool traits_interface<JSON_REF>::is_array() const noexcept;
+
+template <typename Derived>
+bool
+traits_interface<Derived>::is_object () const noexcept
+{
+    auto self = static_cast<Derived const *>(this);
+    return CINATIVE(*self) ? json_is_object(CINATIVE(*self)) : false;
+}
+
+template bool traits_interface<JSON>::is_object() const noexcept;
+template bool traits_interface<JSON_REF>::is_object() const noexcept;
+
+// View traits use the cached type tag and do not dereference the value
+template <>
+bool traits_interface<JSON_VIEW>::is_null () const noexcept
+{
+    return static_cast<JSON_VIEW const *>(this)->_type == JSON_NULL;
+}
+
+template <>
+bool traits_interface<JSON_VIEW>::is_bool () const noexcept
+{
+    auto type = static_cast<JSON_VIEW const *>(this)->_type;
+    return type == JSON_TRUE || type == JSON_FALSE;
+}
+
+template <>
+bool traits_interface<JSON_VIEW>::is_integer () const noexcept
+{
+    return static_cast<JSON_VIEW const *>(this)->_type == JSON_INTEGER;
+}
+
+template <>
+bool traits_interface<JSON_VIEW>::is_real () const noexcept
+{
+    return static_cast<JSON_VIEW const *>(this)->_type == JSON_REAL;
+}
+
+template <>
+bool traits_interface<JSON_VIEW>::is_string () const noexcept
+{
+    return static_cast<JSON_VIEW const *>(this)->_type == JSON_STRING;
+}
 
-template <typename Derived>
-bool
-traits_interface<Derived>::is_object () const noexcept
+template <>
+bool traits_interface<JSON_VIEW>::is_array () const noexcept
 {
-    auto self = static_cast<Derived const *>(this);
-    return CINATIVE(*self) ? json_is_object(CINATIVE(*self)) : false;
+    return static_cast<JSON_VIEW const *>(this)->_type == JSON_ARRAY;
 }
 
-template bool traits_interface<JSON>::is_object() const noexcept;
-template bool traits_interface<JSON_REF>::is_object() const noexcept;
+template <>
+bool traits_interface<JSON_VIEW>::is_object () const noexcept
+{
+    return static_cast<JSON_VIEW const *>(this)->_type == JSON_OBJECT;
+}
 
 ////////////////////////////////////////////////////////////////////////////////
 // Modifiers interface
@@ -809,6 +1480,7 @@ modifiers_interface<Derived, Backend>::insert_helper (string_view const & key
     , std::nullptr_t)
 {
     auto self = static_cast<Derived *>(this);
+    backend::detach(*self);
 
     if (!INATIVE(*self))
         INATIVE(*self) = json_object();
@@ -823,6 +1495,7 @@ void
 modifiers_interface<Derived, Backend>::insert_helper (string_view const & key, bool b)
 {
     auto self = static_cast<Derived *>(this);
+    backend::detach(*self);
 
     if (!INATIVE(*self))
         INATIVE(*self) = json_object();
@@ -838,6 +1511,7 @@ void
 modifiers_interface<Derived, Backend>::insert_helper (string_view const & key, std::intmax_t n)
 {
     auto self = static_cast<Derived *>(this);
+    backend::detach(*self);
 
     if (!INATIVE(*self))
         INATIVE(*self) = json_object();
@@ -853,6 +1527,7 @@ void
 modifiers_interface<Derived, Backend>::insert_helper (string_view const & key, double n)
 {
     auto self = static_cast<Derived *>(this);
+    backend::detach(*self);
 
     if (!INATIVE(*self))
         INATIVE(*self) = json_object();
@@ -868,6 +1543,7 @@ void
 modifiers_interface<Derived, Backend>::insert_helper (string_view const & key, string_view const & s)
 {
     auto self = static_cast<Derived *>(this);
+    backend::detach(*self);
 
     if (!INATIVE(*self))
         INATIVE(*self) = json_object();
@@ -884,6 +1560,8 @@ modifiers_interface<Derived, Backend>::insert_helper (string_view const & key
     , value_type const & value)
 {
     auto self = static_cast<Derived *>(this);
+    backend::detach(*self);
+    backend::check_scope(INATIVE(*self));
 
     if (!value)
         throw error {make_error_code(std::errc::invalid_argument), tr::_("attempt to insert unitialized value")};
@@ -916,6 +1594,8 @@ void
 modifiers_interface<Derived, Backend>::insert (key_type const & key, value_type && value)
 {
     auto self = static_cast<Derived *>(this);
+    backend::detach(*self);
+    backend::check_scope(INATIVE(*self));
 
     if (!value)
         throw error {make_error_code(std::errc::invalid_argument), tr::_("attempt to insert unitialized value")};
@@ -926,6 +1606,9 @@ modifiers_interface<Derived, Backend>::insert (key_type const & key, value_type
     if (!json_is_object(INATIVE(*self)))
         throw error {make_error_code(errc::incopatible_type), tr::_("object expected")};
 
+    backend::detach(value);
+    backend::adopt(INATIVE(*self), NATIVE(value));
+
     auto rc = json_object_setn_new_nocheck(INATIVE(*self)
         , key.c_str()
         , key.size()
@@ -945,6 +1628,7 @@ void
 modifiers_interface<Derived, Backend>::push_back_helper (std::nullptr_t)
 {
     auto self = static_cast<Derived *>(this);
+    backend::detach(*self);
 
     if (!INATIVE(*self))
         INATIVE(*self) = json_array();
@@ -960,6 +1644,7 @@ void
 modifiers_interface<Derived, Backend>::push_back_helper (bool b)
 {
     auto self = static_cast<Derived *>(this);
+    backend::detach(*self);
 
     if (!INATIVE(*self))
         INATIVE(*self) = json_array();
@@ -975,6 +1660,7 @@ void
 modifiers_interface<Derived, Backend>::push_back_helper (std::intmax_t n)
 {
     auto self = static_cast<Derived *>(this);
+    backend::detach(*self);
 
     if (!INATIVE(*self))
         INATIVE(*self) = json_array();
@@ -990,6 +1676,7 @@ void
 modifiers_interface<Derived, Backend>::push_back_helper (double n)
 {
     auto self = static_cast<Derived *>(this);
+    backend::detach(*self);
 
     if (!INATIVE(*self))
         INATIVE(*self) = json_array();
@@ -1005,6 +1692,7 @@ void
 modifiers_interface<Derived, Backend>::push_back_helper (string_view const & s)
 {
     auto self = static_cast<Derived *>(this);
+    backend::detach(*self);
 
     if (!INATIVE(*self))
         INATIVE(*self) = json_array();
@@ -1020,6 +1708,8 @@ void
 modifiers_interface<Derived, Backend>::push_back_helper (value_type const & value)
 {
     auto self = static_cast<Derived *>(this);
+    backend::detach(*self);
+    backend::check_scope(INATIVE(*self));
 
     if (!value)
         throw error {make_error_code(std::errc::invalid_argument), tr::_("attempt to add unitialized value")};
@@ -1049,6 +1739,8 @@ void
 modifiers_interface<Derived, Backend>::push_back (value_type && value)
 {
     auto self = static_cast<Derived *>(this);
+    backend::detach(*self);
+    backend::check_scope(INATIVE(*self));
 
     if (!value)
         throw error {make_error_code(std::errc::invalid_argument), tr::_("attempt to add unitialized value")};
@@ -1059,6 +1751,9 @@ modifiers_interface<Derived, Backend>::push_back (value_type && value)
     if (!json_is_array(INATIVE(*self)))
         throw error {make_error_code(errc::incopatible_type), tr::_("array expected")};
 
+    backend::detach(value);
+    backend::adopt(INATIVE(*self), NATIVE(value));
+
     auto rc = json_array_append_new(INATIVE(*self), NATIVE(value));
 
     if (rc != 0)
@@ -1094,17 +1789,11 @@ capacity_interface<Derived, Backend>::size () const noexcept
 
 template capacity_interface<JSON, BACKEND>::size_type capacity_interface<JSON, BACKEND>::size () const noexcept;
 template capacity_interface<JSON_REF, BACKEND>::size_type capacity_interface<JSON_REF, BACKEND>::size () const noexcept;
+template capacity_interface<JSON_VIEW, BACKEND>::size_type capacity_interface<JSON_VIEW, BACKEND>::size () const noexcept;
 
 ////////////////////////////////////////////////////////////////////////////////
 // Converter interface
 ////////////////////////////////////////////////////////////////////////////////
-static int json_dump_callback (char const * buffer, size_t size, void * data)
-{
-    auto output = static_cast<std::string *>(data);
-    *output += std::string(buffer, size);
-    return 0;
-}
-
 template <typename Derived>
 std::string
 converter_interface<Derived>::to_string () const
@@ -1114,8 +1803,20 @@ converter_interface<Derived>::to_string () const
     auto self = static_cast<Derived const *>(this);
 
     if (CINATIVE(*self)) {
-        auto rc = json_dump_callback(CINATIVE(*self)
-            , json_dump_callback, & result, JSON_COMPACT | JSON_ENCODE_ANY);
+        instrumentation::call_record record {instrumentation::operation::to_string};
+        int rc = 0;
+
+        {
+            instrumentation::phase_timer timer {instrumentation::phase::dump};
+            rc = backend::native_dump(CINATIVE(*self), JSON_COMPACT | JSON_ENCODE_ANY, result);
+        }
+
+        if (auto r = record.get()) {
+            record.stop();
+            r->bytes_out = result.size();
+            r->failures += rc != 0 ? 1 : 0;
+            backend::collect_node_stats(CINATIVE(*self), *r);
+        }
 
         if (rc != 0)
             throw error {make_error_code(pfs::errc::backend_error), tr::_("stringification failure")};
@@ -1126,6 +1827,7 @@ converter_interface<Derived>::to_string () const
 
 template std::string converter_interface<JSON>::to_string () const;
 template std::string converter_interface<JSON_REF>::to_string () const;
+template std::string converter_interface<JSON_VIEW>::to_string () const;
 
 ////////////////////////////////////////////////////////////////////////////////
 // Encoder / Decoder
@@ -1186,42 +1888,6 @@ decoder<std::nullptr_t>::operator () (std::size_t, bool, bool *) const noexcept
 //------------------------------------------------------------------------------
 // bool
 //------------------------------------------------------------------------------
-template <>
-bool
-decoder<bool>::operator () () const noexcept
-{
-    return false;
-}
-
-template <>
-bool
-decoder<bool>::operator () (std::nullptr_t, bool *) const noexcept
-{
-    return false;
-}
-
-template <>
-bool
-decoder<bool>::operator () (bool v, bool *) const noexcept
-{
-    return v;
-}
-
-template <>
-bool
-decoder<bool>::operator () (std::intmax_t v, bool *) const noexcept
-{
-    return static_cast<bool>(v);
-}
-
-template <>
-bool
-decoder<bool>::operator () (double v, bool *) const noexcept
-{
-    return static_cast<bool>(v);
-}
-
-template <>
 bool
 decoder<bool>::operator () (string_view const & v, bool * success) const noexcept
 {
@@ -1238,58 +1904,9 @@ decoder<bool>::operator () (string_view const & v, bool * success) const noexcep
     return this->operator() ();
 }
 
-template <>
-bool
-decoder<bool>::operator () (std::size_t size, bool, bool *) const noexcept
-{
-    return size > 0;
-}
-
 //------------------------------------------------------------------------------
 // std::intmax_t
 //------------------------------------------------------------------------------
-template <>
-std::intmax_t
-decoder<std::intmax_t>::operator () () const noexcept
-{
-    return 0;
-}
-
-template <>
-std::intmax_t
-decoder<std::intmax_t>::operator () (std::nullptr_t, bool *) const noexcept
-{
-    return 0;
-}
-
-template <>
-std::intmax_t
-decoder<std::intmax_t>::operator () (bool v, bool *) const noexcept
-{
-    return v ? 1 : 0;
-}
-
-template <>
-std::intmax_t
-decoder<std::intmax_t>::operator () (std::intmax_t v, bool *) const noexcept
-{
-    return v;
-}
-
-template <>
-std::intmax_t
-decoder<std::intmax_t>::operator () (double v, bool * success) const noexcept
-{
-    if (v >= static_cast<double>((std::numeric_limits<std::intmax_t>::min)())
-            && v <= static_cast<double>((std::numeric_limits<std::intmax_t>::max)())) {
-        return static_cast<std::intmax_t>(v);
-    }
-
-    *success = false;
-    return this->operator()();
-}
-
-template <>
 std::intmax_t
 decoder<std::intmax_t>::operator () (string_view const & v, bool * success) const noexcept
 {
@@ -1314,52 +1931,9 @@ decoder<std::intmax_t>::operator () (string_view const & v, bool * success) cons
     return this->operator()();
 }
 
-template <>
-std::intmax_t
-decoder<std::intmax_t>::operator () (std::size_t size, bool, bool *) const noexcept
-{
-    return static_cast<std::intmax_t>(size);
-}
-
 //------------------------------------------------------------------------------
 // double
 //------------------------------------------------------------------------------
-template <>
-double
-decoder<double>::operator () () const noexcept
-{
-    return 0.0;
-}
-
-template <>
-double
-decoder<double>::operator () (std::nullptr_t, bool *) const noexcept
-{
-    return 0.0;
-}
-
-template <>
-double
-decoder<double>::operator () (bool v, bool *) const noexcept
-{
-    return v ? 1.0 : 0.0;
-}
-
-template <>
-double
-decoder<double>::operator () (std::intmax_t v, bool *) const noexcept
-{
-    return static_cast<double>(v);
-}
-
-template <>
-double
-decoder<double>::operator () (double v, bool *) const noexcept
-{
-    return v;
-}
-
-template <>
 double
 decoder<double>::operator () (string_view const & v, bool * success) const noexcept
 {
@@ -1378,13 +1952,6 @@ decoder<double>::operator () (string_view const & v, bool * success) const noexc
     return this->operator()();
 }
 
-template <>
-double
-decoder<double>::operator () (std::size_t size, bool, bool *) const noexcept
-{
-    return static_cast<double>(size);
-}
-
 //------------------------------------------------------------------------------
 // std::string
 //------------------------------------------------------------------------------
@@ -1442,9 +2009,10 @@ decoder<std::string>::operator () (std::size_t size, bool, bool *) const noexcep
 ////////////////////////////////////////////////////////////////////////////////
 template <>
 mutable_element_accessor_interface<JSON, BACKEND>::reference
-mutable_element_accessor_interface<JSON, BACKEND>::operator [] (size_type pos) noexcept
+mutable_element_accessor_interface<JSON, BACKEND>::operator [] (size_type pos)
 {
     auto self = static_cast<JSON *>(this);
+    backend::detach(*self);
 
     if (!INATIVE(*self))
         backend::assign(*static_cast<BACKEND::rep *>(self), json_array());
@@ -1456,6 +2024,8 @@ mutable_element_accessor_interface<JSON, BACKEND>::operator [] (size_type pos) n
         return reference{};
 
     if (pos >= json_array_size(INATIVE(*self))) {
+        backend::check_scope(INATIVE(*self));
+
         // Fill with null values
         while (json_array_size(INATIVE(*self)) <= pos) {
             auto rc = json_array_append_new(INATIVE(*self), json_null());
@@ -1468,14 +2038,16 @@ mutable_element_accessor_interface<JSON, BACKEND>::operator [] (size_type pos) n
     if (!ptr)
         return reference{};
 
+    backend::leak(*self);
     return reference{BACKEND::ref{ptr, INATIVE(*self), pos}};
 }
 
 template <>
 mutable_element_accessor_interface<JSON, BACKEND>::reference
-mutable_element_accessor_interface<JSON, BACKEND>::operator [] (string_view key) noexcept
+mutable_element_accessor_interface<JSON, BACKEND>::operator [] (string_view key)
 {
     auto self = static_cast<JSON *>(this);
+    backend::detach(*self);
 
     if (!INATIVE(*self))
         backend::assign(*static_cast<BACKEND::rep *>(self), json_object());
@@ -1486,29 +2058,33 @@ mutable_element_accessor_interface<JSON, BACKEND>::operator [] (string_view key)
     if (!json_is_object(INATIVE(*self)))
         return reference{};
 
-    // Return borrowed reference.
-    auto ptr = json_object_getn(INATIVE(*self), key.data(), key.length());
+    auto iter = backend::object_iter(INATIVE(*self), key);
 
     // Not found, insert new `null` element
-    if (!ptr) {
+    if (!iter) {
+        backend::check_scope(INATIVE(*self));
+
         auto rc = json_object_setn_new_nocheck(INATIVE(*self)
             , key.data(), key.length(), json_null());
 
         if (rc != 0)
             return reference{};
 
-        // Return borrowed reference.
-        ptr = json_object_getn(INATIVE(*self), key.data(), key.length());
+        iter = backend::object_iter(INATIVE(*self), key);
 
-        PFS__ASSERT(ptr, "");
+        PFS__ASSERT(iter, "");
     }
 
-    return reference{BACKEND::ref{ptr, INATIVE(*self), key_type(key.data(), key.length())}};
+    // Return borrowed reference.
+    auto ptr = json_object_iter_value(iter);
+
+    backend::leak(*self);
+    return reference{BACKEND::ref{ptr, INATIVE(*self), iter}};
 }
 
 template <>
 mutable_element_accessor_interface<JSON_REF, BACKEND>::reference
-mutable_element_accessor_interface<JSON_REF, BACKEND>::operator [] (size_type pos) noexcept
+mutable_element_accessor_interface<JSON_REF, BACKEND>::operator [] (size_type pos)
 {
     auto self = static_cast<JSON_REF *>(this);
 
@@ -1522,6 +2098,8 @@ mutable_element_accessor_interface<JSON_REF, BACKEND>::operator [] (size_type po
         return reference{};
 
     if (pos >= json_array_size(INATIVE(*self))) {
+        backend::check_scope(INATIVE(*self));
+
         // Fill with null values
         while (json_array_size(INATIVE(*self)) <= pos) {
             auto rc = json_array_append_new(INATIVE(*self), json_null());
@@ -1539,7 +2117,7 @@ mutable_element_accessor_interface<JSON_REF, BACKEND>::operator [] (size_type po
 
 template <>
 mutable_element_accessor_interface<JSON_REF, BACKEND>::reference
-mutable_element_accessor_interface<JSON_REF, BACKEND>::operator [] (string_view key) noexcept
+mutable_element_accessor_interface<JSON_REF, BACKEND>::operator [] (string_view key)
 {
     auto self = static_cast<JSON_REF *>(this);
 
@@ -1552,24 +2130,27 @@ mutable_element_accessor_interface<JSON_REF, BACKEND>::operator [] (string_view
     if (!json_is_object(INATIVE(*self)))
         return reference{};
 
-    // Return borrowed reference.
-    auto ptr = json_object_getn(INATIVE(*self), key.data(), key.length());
+    auto iter = backend::object_iter(INATIVE(*self), key);
 
     // Not found, insert new `null` element
-    if (!ptr) {
+    if (!iter) {
+        backend::check_scope(INATIVE(*self));
+
         auto rc = json_object_setn_new_nocheck(INATIVE(*self)
             , key.data(), key.length(), json_null());
 
         if (rc != 0)
             return reference{};
 
-        // Return borrowed reference.
-        ptr = json_object_getn(INATIVE(*self), key.data(), key.length());
+        iter = backend::object_iter(INATIVE(*self), key);
 
-        PFS__ASSERT(ptr, "");
+        PFS__ASSERT(iter, "");
     }
 
-    return reference{BACKEND::ref{ptr, INATIVE(*self), key_type(key.data(), key.length())}};
+    // Return borrowed reference.
+    auto ptr = json_object_iter_value(iter);
+
+    return reference{BACKEND::ref{ptr, INATIVE(*self), iter}};
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1610,20 +2191,20 @@ element_accessor_interface<Derived, Backend>::operator [] (string_view key) cons
     if (!CINATIVE(*self) || !json_is_object(CINATIVE(*self)))
         return reference{};
 
-    auto ptr = json_object_getn(CINATIVE(*self), key.data(), key.length());
+    auto iter = backend::object_iter(CINATIVE(*self), key);
 
     // Not found
-    if (!ptr)
+    if (!iter)
         return reference{};
 
-    return reference{BACKEND::ref{ptr, CINATIVE(*self), key_type(key.data(), key.length())}};
+    return reference{BACKEND::ref{json_object_iter_value(iter), CINATIVE(*self), iter}};
 }
 
 template element_accessor_interface<JSON, BACKEND>::const_reference element_accessor_interface<JSON, BACKEND>::operator [] (string_view key) const noexcept;
 template element_accessor_interface<JSON_REF, BACKEND>::const_reference element_accessor_interface<JSON_REF, BACKEND>::operator [] (string_view key) const noexcept;
 
 template <typename Derived, typename Backend>
-typename element_accessor_interface<Derived, Backend>::reference
+typename element_accessor_interface<Derived, Backend>::const_reference
 element_accessor_interface<Derived, Backend>::at (size_type pos) const
 {
     auto self = static_cast<Derived const *>(this);
@@ -1643,11 +2224,23 @@ element_accessor_interface<Derived, Backend>::at (size_type pos) const
     return reference{BACKEND::ref{ptr, CINATIVE(*self), pos}};
 }
 
-template element_accessor_interface<JSON, BACKEND>::reference element_accessor_interface<JSON, BACKEND>::at (size_type pos) const;
-template element_accessor_interface<JSON_REF, BACKEND>::reference element_accessor_interface<JSON_REF, BACKEND>::at (size_type pos) const;
+template element_accessor_interface<JSON, BACKEND>::const_reference element_accessor_interface<JSON, BACKEND>::at (size_type pos) const;
+template element_accessor_interface<JSON_REF, BACKEND>::const_reference element_accessor_interface<JSON_REF, BACKEND>::at (size_type pos) const;
 
 template <typename Derived, typename Backend>
 typename element_accessor_interface<Derived, Backend>::reference
+element_accessor_interface<Derived, Backend>::at (size_type pos)
+{
+    auto self = static_cast<Derived *>(this);
+    backend::leak(*self);
+    return static_cast<element_accessor_interface const *>(this)->at(pos);
+}
+
+template element_accessor_interface<JSON, BACKEND>::reference element_accessor_interface<JSON, BACKEND>::at (size_type pos);
+template element_accessor_interface<JSON_REF, BACKEND>::reference element_accessor_interface<JSON_REF, BACKEND>::at (size_type pos);
+
+template <typename Derived, typename Backend>
+typename element_accessor_interface<Derived, Backend>::const_reference
 element_accessor_interface<Derived, Backend>::at (string_view key) const
 {
     auto self = static_cast<Derived const *>(this);
@@ -1655,20 +2248,31 @@ element_accessor_interface<Derived, Backend>::at (string_view key) const
     if (!CINATIVE(*self) || !json_is_object(CINATIVE(*self)))
         throw error {make_error_code(errc::incopatible_type), tr::_("object expected")};
 
-    auto ptr = json_object_getn(CINATIVE(*self), key.data(), key.length());
+    auto iter = backend::object_iter(CINATIVE(*self), key);
 
-    if (!ptr)
+    if (!iter)
         throw error {
               make_error_code(std::errc::invalid_argument)
             , tr::f_("bad key: {}", pfs::to_string(key))
         };
 
-    return reference{BACKEND::ref{ptr, CINATIVE(*self)
-        , key_type(key.data(), key.length())}};
+    return reference{BACKEND::ref{json_object_iter_value(iter), CINATIVE(*self), iter}};
+}
+
+template element_accessor_interface<JSON, BACKEND>::const_reference element_accessor_interface<JSON, BACKEND>::at (string_view key) const;
+template element_accessor_interface<JSON_REF, BACKEND>::const_reference element_accessor_interface<JSON_REF, BACKEND>::at (string_view key) const;
+
+template <typename Derived, typename Backend>
+typename element_accessor_interface<Derived, Backend>::reference
+element_accessor_interface<Derived, Backend>::at (string_view key)
+{
+    auto self = static_cast<Derived *>(this);
+    backend::leak(*self);
+    return static_cast<element_accessor_interface const *>(this)->at(key);
 }
 
-template element_accessor_interface<JSON, BACKEND>::reference element_accessor_interface<JSON, BACKEND>::at (string_view key) const;
-template element_accessor_interface<JSON_REF, BACKEND>::reference element_accessor_interface<JSON_REF, BACKEND>::at (string_view key) const;
+template element_accessor_interface<JSON, BACKEND>::reference element_accessor_interface<JSON, BACKEND>::at (string_view key);
+template element_accessor_interface<JSON_REF, BACKEND>::reference element_accessor_interface<JSON_REF, BACKEND>::at (string_view key);
 
 template <typename Derived, typename Backend>
 bool
@@ -1701,6 +2305,7 @@ getter_interface<Derived, Backend>::bool_value () const noexcept
 
 template bool getter_interface<JSON, BACKEND>::bool_value () const noexcept;
 template bool getter_interface<JSON_REF, BACKEND>::bool_value () const noexcept;
+template bool getter_interface<JSON_VIEW, BACKEND>::bool_value () const noexcept;
 
 template <typename Derived, typename Backend>
 std::intmax_t
@@ -1714,6 +2319,7 @@ getter_interface<Derived, Backend>::integer_value () const noexcept
 
 template std::intmax_t getter_interface<JSON, BACKEND>::integer_value () const noexcept;
 template std::intmax_t getter_interface<JSON_REF, BACKEND>::integer_value () const noexcept;
+template std::intmax_t getter_interface<JSON_VIEW, BACKEND>::integer_value () const noexcept;
 
 template <typename Derived, typename Backend>
 double
@@ -1727,6 +2333,7 @@ getter_interface<Derived, Backend>::real_value () const noexcept
 
 template double getter_interface<JSON, BACKEND>::real_value () const noexcept;
 template double getter_interface<JSON_REF, BACKEND>::real_value () const noexcept;
+template double getter_interface<JSON_VIEW, BACKEND>::real_value () const noexcept;
 
 template <typename Derived, typename Backend>
 string_view
@@ -1741,6 +2348,7 @@ getter_interface<Derived, Backend>::string_value () const noexcept
 
 template string_view getter_interface<JSON, BACKEND>::string_value () const noexcept;
 template string_view getter_interface<JSON_REF, BACKEND>::string_value () const noexcept;
+template string_view getter_interface<JSON_VIEW, BACKEND>::string_value () const noexcept;
 
 template <typename Derived, typename Backend>
 std::size_t
@@ -1754,6 +2362,7 @@ getter_interface<Derived, Backend>::array_size () const noexcept
 
 template std::size_t getter_interface<JSON, BACKEND>::array_size () const noexcept;
 template std::size_t getter_interface<JSON_REF, BACKEND>::array_size () const noexcept;
+template std::size_t getter_interface<JSON_VIEW, BACKEND>::array_size () const noexcept;
 
 template <typename Derived, typename Backend>
 std::size_t
@@ -1767,6 +2376,7 @@ getter_interface<Derived, Backend>::object_size () const noexcept
 
 template std::size_t getter_interface<JSON, BACKEND>::object_size () const noexcept;
 template std::size_t getter_interface<JSON_REF, BACKEND>::object_size () const noexcept;
+template std::size_t getter_interface<JSON_VIEW, BACKEND>::object_size () const noexcept;
 
 ////////////////////////////////////////////////////////////////////////////////
 // Algorithm interface
@@ -1781,15 +2391,14 @@ algorithm_interface<Derived, Backend>::for_each (std::function<void (reference)>
         return;
 
     if (json_is_object(CINATIVE(*self))) {
-        char const * key;
-        json_t * ptr;
+        auto obj = CINATIVE(*self);
 
-        json_object_foreach (CINATIVE(*self), key, ptr) {
+        for (auto iter = json_object_iter(obj); iter != nullptr; iter = json_object_iter_next(obj, iter)) {
             f(reference{
                 typename Backend::ref{
-                      ptr
-                    , CINATIVE(*self)
-                    , std::string(key)
+                      json_object_iter_value(iter)
+                    , obj
+                    , iter
                 }
             });
         }
@@ -1817,9 +2426,10 @@ template void algorithm_interface<JSON_REF, BACKEND>::for_each (std::function<vo
 ////////////////////////////////////////////////////////////////////////////////
 template <typename Derived, typename Backend>
 typename iterator_interface<Derived, Backend>::iterator
-iterator_interface<Derived, Backend>::begin () noexcept
+iterator_interface<Derived, Backend>::begin ()
 {
     auto self = static_cast<Derived *>(this);
+    backend::leak(*self);
 
     PFS__TERMINATE(INATIVE(*self), "iterator_interface::begin(): null pointer");
 
@@ -1851,17 +2461,18 @@ iterator_interface<Derived, Backend>::begin () const noexcept
     return it;
 }
 
-template iterator_interface<JSON, BACKEND>::iterator iterator_interface<JSON, BACKEND>::begin () noexcept;
+template iterator_interface<JSON, BACKEND>::iterator iterator_interface<JSON, BACKEND>::begin ();
 template iterator_interface<JSON, BACKEND>::const_iterator iterator_interface<JSON, BACKEND>::begin () const noexcept;
-template iterator_interface<JSON_REF, BACKEND>::iterator iterator_interface<JSON_REF, BACKEND>::begin () noexcept;
+template iterator_interface<JSON_REF, BACKEND>::iterator iterator_interface<JSON_REF, BACKEND>::begin ();
 template iterator_interface<JSON_REF, BACKEND>::const_iterator iterator_interface<JSON_REF, BACKEND>::begin () const noexcept;
 
 template <typename Derived, typename Backend>
 typename iterator_interface<Derived, Backend>::iterator
-iterator_interface<Derived, Backend>::end () noexcept
+iterator_interface<Derived, Backend>::end ()
 {
     iterator it;
     auto self = static_cast<Derived *>(this);
+    backend::leak(*self);
 
     PFS__TERMINATE(INATIVE(*self), "iterator_interface::end(): null pointer");
 
@@ -1900,9 +2511,9 @@ iterator_interface<Derived, Backend>::end () const noexcept
     return it;
 }
 
-template iterator_interface<JSON, BACKEND>::iterator iterator_interface<JSON, BACKEND>::end () noexcept;
+template iterator_interface<JSON, BACKEND>::iterator iterator_interface<JSON, BACKEND>::end ();
 template iterator_interface<JSON, BACKEND>::const_iterator iterator_interface<JSON, BACKEND>::end () const noexcept;
-template iterator_interface<JSON_REF, BACKEND>::iterator iterator_interface<JSON_REF, BACKEND>::end () noexcept;
+template iterator_interface<JSON_REF, BACKEND>::iterator iterator_interface<JSON_REF, BACKEND>::end ();
 template iterator_interface<JSON_REF, BACKEND>::const_iterator iterator_interface<JSON_REF, BACKEND>::end () const noexcept;
 
 template <typename ValueType, typename RefType, typename Backend>
@@ -1926,6 +2537,7 @@ bool basic_iterator<ValueType, RefType, Backend>::equals (basic_iterator<ValueTy
 
 template bool basic_iterator<JSON, JSON_REF, BACKEND>::equals (basic_iterator<JSON, JSON_REF, BACKEND> const & ) const;
 template bool basic_iterator<JSON const, JSON_REF const, BACKEND>::equals (basic_iterator<JSON const, JSON_REF const, BACKEND> const & ) const;
+template bool basic_iterator<JSON_VIEW const, JSON_VIEW, BACKEND>::equals (basic_iterator<JSON_VIEW const, JSON_VIEW, BACKEND> const & ) const;
 
 template <typename ValueType, typename RefType, typename Backend>
 typename basic_iterator<ValueType, RefType, Backend>::reference
@@ -1936,10 +2548,8 @@ basic_iterator<ValueType, RefType, Backend>::ref ()
             throw error {make_error_code(std::errc::result_out_of_range)};
 
         json_t * ptr = json_object_iter_value(this->_iter);
-        char const * key = json_object_iter_key(this->_iter);
-        auto key_length = json_object_iter_key_len(this->_iter);
 
-        return reference{BACKEND::ref{ptr, this->_parent, BACKEND::key_type(key, key_length)}};
+        return reference{BACKEND::ref{ptr, this->_parent, this->_iter}};
     } else if (json_is_array(this->_parent)) {
         auto ptr = json_array_get(this->_parent, this->_index);
 
@@ -1958,6 +2568,30 @@ basic_iterator<ValueType, RefType, Backend>::ref ()
 template basic_iterator<JSON, JSON_REF, BACKEND>::reference basic_iterator<JSON, JSON_REF, BACKEND>::ref ();
 template basic_iterator<JSON const, JSON_REF const, BACKEND>::reference basic_iterator<JSON const, JSON_REF const, BACKEND>::ref ();
 
+template <>
+basic_iterator<JSON_VIEW const, JSON_VIEW, BACKEND>::reference
+basic_iterator<JSON_VIEW const, JSON_VIEW, BACKEND>::ref ()
+{
+    if (json_is_object(this->_parent)) {
+        if (this->_iter == nullptr)
+            throw error {make_error_code(std::errc::result_out_of_range)};
+
+        return backend::make_view(json_object_iter_value(this->_iter));
+    } else if (json_is_array(this->_parent)) {
+        auto ptr = json_array_get(this->_parent, this->_index);
+
+        if (!ptr)
+            throw error {make_error_code(std::errc::result_out_of_range)};
+
+        return backend::make_view(ptr);
+    }/* else { */
+        if (this->_index > 0)
+            throw error {make_error_code(std::errc::result_out_of_range)};
+
+        return backend::make_view(this->_parent);
+    /* } */
+}
+
 template <typename ValueType, typename RefType, typename Backend>
 void basic_iterator<ValueType, RefType, Backend>::increment (difference_type)
 {
@@ -1981,6 +2615,7 @@ void basic_iterator<ValueType, RefType, Backend>::increment (difference_type)
 
 template void basic_iterator<JSON, JSON_REF, BACKEND>::increment (difference_type);
 template void basic_iterator<JSON const, JSON_REF const, BACKEND>::increment (difference_type);
+template void basic_iterator<JSON_VIEW const, JSON_VIEW, BACKEND>::increment (difference_type);
 
 template <typename ValueType, typename RefType, typename Backend>
 void basic_iterator<ValueType, RefType, Backend>::decrement (difference_type)
@@ -2002,6 +2637,7 @@ void basic_iterator<ValueType, RefType, Backend>::decrement (difference_type)
 
 template void basic_iterator<JSON, JSON_REF, BACKEND>::decrement (difference_type);
 template void basic_iterator<JSON const, JSON_REF const, BACKEND>::decrement (difference_type);
+template void basic_iterator<JSON_VIEW const, JSON_VIEW, BACKEND>::decrement (difference_type);
 
 template <typename ValueType, typename RefType, typename Backend>
 bool basic_iterator<ValueType, RefType, Backend>::decrement_support () const
@@ -2014,6 +2650,7 @@ bool basic_iterator<ValueType, RefType, Backend>::decrement_support () const
 
 template bool basic_iterator<JSON, JSON_REF, BACKEND>::decrement_support () const;
 template bool basic_iterator<JSON const, JSON_REF const, BACKEND>::decrement_support () const;
+template bool basic_iterator<JSON_VIEW const, JSON_VIEW, BACKEND>::decrement_support () const;
 
 template <typename ValueType, typename RefType, typename Backend>
 typename basic_iterator<ValueType, RefType, Backend>::key_type
@@ -2032,5 +2669,130 @@ basic_iterator<ValueType, RefType, Backend>::key () const
 
 template basic_iterator<JSON, JSON_REF, BACKEND>::key_type basic_iterator<JSON, JSON_REF, BACKEND>::key () const;
 template basic_iterator<JSON const, JSON_REF const, BACKEND>::key_type basic_iterator<JSON const, JSON_REF const, BACKEND>::key () const;
+template basic_iterator<JSON_VIEW const, JSON_VIEW, BACKEND>::key_type basic_iterator<JSON_VIEW const, JSON_VIEW, BACKEND>::key () const;
+
+////////////////////////////////////////////////////////////////////////////////
+// JSON view
+////////////////////////////////////////////////////////////////////////////////
+static_assert(std::is_trivially_copyable<JSON_VIEW>::value, "JSON view must be trivially copyable");
+
+template <>
+json_view<BACKEND>::json_view (json<BACKEND> const & j) noexcept
+    : json_view(backend::make_view(CINATIVE(j)))
+{}
+
+template <>
+json_view<BACKEND>::json_view (json_ref<BACKEND> const & j) noexcept
+    : json_view(backend::make_view(CINATIVE(j)))
+{}
+
+template <>
+json_view<BACKEND>::operator bool () const noexcept
+{
+    return NATIVE(*this) != nullptr;
+}
+
+template <>
+json_view<BACKEND>
+json_view<BACKEND>::operator [] (size_type pos) const noexcept
+{
+    if (_type != JSON_ARRAY)
+        return json_view{};
+
+    return backend::make_view(json_array_get(NATIVE(*this), pos));
+}
+
+template <>
+json_view<BACKEND>
+json_view<BACKEND>::operator [] (string_view key) const noexcept
+{
+    if (_type != JSON_OBJECT)
+        return json_view{};
+
+    return backend::make_view(json_object_getn(NATIVE(*this), key.data(), key.length()));
+}
+
+template <>
+json_view<BACKEND>
+json_view<BACKEND>::at (size_type pos) const
+{
+    if (_type != JSON_ARRAY)
+        throw error {make_error_code(errc::incopatible_type), tr::_("array expected")};
+
+    auto ptr = json_array_get(NATIVE(*this), pos);
+
+    if (!ptr) {
+        throw error {
+              make_error_code(std::errc::invalid_argument)
+            , tr::f_("index is out of bounds: {}", pos)
+        };
+    }
+
+    return backend::make_view(ptr);
+}
+
+template <>
+json_view<BACKEND>
+json_view<BACKEND>::at (string_view key) const
+{
+    if (_type != JSON_OBJECT)
+        throw error {make_error_code(errc::incopatible_type), tr::_("object expected")};
+
+    auto ptr = json_object_getn(NATIVE(*this), key.data(), key.length());
+
+    if (!ptr)
+        throw error {
+              make_error_code(std::errc::invalid_argument)
+            , tr::f_("bad key: {}", pfs::to_string(key))
+        };
+
+    return backend::make_view(ptr);
+}
+
+template <>
+bool
+json_view<BACKEND>::contains (string_view key) const
+{
+    if (_type != JSON_OBJECT)
+        return false;
+
+    return json_object_getn(NATIVE(*this), key.data(), key.length()) != nullptr;
+}
+
+template <>
+json_view<BACKEND>::iterator
+json_view<BACKEND>::begin () const noexcept
+{
+    PFS__TERMINATE(NATIVE(*this), "json_view::begin(): null pointer");
+
+    iterator it;
+    it._parent = NATIVE(*this);
+    it._index = 0;
+
+    if (_type == JSON_OBJECT)
+        it._iter = json_object_iter(it._parent);
+
+    return it;
+}
+
+template <>
+json_view<BACKEND>::iterator
+json_view<BACKEND>::end () const noexcept
+{
+    PFS__TERMINATE(NATIVE(*this), "json_view::end(): null pointer");
+
+    iterator it;
+    it._parent = NATIVE(*this);
+
+    if (_type == JSON_OBJECT) {
+        it._iter = nullptr;
+    } else if (_type == JSON_ARRAY) {
+        it._index = json_array_size(NATIVE(*this));
+    } else {
+        it._index = 1;
+    }
+
+    return it;
+}
 
 } // namespace jeyson
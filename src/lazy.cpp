@@ -0,0 +1,749 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `jeyson-lib`.
+//
+// Changelog:
+//      2026.10.15 Initial version.
+////////////////////////////////////////////////////////////////////////////////
+#include "jeyson/lazy.hpp"
+#include "jeyson/backend/jansson.hpp"
+#include "mapped_file.hpp"
+#include "structural_index.hpp"
+#include "structural_parser.hpp"
+#include <pfs/assert.hpp>
+#include <pfs/i18n.hpp>
+#include <jansson.h>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace jeyson {
+
+using BACKEND    = backend::jansson;
+using JSON       = json<BACKEND>;
+using LAZY_VALUE = lazy_value<BACKEND>;
+using LAZY_ITER  = lazy_iterator<BACKEND>;
+using LAZY_DOC   = lazy_document<BACKEND>;
+
+#define NATIVE(x) ((x)._ptr)
+
+using structural::parse_errc;
+
+////////////////////////////////////////////////////////////////////////////////
+// Tape
+////////////////////////////////////////////////////////////////////////////////
+class lazy_tape
+{
+public:
+    enum class kind: std::uint8_t
+    {
+        null, boolean, integer, real, string, array, object
+    };
+
+    // 16 bytes per value, object member key is a separate string entry
+    // preceding the value.
+    struct entry
+    {
+        kind type;
+        bool flag;             // Boolean value or string is in the unescaped strings buffer
+        std::uint32_t size;    // Number of elements/members or string length
+
+        union {
+            std::int64_t i;
+            double r;
+            std::uint64_t offset; // String offset in the source or in the buffer
+            std::uint64_t next;   // Tape position past the container
+        };
+    };
+
+public:
+    backend::mapped_file file;
+    std::string source_buffer;
+    char const * source {nullptr};
+    std::size_t source_size {0};
+    std::vector<entry> entries;
+    std::string strings;   // Unescaped strings
+
+public:
+    entry const & at (std::size_t pos) const noexcept
+    {
+        return entries[pos];
+    }
+
+    // Tape position past the value at @a pos
+    std::size_t next (std::size_t pos) const noexcept
+    {
+        auto const & e = entries[pos];
+        return e.type == kind::array || e.type == kind::object
+            ? static_cast<std::size_t>(e.next) : pos + 1;
+    }
+
+    string_view string (std::size_t pos) const noexcept
+    {
+        auto const & e = entries[pos];
+        auto base = e.flag ? strings.data() : source;
+        return string_view(base + e.offset, e.size);
+    }
+
+    parse_errc build (std::size_t & error_pos, int & line, int & column);
+};
+
+namespace {
+
+// Records parser events into the tape.
+class tape_builder
+{
+    lazy_tape & _tape;
+    std::vector<std::size_t> _scopes; // Tape positions of open containers
+
+public:
+    tape_builder (lazy_tape & tape)
+        : _tape(tape)
+    {}
+
+    parse_errc on_null ()
+    {
+        return add(lazy_tape::kind::null);
+    }
+
+    parse_errc on_bool (bool value)
+    {
+        return add(lazy_tape::kind::boolean, value);
+    }
+
+    parse_errc on_integer (std::int64_t value)
+    {
+        auto rc = add(lazy_tape::kind::integer);
+        _tape.entries.back().i = value;
+        return rc;
+    }
+
+    parse_errc on_real (double value)
+    {
+        auto rc = add(lazy_tape::kind::real);
+        _tape.entries.back().r = value;
+        return rc;
+    }
+
+    parse_errc on_string (char const * s, std::size_t n)
+    {
+        auto rc = add(lazy_tape::kind::string);
+        set_string(s, n);
+        return rc;
+    }
+
+    parse_errc on_key (char const * s, std::size_t n)
+    {
+        push(lazy_tape::kind::string);
+        set_string(s, n);
+        return parse_errc::success;
+    }
+
+    parse_errc on_begin_array ()
+    {
+        auto rc = add(lazy_tape::kind::array);
+        _scopes.push_back(_tape.entries.size() - 1);
+        return rc;
+    }
+
+    parse_errc on_begin_object ()
+    {
+        auto rc = add(lazy_tape::kind::object);
+        _scopes.push_back(_tape.entries.size() - 1);
+        return rc;
+    }
+
+    parse_errc on_end_array ()
+    {
+        return end_scope();
+    }
+
+    parse_errc on_end_object ()
+    {
+        return end_scope();
+    }
+
+private:
+    void push (lazy_tape::kind type, bool flag = false)
+    {
+        lazy_tape::entry e;
+        e.type = type;
+        e.flag = flag;
+        e.size = 0;
+        e.next = 0;
+        _tape.entries.push_back(e);
+    }
+
+    parse_errc add (lazy_tape::kind type, bool flag = false)
+    {
+        if (!_scopes.empty())
+            _tape.entries[_scopes.back()].size++;
+
+        push(type, flag);
+        return parse_errc::success;
+    }
+
+    parse_errc end_scope ()
+    {
+        _tape.entries[_scopes.back()].next = _tape.entries.size();
+        _scopes.pop_back();
+        return parse_errc::success;
+    }
+
+    // Strings without escapes point into the source, others into the parser buffer
+    void set_string (char const * s, std::size_t n)
+    {
+        auto & e = _tape.entries.back();
+        e.size = static_cast<std::uint32_t>(n);
+
+        if (s >= _tape.source && s <= _tape.source + _tape.source_size) {
+            e.offset = static_cast<std::uint64_t>(s - _tape.source);
+        } else {
+            e.flag = true;
+            e.offset = _tape.strings.size();
+            _tape.strings.append(s, n);
+        }
+    }
+};
+
+} // namespace
+
+parse_errc lazy_tape::build (std::size_t & error_pos, int & line, int & column)
+{
+    entries.clear();
+    strings.clear();
+
+    // Rough estimate: a value per 16 bytes of the source
+    entries.reserve(source_size / 16 + 1);
+
+    structural::index idx;
+    idx.build(source, source_size);
+
+    tape_builder builder {*this};
+    structural::parser<tape_builder> p {source, source_size, idx, builder};
+
+    auto rc = p.parse();
+
+    if (rc != parse_errc::success) {
+        error_pos = p.error_position();
+        p.location(error_pos, line, column);
+        entries.clear();
+        strings.clear();
+    }
+
+    return rc;
+}
+
+namespace {
+
+inline LAZY_VALUE::size_type member_count (lazy_tape const & t, std::size_t pos) noexcept
+{
+    return t.at(pos).size;
+}
+
+// Finds tape position of the value by key (the last one), zero if not found
+std::size_t find_member (lazy_tape const & t, std::size_t pos, string_view key) noexcept
+{
+    std::size_t result = 0;
+    auto end = t.next(pos);
+
+    for (auto p = pos + 1; p < end; p = t.next(p + 1)) {
+        if (t.string(p) == key)
+            result = p + 1;
+    }
+
+    return result;
+}
+
+// Finds tape position of the array element, zero if out of bounds
+std::size_t find_element (lazy_tape const & t, std::size_t pos, std::size_t index) noexcept
+{
+    if (index >= t.at(pos).size)
+        return 0;
+
+    auto p = pos + 1;
+
+    for (; index > 0; index--)
+        p = t.next(p);
+
+    return p;
+}
+
+json_t * materialize (lazy_tape const & t, std::size_t pos)
+{
+    auto const & e = t.at(pos);
+
+    switch (e.type) {
+        case lazy_tape::kind::null:
+            return json_null();
+
+        case lazy_tape::kind::boolean:
+            return e.flag ? json_true() : json_false();
+
+        case lazy_tape::kind::integer:
+            return json_integer(static_cast<json_int_t>(e.i));
+
+        case lazy_tape::kind::real:
+            return json_real(e.r);
+
+        case lazy_tape::kind::string: {
+            auto s = t.string(pos);
+            return json_stringn_nocheck(s.data(), s.size());
+        }
+
+        case lazy_tape::kind::array: {
+            auto result = json_array();
+            auto end = t.next(pos);
+
+            for (auto p = pos + 1; result && p < end; p = t.next(p)) {
+                auto value = materialize(t, p);
+
+                if (!value || json_array_append_new(result, value) != 0) {
+                    json_decref(result);
+                    result = nullptr;
+                }
+            }
+
+            return result;
+        }
+
+        case lazy_tape::kind::object: {
+            auto result = json_object();
+            auto end = t.next(pos);
+
+            for (auto p = pos + 1; result && p < end; p = t.next(p + 1)) {
+                auto key = t.string(p);
+                auto value = materialize(t, p + 1);
+
+                if (!value || json_object_setn_new_nocheck(result, key.data(), key.size(), value) != 0) {
+                    json_decref(result);
+                    result = nullptr;
+                }
+            }
+
+            return result;
+        }
+    }
+
+    return nullptr;
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+// Lazy value
+////////////////////////////////////////////////////////////////////////////////
+static_assert(std::is_trivially_copyable<LAZY_VALUE>::value, "lazy value must be trivially copyable");
+
+#define LAZY_KIND(self) ((self)->_tape->at((self)->_pos).type)
+
+template <>
+bool traits_interface<LAZY_VALUE>::is_null () const noexcept
+{
+    auto self = static_cast<LAZY_VALUE const *>(this);
+    return self->_tape && LAZY_KIND(self) == lazy_tape::kind::null;
+}
+
+template <>
+bool traits_interface<LAZY_VALUE>::is_bool () const noexcept
+{
+    auto self = static_cast<LAZY_VALUE const *>(this);
+    return self->_tape && LAZY_KIND(self) == lazy_tape::kind::boolean;
+}
+
+template <>
+bool traits_interface<LAZY_VALUE>::is_integer () const noexcept
+{
+    auto self = static_cast<LAZY_VALUE const *>(this);
+    return self->_tape && LAZY_KIND(self) == lazy_tape::kind::integer;
+}
+
+template <>
+bool traits_interface<LAZY_VALUE>::is_real () const noexcept
+{
+    auto self = static_cast<LAZY_VALUE const *>(this);
+    return self->_tape && LAZY_KIND(self) == lazy_tape::kind::real;
+}
+
+template <>
+bool traits_interface<LAZY_VALUE>::is_string () const noexcept
+{
+    auto self = static_cast<LAZY_VALUE const *>(this);
+    return self->_tape && LAZY_KIND(self) == lazy_tape::kind::string;
+}
+
+template <>
+bool traits_interface<LAZY_VALUE>::is_array () const noexcept
+{
+    auto self = static_cast<LAZY_VALUE const *>(this);
+    return self->_tape && LAZY_KIND(self) == lazy_tape::kind::array;
+}
+
+template <>
+bool traits_interface<LAZY_VALUE>::is_object () const noexcept
+{
+    auto self = static_cast<LAZY_VALUE const *>(this);
+    return self->_tape && LAZY_KIND(self) == lazy_tape::kind::object;
+}
+
+template <>
+capacity_interface<LAZY_VALUE, BACKEND>::size_type
+capacity_interface<LAZY_VALUE, BACKEND>::size () const noexcept
+{
+    auto self = static_cast<LAZY_VALUE const *>(this);
+
+    if (!self->_tape)
+        return 0;
+
+    if (self->is_structured())
+        return member_count(*self->_tape, self->_pos);
+
+    // Scalar types
+    return 1;
+}
+
+template <>
+bool getter_interface<LAZY_VALUE, BACKEND>::bool_value () const noexcept
+{
+    auto self = static_cast<LAZY_VALUE const *>(this);
+
+    PFS__ASSERT(self->is_bool(), "boolean value expected");
+    return self->_tape->at(self->_pos).flag;
+}
+
+template <>
+std::intmax_t getter_interface<LAZY_VALUE, BACKEND>::integer_value () const noexcept
+{
+    auto self = static_cast<LAZY_VALUE const *>(this);
+
+    PFS__ASSERT(self->is_integer(), "integer value expected");
+    return static_cast<std::intmax_t>(self->_tape->at(self->_pos).i);
+}
+
+template <>
+double getter_interface<LAZY_VALUE, BACKEND>::real_value () const noexcept
+{
+    auto self = static_cast<LAZY_VALUE const *>(this);
+
+    PFS__ASSERT(self->is_real(), "real value expected");
+    return self->_tape->at(self->_pos).r;
+}
+
+template <>
+string_view getter_interface<LAZY_VALUE, BACKEND>::string_value () const noexcept
+{
+    auto self = static_cast<LAZY_VALUE const *>(this);
+
+    PFS__ASSERT(self->is_string(), "string value expected");
+    return self->_tape->string(self->_pos);
+}
+
+template <>
+std::size_t getter_interface<LAZY_VALUE, BACKEND>::array_size () const noexcept
+{
+    auto self = static_cast<LAZY_VALUE const *>(this);
+
+    PFS__ASSERT(self->is_array(), "array expected");
+    return member_count(*self->_tape, self->_pos);
+}
+
+template <>
+std::size_t getter_interface<LAZY_VALUE, BACKEND>::object_size () const noexcept
+{
+    auto self = static_cast<LAZY_VALUE const *>(this);
+
+    PFS__ASSERT(self->is_object(), "object expected");
+    return member_count(*self->_tape, self->_pos);
+}
+
+template <>
+LAZY_VALUE LAZY_VALUE::operator [] (size_type pos) const noexcept
+{
+    if (!this->is_array())
+        return LAZY_VALUE{};
+
+    auto p = find_element(*_tape, _pos, pos);
+    return p ? LAZY_VALUE{_tape, p} : LAZY_VALUE{};
+}
+
+template <>
+LAZY_VALUE LAZY_VALUE::operator [] (string_view key) const noexcept
+{
+    if (!this->is_object())
+        return LAZY_VALUE{};
+
+    auto p = find_member(*_tape, _pos, key);
+    return p ? LAZY_VALUE{_tape, p} : LAZY_VALUE{};
+}
+
+template <>
+LAZY_VALUE LAZY_VALUE::at (size_type pos) const
+{
+    if (!this->is_array())
+        throw error {make_error_code(errc::incopatible_type)};
+
+    auto p = find_element(*_tape, _pos, pos);
+
+    if (!p)
+        throw error {make_error_code(std::errc::result_out_of_range)};
+
+    return LAZY_VALUE{_tape, p};
+}
+
+template <>
+LAZY_VALUE LAZY_VALUE::at (string_view key) const
+{
+    if (!this->is_object())
+        throw error {make_error_code(errc::incopatible_type)};
+
+    auto p = find_member(*_tape, _pos, key);
+
+    if (!p)
+        throw error {make_error_code(std::errc::result_out_of_range)};
+
+    return LAZY_VALUE{_tape, p};
+}
+
+template <>
+bool LAZY_VALUE::contains (string_view key) const
+{
+    if (!this->is_object())
+        return false;
+
+    return find_member(*_tape, _pos, key) != 0;
+}
+
+template <>
+LAZY_VALUE::iterator LAZY_VALUE::begin () const noexcept
+{
+    PFS__TERMINATE(_tape, "lazy_value::begin(): invalid value");
+
+    iterator result;
+    result._tape = _tape;
+    result._parent = _pos;
+    result._pos = this->is_structured() ? _pos + 1 : _pos;
+    return result;
+}
+
+template <>
+LAZY_VALUE::iterator LAZY_VALUE::end () const noexcept
+{
+    PFS__TERMINATE(_tape, "lazy_value::end(): invalid value");
+
+    iterator result;
+    result._tape = _tape;
+    result._parent = _pos;
+    result._pos = _tape->next(_pos);
+    return result;
+}
+
+template <>
+JSON LAZY_VALUE::to_json () const
+{
+    JSON result;
+
+    if (_tape) {
+        auto j = materialize(*_tape, _pos);
+
+        if (!j)
+            throw error {make_error_code(pfs::errc::backend_error), tr::_("lazy value materialization failure")};
+
+        NATIVE(result) = j;
+    }
+
+    return result;
+}
+
+template <>
+std::string
+converter_interface<LAZY_VALUE>::to_string () const
+{
+    auto self = static_cast<LAZY_VALUE const *>(this);
+
+    if (!self->_tape)
+        return std::string{};
+
+    return self->to_json().to_string();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Lazy iterator
+////////////////////////////////////////////////////////////////////////////////
+template <>
+bool LAZY_ITER::equals (LAZY_ITER const & other) const
+{
+    return _tape == other._tape
+        && _parent == other._parent
+        && _pos == other._pos;
+}
+
+template <>
+LAZY_ITER::reference LAZY_ITER::ref ()
+{
+    if (!_tape || _pos >= _tape->next(_parent))
+        throw error {make_error_code(std::errc::result_out_of_range)};
+
+    // Skip the key of the object member
+    if (_tape->at(_parent).type == lazy_tape::kind::object)
+        return LAZY_VALUE{_tape, _pos + 1};
+
+    return LAZY_VALUE{_tape, _pos};
+}
+
+template <>
+void LAZY_ITER::increment (difference_type)
+{
+    if (!_tape || _pos >= _tape->next(_parent))
+        throw error {make_error_code(std::errc::result_out_of_range)};
+
+    if (_tape->at(_parent).type == lazy_tape::kind::object)
+        _pos = _tape->next(_pos + 1);
+    else
+        _pos = _tape->next(_pos);
+}
+
+template <>
+LAZY_ITER::key_type LAZY_ITER::key () const
+{
+    if (!_tape || _tape->at(_parent).type != lazy_tape::kind::object)
+        throw error {make_error_code(errc::incopatible_type)};
+
+    if (_pos >= _tape->next(_parent))
+        throw error {make_error_code(std::errc::result_out_of_range)};
+
+    auto k = _tape->string(_pos);
+    return key_type(k.data(), k.size());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Lazy document
+////////////////////////////////////////////////////////////////////////////////
+template <>
+LAZY_DOC::lazy_document (lazy_document && other) noexcept
+    : _tape(other._tape)
+{
+    other._tape = nullptr;
+}
+
+template <>
+LAZY_DOC & LAZY_DOC::operator = (lazy_document && other) noexcept
+{
+    if (this != & other) {
+        delete _tape;
+        _tape = other._tape;
+        other._tape = nullptr;
+    }
+
+    return *this;
+}
+
+template <>
+LAZY_DOC::~lazy_document ()
+{
+    delete _tape;
+}
+
+template <>
+LAZY_DOC::value_type LAZY_DOC::root () const noexcept
+{
+    if (!_tape || _tape->entries.empty())
+        return value_type{};
+
+    return value_type{_tape, 0};
+}
+
+template <>
+std::size_t LAZY_DOC::tape_size () const noexcept
+{
+    return _tape ? _tape->entries.size() : 0;
+}
+
+namespace {
+
+// Builds the tape for the source set in @a tape, returns @c nullptr on error
+lazy_tape * build_tape (std::unique_ptr<lazy_tape> tape, error * perr
+    , pfs::filesystem::path const * path)
+{
+    // Structural index positions are 32-bit
+    if (tape->source_size > structural::index::max_length) {
+        pfs::throw_or(perr, make_error_code(pfs::errc::backend_error)
+            , tr::_("parse error: input is too large for lazy document"));
+
+        return nullptr;
+    }
+
+    std::size_t error_pos = 0;
+    int line = 0;
+    int column = 0;
+
+    auto rc = tape->build(error_pos, line, column);
+
+    if (rc != parse_errc::success) {
+        if (path) {
+            pfs::throw_or(perr, make_error_code(pfs::errc::backend_error)
+                , tr::f_("parse error at {}:{}: {}", line, pfs::utf8_encode_path(*path)
+                    , structural::message(rc)));
+        } else {
+            pfs::throw_or(perr, make_error_code(pfs::errc::backend_error)
+                , tr::f_("parse error at line {}: {}", line, structural::message(rc)));
+        }
+
+        return nullptr;
+    }
+
+    return tape.release();
+}
+
+} // namespace
+
+template <>
+LAZY_DOC LAZY_DOC::parse (char const * source, std::size_t len, error * perr)
+{
+    std::unique_ptr<lazy_tape> tape {new lazy_tape};
+    tape->source_buffer.assign(source, len);
+    tape->source = tape->source_buffer.data();
+    tape->source_size = len;
+
+    LAZY_DOC doc;
+    doc._tape = build_tape(std::move(tape), perr, nullptr);
+    return doc;
+}
+
+template <>
+LAZY_DOC LAZY_DOC::parse (std::string && source, error * perr)
+{
+    std::unique_ptr<lazy_tape> tape {new lazy_tape};
+    tape->source_buffer = std::move(source);
+    tape->source = tape->source_buffer.data();
+    tape->source_size = tape->source_buffer.size();
+
+    LAZY_DOC doc;
+    doc._tape = build_tape(std::move(tape), perr, nullptr);
+    return doc;
+}
+
+template <>
+LAZY_DOC LAZY_DOC::parse (pfs::filesystem::path const & path, error * perr)
+{
+    std::unique_ptr<lazy_tape> tape {new lazy_tape};
+    auto rc = tape->file.open(pfs::utf8_encode_path(path).c_str());
+
+    if (rc != 0) {
+        pfs::throw_or(perr, std::error_code(rc, std::generic_category())
+            , tr::f_("read JSON file failure: {}", pfs::utf8_encode_path(path)));
+
+        return LAZY_DOC{};
+    }
+
+    tape->source = tape->file.data();
+    tape->source_size = tape->file.size();
+
+    LAZY_DOC doc;
+    doc._tape = build_tape(std::move(tape), perr, & path);
+    return doc;
+}
+
+} // namespace jeyson
@@ -0,0 +1,246 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `jeyson-lib`.
+//
+// Changelog:
+//      2026.10.15 Initial version.
+////////////////////////////////////////////////////////////////////////////////
+#include "jeyson/lines.hpp"
+#include "jeyson/backend/jansson.hpp"
+#include "mapped_file.hpp"
+#include <pfs/i18n.hpp>
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+namespace jeyson {
+
+using BACKEND   = backend::jansson;
+using JSON      = json<BACKEND>;
+using JSON_LINE = json_line<BACKEND>;
+
+namespace {
+
+// Maximum number of batches parsed ahead of the consumer per thread
+constexpr std::size_t window_per_thread = 4;
+
+struct batch
+{
+    char const * first {nullptr};
+    char const * last {nullptr};
+    std::size_t line_count {0};      // Including skipped lines
+    std::vector<JSON_LINE> results;  // Line numbers are relative to the batch
+    bool done {false};
+};
+
+bool is_blank (char const * first, char const * last) noexcept
+{
+    for (; first != last; ++first) {
+        if (*first != ' ' && *first != '\t' && *first != '\r')
+            return false;
+    }
+
+    return true;
+}
+
+// Splits input into batches of about @a batch_size bytes at line boundaries
+std::vector<batch> split (char const * data, std::size_t len, std::size_t batch_size)
+{
+    std::vector<batch> result;
+    auto end = data + len;
+    auto p = data;
+
+    while (p != end) {
+        batch b;
+        b.first = p;
+
+        if (static_cast<std::size_t>(end - p) <= batch_size) {
+            p = end;
+        } else {
+            auto nl = static_cast<char const *>(std::memchr(p + batch_size, '\n'
+                , static_cast<std::size_t>(end - p) - batch_size));
+            p = nl ? nl + 1 : end;
+        }
+
+        b.last = p;
+        result.push_back(std::move(b));
+    }
+
+    return result;
+}
+
+void parse_batch (char const * data, batch & b)
+{
+    auto p = b.first;
+    std::size_t index = 0;
+
+    while (p != b.last) {
+        auto nl = static_cast<char const *>(std::memchr(p, '\n', static_cast<std::size_t>(b.last - p)));
+        auto line_end = nl ? nl : b.last;
+
+        if (!is_blank(p, line_end)) {
+            JSON_LINE line;
+            line.line = index;
+            line.offset = static_cast<std::size_t>(p - data);
+            line.value = JSON::parse(p, static_cast<std::size_t>(line_end - p), & line.err);
+            b.results.push_back(std::move(line));
+        }
+
+        index++;
+        p = nl ? nl + 1 : b.last;
+    }
+
+    b.line_count = index;
+}
+
+} // namespace
+
+template <>
+void parse_lines<BACKEND> (char const * data, std::size_t len
+    , json_line_callback<BACKEND> const & on_line
+    , parse_lines_options const & opts)
+{
+    auto batches = split(data, len, (std::max)(opts.batch_size, std::size_t{1}));
+
+    auto threads = opts.threads > 0
+        ? opts.threads
+        : static_cast<std::size_t>((std::max)(std::thread::hardware_concurrency(), 1u));
+
+    threads = (std::min)(threads, batches.size());
+
+    std::size_t base = 0; // Number of lines before the batch
+
+    auto emit = [& base, & on_line] (batch & b) {
+        for (auto & line: b.results) {
+            line.line += base + 1;
+            on_line(std::move(line));
+        }
+
+        base += b.line_count;
+        b.results.clear();
+        b.results.shrink_to_fit();
+    };
+
+    if (threads <= 1) {
+        for (auto & b: batches) {
+            parse_batch(data, b);
+            emit(b);
+        }
+
+        return;
+    }
+
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::size_t next = 0;     // Next batch to parse
+    std::size_t emitted = 0;  // Number of emitted batches
+    bool abort = false;
+    std::exception_ptr failure;
+    auto window = threads * window_per_thread;
+
+    auto worker = [&] {
+        for (;;) {
+            std::size_t k = 0;
+
+            {
+                std::unique_lock<std::mutex> locker{mtx};
+
+                cv.wait(locker, [&] {
+                    return abort || next >= batches.size() || next < emitted + window;
+                });
+
+                if (abort || next >= batches.size())
+                    return;
+
+                k = next++;
+            }
+
+            // Batch is accessed by the worker only until it is marked done
+            try {
+                parse_batch(data, batches[k]);
+            } catch (...) {
+                std::lock_guard<std::mutex> locker{mtx};
+
+                if (!failure)
+                    failure = std::current_exception();
+
+                abort = true;
+            }
+
+            {
+                std::lock_guard<std::mutex> locker{mtx};
+                batches[k].done = true;
+            }
+
+            cv.notify_all();
+        }
+    };
+
+    std::vector<std::thread> pool;
+    pool.reserve(threads);
+
+    for (std::size_t i = 0; i < threads; i++)
+        pool.emplace_back(worker);
+
+    try {
+        for (std::size_t k = 0; k < batches.size(); k++) {
+            {
+                std::unique_lock<std::mutex> locker{mtx};
+                cv.wait(locker, [&] { return abort || batches[k].done; });
+
+                if (abort)
+                    break;
+            }
+
+            emit(batches[k]);
+
+            {
+                std::lock_guard<std::mutex> locker{mtx};
+                emitted = k + 1;
+            }
+
+            cv.notify_all();
+        }
+    } catch (...) {
+        std::lock_guard<std::mutex> locker{mtx};
+
+        if (!failure)
+            failure = std::current_exception();
+
+        abort = true;
+    }
+
+    cv.notify_all();
+
+    for (auto & t: pool)
+        t.join();
+
+    if (failure)
+        std::rethrow_exception(failure);
+}
+
+template <>
+bool parse_lines<BACKEND> (pfs::filesystem::path const & path
+    , json_line_callback<BACKEND> const & on_line
+    , parse_lines_options const & opts
+    , error * perr)
+{
+    backend::mapped_file file;
+    auto rc = file.open(pfs::utf8_encode_path(path).c_str());
+
+    if (rc != 0) {
+        pfs::throw_or(perr, std::error_code(rc, std::generic_category())
+            , tr::f_("read JSON Lines file failure: {}", pfs::utf8_encode_path(path)));
+
+        return false;
+    }
+
+    parse_lines<BACKEND>(file.data(), file.size(), on_line, opts);
+    return true;
+}
+
+} // namespace jeyson
@@ -0,0 +1,255 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `jeyson-lib`.
+//
+// Changelog:
+//      2026.10.15 Initial version.
+////////////////////////////////////////////////////////////////////////////////
+#include "mapped_file.hpp"
+#include <cerrno>
+#include <limits>
+
+#if _WIN32
+#   ifndef WIN32_LEAN_AND_MEAN
+#       define WIN32_LEAN_AND_MEAN
+#   endif
+#   ifndef NOMINMAX
+#       define NOMINMAX
+#   endif
+#   include <windows.h>
+#else
+#   include <fcntl.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#endif
+
+namespace jeyson {
+namespace backend {
+
+namespace {
+
+// Size of a single read for files that are not mapped
+constexpr std::size_t read_chunk_size = 1024 * 1024;
+
+} // namespace
+
+mapped_file::~mapped_file ()
+{
+    close();
+}
+
+#if _WIN32
+
+namespace {
+
+int last_errno () noexcept
+{
+    switch (GetLastError()) {
+        case ERROR_FILE_NOT_FOUND:
+        case ERROR_PATH_NOT_FOUND: return ENOENT;
+        case ERROR_ACCESS_DENIED: return EACCES;
+        case ERROR_NOT_ENOUGH_MEMORY:
+        case ERROR_OUTOFMEMORY: return ENOMEM;
+        default: return EIO;
+    }
+}
+
+int read_all (HANDLE h, std::string & buffer)
+{
+    for (;;) {
+        auto offset = buffer.size();
+        buffer.resize(offset + read_chunk_size);
+
+        DWORD n = 0;
+
+        if (!ReadFile(h, & buffer[offset], static_cast<DWORD>(read_chunk_size), & n, nullptr)) {
+            auto rc = GetLastError() == ERROR_BROKEN_PIPE ? 0 : last_errno();
+            buffer.resize(offset);
+            return rc;
+        }
+
+        buffer.resize(offset + n);
+
+        if (n == 0)
+            return 0;
+    }
+}
+
+} // namespace
+
+int mapped_file::open (char const * path)
+{
+    close();
+
+    auto wlen = MultiByteToWideChar(CP_UTF8, 0, path, -1, nullptr, 0);
+
+    if (wlen <= 0)
+        return EINVAL;
+
+    std::wstring wpath(static_cast<std::size_t>(wlen), L'\0');
+    MultiByteToWideChar(CP_UTF8, 0, path, -1, & wpath[0], wlen);
+
+    auto h = CreateFileW(wpath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr
+        , OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+    if (h == INVALID_HANDLE_VALUE)
+        return last_errno();
+
+    LARGE_INTEGER size;
+    int rc = 0;
+
+    if (GetFileType(h) == FILE_TYPE_DISK && GetFileSizeEx(h, & size) && size.QuadPart > 0
+            && static_cast<unsigned long long>(size.QuadPart) <= (std::numeric_limits<std::size_t>::max)()) {
+        _mapping = CreateFileMappingW(h, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+        if (_mapping)
+            _view = MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0);
+
+        if (_view) {
+            _data = static_cast<char const *>(_view);
+            _size = static_cast<std::size_t>(size.QuadPart);
+        } else {
+            close();
+        }
+    }
+
+    if (!_view) {
+        rc = read_all(h, _buffer);
+        _data = _buffer.data();
+        _size = _buffer.size();
+    }
+
+    CloseHandle(h);
+
+    if (rc != 0)
+        close();
+
+    return rc;
+}
+
+void mapped_file::close () noexcept
+{
+    if (_view)
+        UnmapViewOfFile(_view);
+
+    if (_mapping)
+        CloseHandle(_mapping);
+
+    _view = nullptr;
+    _mapping = nullptr;
+    _data = nullptr;
+    _size = 0;
+    _buffer.clear();
+}
+
+#else
+
+namespace {
+
+#ifdef MADV_HUGEPAGE
+// Mappings of this size and more are candidates for huge pages
+constexpr std::size_t huge_page_threshold = 2 * 1024 * 1024;
+#endif
+
+int read_all (int fd, std::string & buffer)
+{
+    for (;;) {
+        auto offset = buffer.size();
+        buffer.resize(offset + read_chunk_size);
+
+        auto n = ::read(fd, & buffer[offset], read_chunk_size);
+
+        if (n < 0) {
+            buffer.resize(offset);
+
+            if (errno == EINTR)
+                continue;
+
+            return errno;
+        }
+
+        buffer.resize(offset + static_cast<std::size_t>(n));
+
+        if (n == 0)
+            return 0;
+    }
+}
+
+} // namespace
+
+int mapped_file::open (char const * path)
+{
+    close();
+
+    int flags = O_RDONLY;
+
+#ifdef O_CLOEXEC
+    flags |= O_CLOEXEC;
+#endif
+
+    int fd = -1;
+
+    do {
+        fd = ::open(path, flags);
+    } while (fd < 0 && errno == EINTR);
+
+    if (fd < 0)
+        return errno;
+
+    struct stat st;
+    int rc = 0;
+
+    // Files of procfs/sysfs report zero size, pipes and devices are not mappable
+    if (::fstat(fd, & st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0
+            && static_cast<unsigned long long>(st.st_size) <= (std::numeric_limits<std::size_t>::max)()) {
+        auto size = static_cast<std::size_t>(st.st_size);
+        auto view = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+        if (view != MAP_FAILED) {
+            // Hints only, failures are ignored
+#ifdef MADV_SEQUENTIAL
+            ::madvise(view, size, MADV_SEQUENTIAL);
+#endif
+#ifdef MADV_WILLNEED
+            ::madvise(view, size, MADV_WILLNEED);
+#endif
+#ifdef MADV_HUGEPAGE
+            if (size >= huge_page_threshold)
+                ::madvise(view, size, MADV_HUGEPAGE);
+#endif
+            _view = view;
+            _data = static_cast<char const *>(view);
+            _size = size;
+        }
+    }
+
+    if (!_view) {
+        rc = read_all(fd, _buffer);
+        _data = _buffer.data();
+        _size = _buffer.size();
+    }
+
+    ::close(fd);
+
+    if (rc != 0)
+        close();
+
+    return rc;
+}
+
+void mapped_file::close () noexcept
+{
+    if (_view)
+        ::munmap(_view, _size);
+
+    _view = nullptr;
+    _data = nullptr;
+    _size = 0;
+    _buffer.clear();
+}
+
+#endif
+
+}} // namespace jeyson::backend
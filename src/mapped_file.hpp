@@ -0,0 +1,65 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `jeyson-lib`.
+//
+// Changelog:
+//      2026.10.15 Initial version.
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include <cstddef>
+#include <string>
+
+namespace jeyson {
+namespace backend {
+
+/**
+ * Read-only content of a file. Regular files are memory mapped (with
+ * sequential access hints), other files (pipes, procfs entries, etc) and
+ * files that can not be mapped are read into a buffer with large reads.
+ */
+class mapped_file
+{
+    char const * _data {nullptr};
+    std::size_t _size {0};
+    void * _view {nullptr};     // Mapped view or nullptr if content is buffered
+#if _WIN32
+    void * _mapping {nullptr};  // File mapping handle
+#endif
+    std::string _buffer;
+
+public:
+    mapped_file () = default;
+    ~mapped_file ();
+
+    mapped_file (mapped_file const &) = delete;
+    mapped_file & operator = (mapped_file const &) = delete;
+
+    /**
+     * Opens file specified by UTF-8 encoded @a path.
+     *
+     * @return 0 on success or @c errno value on failure.
+     */
+    int open (char const * path);
+
+    char const * data () const noexcept
+    {
+        return _data;
+    }
+
+    std::size_t size () const noexcept
+    {
+        return _size;
+    }
+
+    /// Checks if the content is memory mapped.
+    bool mapped () const noexcept
+    {
+        return _view != nullptr;
+    }
+
+private:
+    void close () noexcept;
+};
+
+}} // namespace jeyson::backend
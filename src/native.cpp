@@ -0,0 +1,2937 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `jeyson-lib`.
+//
+// Changelog:
+//      2026.10.15 Initial version.
+//      2026.10.16 Mutable references and iterators make the value unshareable.
+////////////////////////////////////////////////////////////////////////////////
+#include "jeyson/json.hpp"
+#include "jeyson/error.hpp"
+#include "jeyson/backend/native.hpp"
+#include "instrumentation.hpp"
+#include "mapped_file.hpp"
+#include "native_dumper.hpp"
+#include "native_loader.hpp"
+#include "structural_index.hpp"
+#include "structural_parser.hpp"
+#include <pfs/assert.hpp>
+#include <pfs/i18n.hpp>
+#include <jansson.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace jeyson {
+
+using BACKEND  = backend::native;
+using JSON     = json<BACKEND>;
+using JSON_REF = json_ref<BACKEND>;
+using JSON_VIEW = json_view<BACKEND>;
+
+#define NATIVE(x) ((x)._ptr)
+#define INATIVE(x) (static_cast<BACKEND::basic_rep &>(x)._ptr)
+#define CINATIVE(x) (static_cast<BACKEND::basic_rep const &>(x)._ptr)
+
+static_assert(sizeof(BACKEND::value) == 16, "value cell must be 16 bytes");
+static_assert(sizeof(BACKEND::member) == 32, "member must be a pair of cells");
+
+namespace backend {
+
+using value    = native::value;
+using member   = native::member;
+using type_tag = native::type_tag;
+
+////////////////////////////////////////////////////////////////////////////////
+// Document
+////////////////////////////////////////////////////////////////////////////////
+constexpr std::uint8_t heap_block = 0x01; // String or vector is allocated from the heap
+constexpr std::uint8_t indexed    = 0x02; // Object members are indexed by the hash table
+
+static char const s_empty_string[] = "";
+
+struct native::document
+{
+    // Bump allocator of the document.
+    // The library arena (see `arena.hpp`) is not used here: its chunks are
+    // registered for the jansson allocation hooks, which look up every
+    // released jansson node in the registry (lock-free, but not free) while
+    // any arena is alive.
+    class pool
+    {
+        struct chunk
+        {
+            chunk * next;
+            std::size_t size;
+        };
+
+        static constexpr std::size_t max_chunk_size = 64 * 1024 * 1024;
+
+        chunk * _head {nullptr};
+        std::uintptr_t _cursor {0};
+        std::uintptr_t _limit {0};
+        std::size_t _next_size;
+
+    public:
+        explicit pool (std::size_t initial_size) : _next_size(initial_size)
+        {}
+
+        pool (pool const &) = delete;
+        pool & operator = (pool const &) = delete;
+
+        ~pool ()
+        {
+            while (_head) {
+                auto next = _head->next;
+                ::operator delete(_head);
+                _head = next;
+            }
+        }
+
+        bool empty () const noexcept
+        {
+            return _head == nullptr;
+        }
+
+        void * allocate (std::size_t n, std::size_t align)
+        {
+            auto p = (_cursor + align - 1) & ~static_cast<std::uintptr_t>(align - 1);
+
+            if (_head == nullptr || p + n > _limit)
+                return allocate_chunk(n, align);
+
+            _cursor = p + n;
+            return reinterpret_cast<void *>(p);
+        }
+
+    private:
+        void * allocate_chunk (std::size_t n, std::size_t align)
+        {
+            auto size = (std::max)(_next_size, sizeof(chunk) + n + align);
+            auto c = static_cast<chunk *>(::operator new(size));
+            instrumentation::count_allocation(size);
+
+            c->next = _head;
+            c->size = size;
+            _head = c;
+            _cursor = reinterpret_cast<std::uintptr_t>(c + 1);
+            _limit = reinterpret_cast<std::uintptr_t>(c) + size;
+            _next_size = (std::min)(size * 2, max_chunk_size);
+
+            return allocate(n, align);
+        }
+    };
+
+    std::atomic<std::size_t> refs;   // Values and references
+    std::atomic<std::size_t> owners; // Values (members of the copy-on-write group)
+    bool leaked {false};             // Modifiable through references and iterators
+    value root {};
+    std::size_t heap_blocks {0};     // Blocks allocated from the heap
+    pool mem;
+
+    document (std::size_t owners_count, std::size_t pool_size = 4096)
+        : refs(1)
+        , owners(owners_count)
+        , mem(pool_size)
+    {}
+};
+
+using document = native::document;
+
+namespace {
+
+inline value make_scalar (type_tag type) noexcept
+{
+    value v {};
+    v.type = type;
+    return v;
+}
+
+inline value make_bool (bool b) noexcept
+{
+    return make_scalar(b ? type_tag::true_value : type_tag::false_value);
+}
+
+inline value make_integer (std::intmax_t n) noexcept
+{
+    auto v = make_scalar(type_tag::integer);
+    v.u.i = static_cast<std::int64_t>(n);
+    return v;
+}
+
+inline value make_real (double n) noexcept
+{
+    auto v = make_scalar(type_tag::real);
+    v.u.d = n;
+    return v;
+}
+
+inline bool is_scalar (type_tag type) noexcept
+{
+    return type != type_tag::string && type != type_tag::array && type != type_tag::object;
+}
+
+void check_length (std::size_t n)
+{
+    if (n > (std::numeric_limits<std::uint32_t>::max)())
+        throw error {make_error_code(std::errc::value_too_large), tr::_("value is too large")};
+}
+
+void * heap_allocate (document & d, std::size_t n)
+{
+    auto p = ::operator new(n);
+    instrumentation::count_allocation(n);
+    d.heap_blocks++;
+    return p;
+}
+
+inline void heap_free (document & d, void const * p) noexcept
+{
+    ::operator delete(const_cast<void *>(p));
+    d.heap_blocks--;
+}
+
+// Capacity of the element (member) vector
+inline std::size_t capacity (value const & v) noexcept
+{
+    return (v.flags & heap_block) ? (std::size_t{1} << v.capacity_log2) : v.n;
+}
+
+// Heap vectors hold at least four elements and grow twice
+inline std::uint8_t capacity_log2 (std::size_t n) noexcept
+{
+    std::uint8_t result = 2;
+
+    while ((std::size_t{1} << result) < n)
+        result++;
+
+    return result;
+}
+
+// Size of the object hash table, at least twice as large as the capacity
+inline std::size_t table_size (std::size_t capacity) noexcept
+{
+    std::size_t result = 32;
+
+    while (result < capacity * 2)
+        result *= 2;
+
+    return result;
+}
+
+inline std::size_t members_block_size (std::size_t capacity) noexcept
+{
+    return capacity * sizeof(member) + (capacity > native::index_threshold
+        ? table_size(capacity) * sizeof(std::uint32_t) : 0);
+}
+
+inline std::uint32_t * table_of (value const & obj) noexcept
+{
+    return reinterpret_cast<std::uint32_t *>(obj.u.members + capacity(obj));
+}
+
+inline std::size_t hash_key (char const * s, std::size_t n) noexcept
+{
+    std::uint64_t h = 0x9E3779B97F4A7C15ull ^ n;
+
+    for (; n >= 8; s += 8, n -= 8) {
+        std::uint64_t w;
+        std::memcpy(& w, s, 8);
+        h = (h ^ w) * 0xFF51AFD7ED558CCDull;
+        h ^= h >> 32;
+    }
+
+    if (n > 0) {
+        std::uint64_t w = 0;
+        std::memcpy(& w, s, n);
+        h = (h ^ w) * 0xC4CEB9FE1A85EC53ull;
+    }
+
+    h ^= h >> 29;
+    return static_cast<std::size_t>(h ^ (h >> 32));
+}
+
+inline bool key_equals (value const & key, char const * s, std::size_t n) noexcept
+{
+    return key.n == n && std::memcmp(key.u.s, s, n) == 0;
+}
+
+// Hash table entries are member positions plus one, zero marks free entry
+void table_insert (std::uint32_t * table, std::size_t mask, value const & key
+    , std::size_t pos) noexcept
+{
+    for (auto i = hash_key(key.u.s, key.n) & mask; ; i = (i + 1) & mask) {
+        if (table[i] == 0) {
+            table[i] = static_cast<std::uint32_t>(pos + 1);
+            return;
+        }
+    }
+}
+
+// Builds hash table for the object with more than `index_threshold` capacity
+void build_table (value & obj) noexcept
+{
+    auto size = table_size(capacity(obj));
+    auto table = table_of(obj);
+
+    std::memset(table, 0, size * sizeof(std::uint32_t));
+
+    for (std::size_t i = 0; i < obj.n; i++)
+        table_insert(table, size - 1, obj.u.members[i].key, i);
+
+    obj.flags |= indexed;
+}
+
+member * find_member (value const & obj, char const * s, std::size_t n) noexcept
+{
+    auto members = obj.u.members;
+
+    if (obj.flags & indexed) {
+        auto table = table_of(obj);
+        auto mask = table_size(capacity(obj)) - 1;
+
+        for (auto i = hash_key(s, n) & mask; table[i] != 0; i = (i + 1) & mask) {
+            auto & m = members[table[i] - 1];
+
+            if (key_equals(m.key, s, n))
+                return & m;
+        }
+
+        return nullptr;
+    }
+
+    for (std::size_t i = 0; i < obj.n; i++) {
+        if (key_equals(members[i].key, s, n))
+            return members + i;
+    }
+
+    return nullptr;
+}
+
+inline member * find_member (value const * obj, string_view const & key) noexcept
+{
+    if (obj == nullptr || obj->type != type_tag::object)
+        return nullptr;
+
+    return find_member(*obj, key.data(), key.size());
+}
+
+// Strings and vectors of the parsed and copied trees are allocated from the
+// pool (@a pooled is @c true), the ones created by modifications are
+// allocated from the heap.
+value make_string (document & d, char const * s, std::size_t n, bool pooled)
+{
+    auto v = make_scalar(type_tag::string);
+
+    if (n == 0) {
+        v.u.s = s_empty_string;
+        return v;
+    }
+
+    check_length(n);
+
+    char * p = nullptr;
+
+    if (pooled) {
+        p = static_cast<char *>(d.mem.allocate(n, 1));
+    } else {
+        p = static_cast<char *>(heap_allocate(d, n));
+        v.flags = heap_block;
+    }
+
+    std::memcpy(p, s, n);
+    v.u.s = p;
+    v.n = static_cast<std::uint32_t>(n);
+    return v;
+}
+
+// Allocates vector for at least @a n (non-zero) elements of the array @a v
+value * allocate_items (document & d, value & v, std::size_t n, bool pooled)
+{
+    check_length(n);
+
+    if (pooled) {
+        v.u.items = static_cast<value *>(d.mem.allocate(n * sizeof(value), alignof(value)));
+        v.flags = 0;
+    } else {
+        auto log2 = capacity_log2(n);
+        v.u.items = static_cast<value *>(heap_allocate(d, (std::size_t{1} << log2) * sizeof(value)));
+        v.flags = heap_block;
+        v.capacity_log2 = log2;
+    }
+
+    return v.u.items;
+}
+
+// Allocates vector for at least @a n (non-zero) members of the object @a v,
+// the hash table (if any) is not initialized.
+member * allocate_members (document & d, value & v, std::size_t n, bool pooled)
+{
+    check_length(n);
+
+    if (pooled) {
+        v.u.members = static_cast<member *>(d.mem.allocate(members_block_size(n), alignof(member)));
+        v.flags = 0;
+    } else {
+        auto log2 = capacity_log2(n);
+        v.u.members = static_cast<member *>(heap_allocate(d, members_block_size(std::size_t{1} << log2)));
+        v.flags = heap_block;
+        v.capacity_log2 = log2;
+    }
+
+    return v.u.members;
+}
+
+// Releases heap blocks of the tree, pool blocks are released with the document
+void free_heap_blocks (document & d, value & v) noexcept
+{
+    if (d.heap_blocks == 0)
+        return;
+
+    switch (v.type) {
+        case type_tag::string:
+            if (v.flags & heap_block)
+                heap_free(d, v.u.s);
+            break;
+
+        case type_tag::array:
+            for (std::size_t i = 0; i < v.n && d.heap_blocks > 0; i++)
+                free_heap_blocks(d, v.u.items[i]);
+
+            if (v.flags & heap_block)
+                heap_free(d, v.u.items);
+            break;
+
+        case type_tag::object:
+            for (std::size_t i = 0; i < v.n && d.heap_blocks > 0; i++) {
+                free_heap_blocks(d, v.u.members[i].key);
+                free_heap_blocks(d, v.u.members[i].val);
+            }
+
+            if (v.flags & heap_block)
+                heap_free(d, v.u.members);
+            break;
+
+        default:
+            break;
+    }
+}
+
+// Replaces the value of the @a slot by @a v
+inline void replace (document & d, value & slot, value const & v) noexcept
+{
+    free_heap_blocks(d, slot);
+    slot = v;
+}
+
+value clone (document & d, value const & src, bool pooled)
+{
+    switch (src.type) {
+        case type_tag::string:
+            return make_string(d, src.u.s, src.n, pooled);
+
+        case type_tag::array: {
+            auto v = make_scalar(type_tag::array);
+
+            if (src.n > 0) {
+                auto items = allocate_items(d, v, src.n, pooled);
+
+                for (std::size_t i = 0; i < src.n; i++) {
+                    items[i] = clone(d, src.u.items[i], pooled);
+                    v.n++;
+                }
+            }
+
+            return v;
+        }
+
+        case type_tag::object: {
+            auto v = make_scalar(type_tag::object);
+
+            if (src.n > 0) {
+                auto members = allocate_members(d, v, src.n, pooled);
+
+                for (std::size_t i = 0; i < src.n; i++) {
+                    members[i].key = make_string(d, src.u.members[i].key.u.s
+                        , src.u.members[i].key.n, pooled);
+                    members[i].val = clone(d, src.u.members[i].val, pooled);
+                    v.n++;
+                }
+
+                if (capacity(v) > native::index_threshold)
+                    build_table(v);
+            }
+
+            return v;
+        }
+
+        default:
+            return make_scalar(src.type) = src;
+    }
+}
+
+// Returns new slot at the end of the array
+value & append_item (document & d, value & arr)
+{
+    if (arr.n == capacity(arr)) {
+        auto v = arr;
+        auto items = allocate_items(d, v, std::size_t{arr.n} + 1, false);
+
+        if (arr.n > 0)
+            std::memcpy(items, arr.u.items, arr.n * sizeof(value));
+
+        if (arr.flags & heap_block)
+            heap_free(d, arr.u.items);
+
+        arr = v;
+    }
+
+    auto & slot = arr.u.items[arr.n++];
+    slot = make_scalar(type_tag::null);
+    return slot;
+}
+
+// Returns value of the member with @a key, new member (added to the end)
+// is initialized by null
+value & insert_member (document & d, value & obj, char const * s, std::size_t n)
+{
+    if (auto m = find_member(obj, s, n))
+        return m->val;
+
+    if (obj.n == capacity(obj)) {
+        auto v = obj;
+        auto members = allocate_members(d, v, std::size_t{obj.n} + 1, false);
+
+        if (obj.n > 0)
+            std::memcpy(members, obj.u.members, obj.n * sizeof(member));
+
+        if (obj.flags & heap_block)
+            heap_free(d, obj.u.members);
+
+        v.flags &= ~indexed;
+        obj = v;
+
+        if (capacity(obj) > native::index_threshold)
+            build_table(obj);
+    }
+
+    auto key = make_string(d, s, n, false);
+    auto & m = obj.u.members[obj.n];
+    m.key = key;
+    m.val = make_scalar(type_tag::null);
+
+    if (obj.flags & indexed)
+        table_insert(table_of(obj), table_size(capacity(obj)) - 1, m.key, obj.n);
+
+    obj.n++;
+    return m.val;
+}
+
+bool equals (value const & a, value const & b) noexcept
+{
+    if (a.type != b.type)
+        return false;
+
+    switch (a.type) {
+        case type_tag::integer:
+            return a.u.i == b.u.i;
+
+        case type_tag::real:
+            return a.u.d == b.u.d;
+
+        case type_tag::string:
+            return a.n == b.n && std::memcmp(a.u.s, b.u.s, a.n) == 0;
+
+        case type_tag::array:
+            if (a.n != b.n)
+                return false;
+
+            for (std::size_t i = 0; i < a.n; i++) {
+                if (!equals(a.u.items[i], b.u.items[i]))
+                    return false;
+            }
+
+            return true;
+
+        case type_tag::object:
+            if (a.n != b.n)
+                return false;
+
+            // Order of members does not matter
+            for (std::size_t i = 0; i < a.n; i++) {
+                auto & m = a.u.members[i];
+                auto other = find_member(b, m.key.u.s, m.key.n);
+
+                if (other == nullptr || !equals(m.val, other->val))
+                    return false;
+            }
+
+            return true;
+
+        default:
+            return true;
+    }
+}
+
+// Accounts nodes of the tree for the instrumentation record
+void collect_node_stats (value const & v, instrumentation::stats & s, std::size_t depth = 0)
+{
+    switch (v.type) {
+        case type_tag::null: s.nulls++; break;
+        case type_tag::true_value:
+        case type_tag::false_value: s.booleans++; break;
+        case type_tag::integer: s.integers++; break;
+        case type_tag::real: s.reals++; break;
+        case type_tag::string: s.strings++; break;
+
+        case type_tag::array:
+            s.arrays++;
+            s.max_depth = (std::max)(s.max_depth, depth + 1);
+
+            for (std::size_t i = 0; i < v.n; i++)
+                collect_node_stats(v.u.items[i], s, depth + 1);
+
+            return;
+
+        case type_tag::object:
+            s.objects++;
+            s.max_depth = (std::max)(s.max_depth, depth + 1);
+
+            for (std::size_t i = 0; i < v.n; i++)
+                collect_node_stats(v.u.members[i].val, s, depth + 1);
+
+            return;
+
+        default:
+            return;
+    }
+
+    s.max_depth = (std::max)(s.max_depth, depth);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Reference counting and copy-on-write
+////////////////////////////////////////////////////////////////////////////////
+// Document is shared by the values (owners) and the references. Copies of a
+// value share the document until the first modification through any of them
+// (see `detach()`), references always write through. Document of a value that
+// has given out mutable references or iterators is not shared (see `leak()`):
+// writes through them must not be visible in copies.
+inline void retain (document * d, bool owner) noexcept
+{
+    d->refs.fetch_add(1, std::memory_order_relaxed);
+
+    if (owner)
+        d->owners.fetch_add(1, std::memory_order_relaxed);
+}
+
+void unref (document * d, bool owner) noexcept
+{
+    if (owner)
+        d->owners.fetch_sub(1, std::memory_order_acq_rel);
+
+    if (d->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        free_heap_blocks(*d, d->root);
+        delete d;
+    }
+}
+
+// Tree takes less memory than the text, so the first chunk is large enough
+// in most cases
+std::size_t initial_pool_size (std::size_t text_size) noexcept
+{
+    constexpr std::size_t min_size = 4 * 1024;
+    constexpr std::size_t max_size = 256 * 1024 * 1024;
+
+    return (std::min)((std::max)(text_size, min_size), max_size);
+}
+
+// Makes @a rep the root of the new document with the copy of @a src.
+// @a src may belong to the current document of @a rep.
+void assign_copy (native::rep & rep, value const * src)
+{
+    if (src == nullptr)
+        throw error {make_error_code(std::errc::invalid_argument), tr::_("attempt to assign null value")};
+
+    std::unique_ptr<document> doc {new document {1}};
+    doc->root = clone(*doc, *src, true);
+
+    if (rep._doc)
+        unref(rep._doc, true);
+
+    rep._doc = doc.release();
+    rep._ptr = & rep._doc->root;
+}
+
+// Returns root of the exclusively owned document to be replaced by a new
+// value (it is null). Document is reused if nothing refers to it and it has
+// no pool blocks, otherwise the new one is created.
+value & reset (native::rep & rep)
+{
+    auto d = rep._doc;
+
+    if (d && d->refs.load(std::memory_order_acquire) == 1 && d->mem.empty()) {
+        replace(*d, d->root, make_scalar(type_tag::null));
+        d->leaked = false;
+        return d->root;
+    }
+
+    auto doc = new document {1};
+    doc->root = make_scalar(type_tag::null);
+
+    if (d)
+        unref(d, true);
+
+    rep._doc = doc;
+    rep._ptr = & doc->root;
+    return doc->root;
+}
+
+void swap (native::rep & a, native::rep & b) noexcept
+{
+    std::swap(a._ptr, b._ptr);
+    std::swap(a._doc, b._doc);
+}
+
+void swap (native::ref & a, native::ref & b) noexcept
+{
+    std::swap(a._ptr, b._ptr);
+    std::swap(a._doc, b._doc);
+}
+
+} // namespace
+
+// Makes the tree exclusively owned by @a rep before modification.
+// The tree is copied before leaving the group, so concurrently detaching
+// members never see the tree being modified.
+void detach (native::rep & rep)
+{
+    auto d = rep._doc;
+
+    if (d == nullptr || d->owners.load(std::memory_order_acquire) == 1)
+        return;
+
+    std::unique_ptr<document> copy {new document {1}};
+    copy->root = clone(*copy, d->root, true);
+
+    unref(d, true);
+    rep._doc = copy.release();
+    rep._ptr = & rep._doc->root;
+}
+
+// Detaches the tree and marks it as modifiable through references or
+// iterators given out by @a rep
+void leak (native::rep & rep)
+{
+    detach(rep);
+
+    if (rep._doc)
+        rep._doc->leaked = true;
+}
+
+// References are not the members of copy-on-write groups
+inline void detach (native::ref &) noexcept
+{}
+
+inline void leak (native::ref &) noexcept
+{}
+
+namespace {
+
+// Returns the modifiable value of @a rep, uninitialized value becomes the
+// root of the new document (the root is invalid until assigned)
+value & target (native::rep & rep)
+{
+    detach(rep);
+
+    if (!rep._ptr) {
+        rep._doc = new document {1};
+        rep._ptr = & rep._doc->root;
+    }
+
+    return *rep._ptr;
+}
+
+// Returns the referenced value, invalid reference becomes the root of the new
+// document (the root is invalid until assigned)
+value & target (native::ref & ref)
+{
+    if (!ref._ptr) {
+        ref._doc = new document {0};
+        ref._ptr = & ref._doc->root;
+    }
+
+    return *ref._ptr;
+}
+
+template <typename Rep>
+value & container_for_modification (Rep & r, type_tag type)
+{
+    auto & v = target(r);
+
+    if (v.type == type_tag::invalid)
+        v = make_scalar(type);
+
+    if (v.type != type) {
+        if (type == type_tag::object)
+            throw error {make_error_code(errc::incopatible_type), tr::_("object expected")};
+
+        throw error {make_error_code(errc::incopatible_type), tr::_("array expected")};
+    }
+
+    return v;
+}
+
+template <typename Rep>
+void insert (Rep & r, string_view const & key, value const & v)
+{
+    auto & obj = container_for_modification(r, type_tag::object);
+    auto & slot = insert_member(*r._doc, obj, key.data(), key.size());
+    replace(*r._doc, slot, v);
+}
+
+template <typename Rep>
+void insert_string (Rep & r, string_view const & key, string_view const & s)
+{
+    auto & obj = container_for_modification(r, type_tag::object);
+    auto & slot = insert_member(*r._doc, obj, key.data(), key.size());
+    replace(*r._doc, slot, make_string(*r._doc, s.data(), s.size(), false));
+}
+
+template <typename Rep>
+void insert_copy (Rep & r, string_view const & key, value const & src)
+{
+    auto & obj = container_for_modification(r, type_tag::object);
+    auto v = clone(*r._doc, src, false);
+    auto & slot = insert_member(*r._doc, obj, key.data(), key.size());
+    replace(*r._doc, slot, v);
+}
+
+template <typename Rep>
+void push_back (Rep & r, value const & v)
+{
+    auto & arr = container_for_modification(r, type_tag::array);
+    append_item(*r._doc, arr) = v;
+}
+
+template <typename Rep>
+void push_back_string (Rep & r, string_view const & s)
+{
+    auto & arr = container_for_modification(r, type_tag::array);
+    auto v = make_string(*r._doc, s.data(), s.size(), false);
+    append_item(*r._doc, arr) = v;
+}
+
+template <typename Rep>
+void push_back_copy (Rep & r, value const & src)
+{
+    auto & arr = container_for_modification(r, type_tag::array);
+    auto v = clone(*r._doc, src, false);
+    append_item(*r._doc, arr) = v;
+}
+
+// Replaces the value referenced by @a ref by the copy of @a src
+void assign_copy (native::ref & ref, value const & src)
+{
+    auto & slot = target(ref);
+    auto v = clone(*ref._doc, src, false);
+    replace(*ref._doc, slot, v);
+}
+
+// Mutable access to the array element, array is extended by nulls if needed
+template <typename Rep>
+native::ref subscript (Rep & r, std::size_t pos)
+{
+    auto & arr = target(r);
+
+    if (arr.type == type_tag::invalid || arr.type == type_tag::null)
+        replace(*r._doc, arr, make_scalar(type_tag::array));
+
+    if (arr.type != type_tag::array)
+        return native::ref{};
+
+    while (arr.n <= pos)
+        append_item(*r._doc, arr);
+
+    return native::ref{arr.u.items + pos, r._doc};
+}
+
+// Mutable access to the object member, missing member is added as null
+template <typename Rep>
+native::ref subscript (Rep & r, string_view const & key)
+{
+    auto & obj = target(r);
+
+    if (obj.type == type_tag::invalid || obj.type == type_tag::null)
+        replace(*r._doc, obj, make_scalar(type_tag::object));
+
+    if (obj.type != type_tag::object)
+        return native::ref{};
+
+    return native::ref{& insert_member(*r._doc, obj, key.data(), key.size()), r._doc};
+}
+
+inline JSON_VIEW make_view (value const * ptr) noexcept
+{
+    JSON_VIEW result;
+    result._ptr = const_cast<value *>(ptr);
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Serialization
+////////////////////////////////////////////////////////////////////////////////
+// Produces the same output as `native_dump()` for the jansson tree
+void dump (value const & v, std::size_t flags, int precision, std::string & out, int depth)
+{
+    switch (v.type) {
+        case type_tag::null:
+            out.append("null", 4);
+            break;
+
+        case type_tag::true_value:
+            out.append("true", 4);
+            break;
+
+        case type_tag::false_value:
+            out.append("false", 5);
+            break;
+
+        case type_tag::integer:
+            native_dump_integer(static_cast<json_int_t>(v.u.i), out);
+            break;
+
+        case type_tag::real:
+            native_dump_real(v.u.d, precision, out);
+            break;
+
+        case type_tag::string:
+            native_dump_string(v.u.s, v.n, out);
+            break;
+
+        case type_tag::array:
+            out.push_back('[');
+
+            if (v.n > 0) {
+                native_dump_indent(depth + 1, false, flags, out);
+
+                for (std::size_t i = 0; i < v.n; i++) {
+                    if (i > 0) {
+                        out.push_back(',');
+                        native_dump_indent(depth + 1, true, flags, out);
+                    }
+
+                    dump(v.u.items[i], flags, precision, out, depth + 1);
+                }
+
+                native_dump_indent(depth, false, flags, out);
+            }
+
+            out.push_back(']');
+            break;
+
+        case type_tag::object:
+            out.push_back('{');
+
+            if (v.n > 0) {
+                native_dump_indent(depth + 1, false, flags, out);
+
+                for (std::size_t i = 0; i < v.n; i++) {
+                    auto & m = v.u.members[i];
+
+                    if (i > 0) {
+                        out.push_back(',');
+                        native_dump_indent(depth + 1, true, flags, out);
+                    }
+
+                    native_dump_string(m.key.u.s, m.key.n, out);
+
+                    if (flags & JSON_COMPACT)
+                        out.push_back(':');
+                    else
+                        out.append(": ", 2);
+
+                    dump(m.val, flags, precision, out, depth + 1);
+                }
+
+                native_dump_indent(depth, false, flags, out);
+            }
+
+            out.push_back('}');
+            break;
+
+        default:
+            break;
+    }
+}
+
+inline void dump (value const & v, std::size_t flags, std::string & out)
+{
+    dump(v, flags, static_cast<int>((flags >> 11) & 0x1F), out, 0);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Parsing
+////////////////////////////////////////////////////////////////////////////////
+using structural::parse_errc;
+
+// Builds the document tree from the parser events. Cells of the open
+// containers are collected in the stack (members as key/value pairs) and
+// moved into the exactly sized pool vectors when the container is closed.
+class native_builder
+{
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    struct frame
+    {
+        std::size_t start {0};            // Position of the first cell in the stack
+        std::size_t replace {0};          // Member replaced by the next value (position + 1)
+        std::vector<std::uint32_t> keys;  // Hash table of the keys of the large object
+        std::size_t free_entry {0};       // Table entry for the key not found
+    };
+
+    document & _doc;
+    std::vector<value> _stack;
+    std::vector<frame> _frames; // Frames are reused to keep allocated tables
+    std::size_t _depth {0};
+    bool _reject_duplicates {false};
+    value _root {};
+
+public:
+    native_builder (document & doc, bool reject_duplicates)
+        : _doc(doc)
+        , _reject_duplicates(reject_duplicates)
+    {}
+
+    value const & root () const noexcept
+    {
+        return _root;
+    }
+
+    parse_errc on_null () { return add(make_scalar(type_tag::null)); }
+    parse_errc on_bool (bool value) { return add(make_bool(value)); }
+    parse_errc on_integer (std::int64_t value) { return add(make_integer(value)); }
+    parse_errc on_real (double value) { return add(make_real(value)); }
+
+    parse_errc on_string (char const * s, std::size_t n)
+    {
+        return add(make_string(_doc, s, n, true));
+    }
+
+    parse_errc on_key (char const * s, std::size_t n)
+    {
+        auto & f = _frames[_depth - 1];
+        auto count = (_stack.size() - f.start) / 2;
+        auto pos = find_key(f, count, s, n);
+
+        if (pos != npos) {
+            if (_reject_duplicates)
+                return parse_errc::duplicate_key;
+
+            // Last value wins, member keeps the position of the first one
+            f.replace = pos + 1;
+            return parse_errc::success;
+        }
+
+        if (!f.keys.empty())
+            f.keys[f.free_entry] = static_cast<std::uint32_t>(count + 1);
+
+        _stack.push_back(make_string(_doc, s, n, true));
+        return parse_errc::success;
+    }
+
+    parse_errc on_begin_array () { return push(); }
+    parse_errc on_begin_object () { return push(); }
+
+    parse_errc on_end_array ()
+    {
+        auto & f = _frames[--_depth];
+        auto n = _stack.size() - f.start;
+        auto v = make_scalar(type_tag::array);
+
+        if (n > 0) {
+            auto items = allocate_items(_doc, v, n, true);
+            std::memcpy(items, _stack.data() + f.start, n * sizeof(value));
+            v.n = static_cast<std::uint32_t>(n);
+            _stack.resize(f.start);
+        }
+
+        return add(v);
+    }
+
+    parse_errc on_end_object ()
+    {
+        auto & f = _frames[--_depth];
+        auto n = (_stack.size() - f.start) / 2;
+        auto v = make_scalar(type_tag::object);
+
+        if (n > 0) {
+            auto members = allocate_members(_doc, v, n, true);
+            std::memcpy(members, _stack.data() + f.start, n * sizeof(member));
+            v.n = static_cast<std::uint32_t>(n);
+            _stack.resize(f.start);
+
+            if (n > native::index_threshold)
+                build_table(v);
+        }
+
+        return add(v);
+    }
+
+private:
+    parse_errc push ()
+    {
+        if (_frames.size() == _depth)
+            _frames.emplace_back();
+
+        auto & f = _frames[_depth++];
+        f.start = _stack.size();
+        f.replace = 0;
+        f.keys.clear();
+
+        return parse_errc::success;
+    }
+
+    parse_errc add (value const & v)
+    {
+        if (_depth == 0) {
+            _root = v;
+            return parse_errc::success;
+        }
+
+        auto & f = _frames[_depth - 1];
+
+        if (f.replace > 0) {
+            _stack[f.start + 2 * (f.replace - 1) + 1] = v;
+            f.replace = 0;
+            return parse_errc::success;
+        }
+
+        _stack.push_back(v);
+        return parse_errc::success;
+    }
+
+    // Keys of the small objects are compared linearly, keys of the large ones
+    // are looked up in the frame hash table (built on demand)
+    std::size_t find_key (frame & f, std::size_t count, char const * s, std::size_t n)
+    {
+        auto keys = _stack.data() + f.start;
+
+        if (count <= native::index_threshold) {
+            for (std::size_t i = 0; i < count; i++) {
+                if (key_equals(keys[2 * i], s, n))
+                    return i;
+            }
+
+            return npos;
+        }
+
+        if (f.keys.size() < 2 * (count + 1)) {
+            f.keys.assign(table_size(2 * (count + 1)), 0);
+
+            for (std::size_t i = 0; i < count; i++)
+                table_insert(f.keys.data(), f.keys.size() - 1, keys[2 * i], i);
+        }
+
+        auto mask = f.keys.size() - 1;
+
+        for (auto i = hash_key(s, n) & mask; ; i = (i + 1) & mask) {
+            auto e = f.keys[i];
+
+            if (e == 0) {
+                f.free_entry = i;
+                return npos;
+            }
+
+            if (key_equals(keys[2 * (e - 1)], s, n))
+                return e - 1;
+        }
+    }
+};
+
+// Parses @a buffer into the new document. On failure returns @c nullptr and
+// stores error location and description into @a line and @a text.
+document * load (char const * buffer, std::size_t len, bool reject_duplicates
+    , bool allow_nul, int & line, std::string & text)
+{
+    // Structural index positions are 32-bit
+    if (len > structural::index::max_length) {
+        line = -1;
+        text = "input is too large";
+        return nullptr;
+    }
+
+    if (!buffer) {
+        line = -1;
+        text = "wrong arguments";
+        return nullptr;
+    }
+
+    structural::index idx;
+
+    {
+        instrumentation::phase_timer timer {instrumentation::phase::index};
+        idx.build(buffer, len);
+    }
+
+    std::unique_ptr<document> doc {new document {1, initial_pool_size(len)}};
+    native_builder builder {*doc, reject_duplicates};
+
+    structural::parse_options opts;
+    opts.allow_nul = allow_nul;
+
+    structural::parser<native_builder> p {buffer, len, idx, builder, opts};
+    parse_errc rc = parse_errc::success;
+
+    {
+        instrumentation::phase_timer timer {instrumentation::phase::build};
+
+        try {
+            rc = p.parse();
+        } catch (std::bad_alloc const &) {
+            rc = parse_errc::out_of_memory;
+        } catch (error const &) {
+            rc = parse_errc::handler_failure;
+        }
+    }
+
+    if (rc != parse_errc::success) {
+        int column = 0;
+        p.location(p.error_position(), line, column);
+        text = structural::message(rc);
+        return nullptr;
+    }
+
+    doc->root = builder.root();
+    return doc.release();
+}
+
+document * load_file (char const * path, int & line, std::string & text)
+{
+    mapped_file file;
+    int rc = 0;
+
+    {
+        instrumentation::phase_timer timer {instrumentation::phase::read};
+        rc = file.open(path);
+    }
+
+    if (rc != 0) {
+        line = -1;
+        text = std::string{"unable to open "} + path + ": " + std::strerror(rc);
+        return nullptr;
+    }
+
+    return load(file.data(), file.size(), true, true, line, text);
+}
+
+// Converts jansson tree (result of the projection loader) to the document tree
+value import (document & d, json_t * j)
+{
+    switch (json_typeof(j)) {
+        case JSON_NULL: return make_scalar(type_tag::null);
+        case JSON_TRUE: return make_bool(true);
+        case JSON_FALSE: return make_bool(false);
+        case JSON_INTEGER: return make_integer(json_integer_value(j));
+        case JSON_REAL: return make_real(json_real_value(j));
+
+        case JSON_STRING:
+            return make_string(d, json_string_value(j), json_string_length(j), true);
+
+        case JSON_ARRAY: {
+            auto v = make_scalar(type_tag::array);
+            auto n = json_array_size(j);
+
+            if (n > 0) {
+                auto items = allocate_items(d, v, n, true);
+
+                for (std::size_t i = 0; i < n; i++)
+                    items[i] = import(d, json_array_get(j, i));
+
+                v.n = static_cast<std::uint32_t>(n);
+            }
+
+            return v;
+        }
+
+        case JSON_OBJECT: {
+            auto v = make_scalar(type_tag::object);
+            auto n = json_object_size(j);
+
+            if (n > 0) {
+                auto members = allocate_members(d, v, n, true);
+                std::size_t i = 0;
+
+                for (auto it = json_object_iter(j); it; it = json_object_iter_next(j, it), i++) {
+#if JANSSON_VERSION_HEX >= 0x020E00
+                    members[i].key = make_string(d, json_object_iter_key(it)
+                        , json_object_iter_key_len(it), true);
+#else
+                    auto key = json_object_iter_key(it);
+                    members[i].key = make_string(d, key, std::strlen(key), true);
+#endif
+                    members[i].val = import(d, json_object_iter_value(it));
+                }
+
+                v.n = static_cast<std::uint32_t>(n);
+
+                if (n > native::index_threshold)
+                    build_table(v);
+            }
+
+            return v;
+        }
+    }
+
+    return value{};
+}
+
+document * import (json_t * j)
+{
+    std::unique_ptr<document> doc {new document {1}};
+    doc->root = import(*doc, j);
+    json_decref(j);
+    return doc.release();
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+// rep
+////////////////////////////////////////////////////////////////////////////////
+native::rep::rep ()
+{}
+
+native::rep::rep (rep const & other)
+{
+    if (other._doc && other._doc->leaked) {
+        assign_copy(*this, other._ptr);
+    } else if (other._doc) {
+        retain(other._doc, true);
+        _ptr = other._ptr;
+        _doc = other._doc;
+    }
+}
+
+native::rep::rep (rep && other)
+{
+    _ptr = other._ptr;
+    _doc = other._doc;
+    other._ptr = nullptr;
+    other._doc = nullptr;
+}
+
+native::rep::~rep ()
+{
+    if (_doc)
+        unref(_doc, true);
+
+    _ptr = nullptr;
+    _doc = nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ref
+////////////////////////////////////////////////////////////////////////////////
+native::ref::ref ()
+{}
+
+native::ref::ref (value * ptr, document * doc)
+{
+    if (ptr) {
+        _ptr = ptr;
+        _doc = doc;
+        retain(doc, false);
+    }
+}
+
+native::ref::ref (ref const & other)
+{
+    if (other._doc) {
+        retain(other._doc, false);
+        _ptr = other._ptr;
+        _doc = other._doc;
+    }
+}
+
+native::ref::ref (ref && other)
+{
+    _ptr = other._ptr;
+    _doc = other._doc;
+    other._ptr = nullptr;
+    other._doc = nullptr;
+}
+
+native::ref::~ref ()
+{
+    if (_doc)
+        unref(_doc, false);
+
+    _ptr = nullptr;
+    _doc = nullptr;
+}
+
+} // namespace backend
+
+////////////////////////////////////////////////////////////////////////////////
+// JSON reference destructor
+////////////////////////////////////////////////////////////////////////////////
+// Placed here to avoid error: specialization of ‘jeyson::json_ref<Backend>::~json_ref()
+// [with Backend = jeyson::backend::native]’ after instantiation
+template <>
+json_ref<BACKEND>::~json_ref ()
+{}
+
+////////////////////////////////////////////////////////////////////////////////
+// JSON value
+////////////////////////////////////////////////////////////////////////////////
+template <>
+json<BACKEND>::operator bool () const noexcept
+{
+    return NATIVE(*this) != nullptr;
+}
+
+//------------------------------------------------------------------------------
+// Constructors, destructors, assignment operators
+//------------------------------------------------------------------------------
+template <>
+json<BACKEND>::json ()
+{}
+
+template <>
+json<BACKEND>::json (std::nullptr_t)
+{
+    backend::reset(*this);
+}
+
+template <>
+json<BACKEND>::json (bool value)
+{
+    backend::reset(*this) = backend::make_bool(value);
+}
+
+template <>
+json<BACKEND>::json (std::intmax_t value)
+{
+    backend::reset(*this) = backend::make_integer(value);
+}
+
+template <>
+json<BACKEND>::json (double value)
+{
+    backend::reset(*this) = backend::make_real(value);
+}
+
+template <>
+json<BACKEND>::json (string_view const & value)
+{
+    auto & root = backend::reset(*this);
+    root = backend::make_string(*_doc, value.data(), value.size(), false);
+}
+
+template <>
+json<BACKEND>::json (json const & other)
+    : rep_type(other)
+{}
+
+template <>
+json<BACKEND>::json (json && other)
+    : rep_type(std::move(other))
+{}
+
+template <>
+json<BACKEND>::json (json_ref<BACKEND> const & j)
+{
+    backend::assign_copy(*this, j._ptr);
+}
+
+template <>
+json<BACKEND>::json (json_ref<BACKEND> && j)
+{
+    backend::assign_copy(*this, j._ptr);
+
+    // The reference is released by the temporary
+    BACKEND::ref tmp {std::move(j)};
+}
+
+template <>
+json<BACKEND>::~json ()
+{}
+
+template <>
+json<BACKEND> & json<BACKEND>::operator = (json const & other)
+{
+    if (this != & other && _doc != other._doc) {
+        rep_type tmp {other};
+        backend::swap(*this, tmp);
+    }
+
+    return *this;
+}
+
+template <>
+json<BACKEND> &
+json<BACKEND>::operator = (json && other)
+{
+    if (this != & other && _doc != other._doc) {
+        rep_type tmp {std::move(other)};
+        backend::swap(*this, tmp);
+    }
+
+    return *this;
+}
+
+template <>
+json<BACKEND> &
+json<BACKEND>::operator = (json_ref<BACKEND> const & j)
+{
+    backend::assign_copy(*this, j._ptr);
+    return *this;
+}
+
+template <>
+json<BACKEND> &
+json<BACKEND>::operator = (json_ref<BACKEND> && j)
+{
+    backend::assign_copy(*this, j._ptr);
+
+    // The reference is released by the temporary
+    BACKEND::ref tmp {std::move(j)};
+    return *this;
+}
+
+template <>
+void
+json<BACKEND>::assign_helper (std::nullptr_t)
+{
+    if (!_ptr || _ptr->type != BACKEND::type_tag::null)
+        backend::reset(*this);
+}
+
+template <>
+void
+json<BACKEND>::assign_helper (bool b)
+{
+    backend::reset(*this) = backend::make_bool(b);
+}
+
+template <>
+void
+json<BACKEND>::assign_helper (std::intmax_t n)
+{
+    if (!_ptr || _ptr->type != BACKEND::type_tag::integer) {
+        backend::reset(*this) = backend::make_integer(n);
+    } else {
+        backend::detach(*this);
+        _ptr->u.i = static_cast<std::int64_t>(n);
+    }
+}
+
+template <>
+void
+json<BACKEND>::assign_helper (double n)
+{
+    if (!_ptr || _ptr->type != BACKEND::type_tag::real) {
+        backend::reset(*this) = backend::make_real(n);
+    } else {
+        backend::detach(*this);
+        _ptr->u.d = n;
+    }
+}
+
+template <>
+void
+json<BACKEND>::assign_helper (string_view const & s)
+{
+    if (!_ptr || _ptr->type != BACKEND::type_tag::string) {
+        auto & root = backend::reset(*this);
+        root = backend::make_string(*_doc, s.data(), s.size(), false);
+    } else {
+        backend::detach(*this);
+        auto v = backend::make_string(*_doc, s.data(), s.size(), false);
+        backend::replace(*_doc, *_ptr, v);
+    }
+}
+
+//------------------------------------------------------------------------------
+// Modifiers
+//------------------------------------------------------------------------------
+template <>
+void
+json<BACKEND>::swap (json & other)
+{
+    backend::swap(*this, other);
+}
+
+template <>
+json<BACKEND>
+json<BACKEND>::deep_copy () const
+{
+    json result;
+
+    if (NATIVE(*this))
+        backend::assign_copy(result, NATIVE(*this));
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+// Save
+//------------------------------------------------------------------------------
+template <>
+void json<BACKEND>::save (pfs::filesystem::path const & path
+    , bool compact
+    , int indent
+    , int precision)
+{
+    std::size_t flags = JSON_ENCODE_ANY;
+
+    if (compact) {
+        flags |= JSON_COMPACT;
+    } else {
+        if (indent > 31)
+            indent = 31;
+
+        if (indent > 0)
+            flags |= JSON_INDENT(indent);
+    }
+
+    if (precision > 31)
+        precision = 31;
+
+    if (precision > 0)
+        flags |= JSON_REAL_PRECISION(precision);
+
+    instrumentation::call_record record {instrumentation::operation::save};
+    std::string text;
+    int rc = -1;
+
+    {
+        instrumentation::phase_timer timer {instrumentation::phase::dump};
+
+        if (NATIVE(*this))
+            backend::dump(*NATIVE(*this), flags, text);
+
+        auto fp = std::fopen(pfs::utf8_encode_path(path).c_str(), "wb");
+
+        if (fp) {
+            if (std::fwrite(text.data(), 1, text.size(), fp) == text.size())
+                rc = 0;
+
+            if (std::fclose(fp) != 0)
+                rc = -1;
+        }
+    }
+
+    if (auto r = record.get()) {
+        record.stop();
+
+        if (NATIVE(*this))
+            backend::collect_node_stats(*NATIVE(*this), *r);
+
+        if (rc < 0)
+            r->failures++;
+        else
+            r->bytes_out = text.size();
+    }
+
+    if (rc < 0) {
+        throw error {
+              make_error_code(pfs::errc::backend_error)
+            , tr::f_("save JSON representation to file failure: {}", pfs::utf8_encode_path(path))
+        };
+    }
+}
+
+//------------------------------------------------------------------------------
+// Parsing
+//------------------------------------------------------------------------------
+template <>
+json<BACKEND>
+json<BACKEND>::parse (char const * source, std::size_t len, error * perr)
+{
+    instrumentation::call_record record {instrumentation::operation::parse};
+    int line = 0;
+    std::string text;
+
+    // Duplicate keys are accepted, the last value wins (as in `json_loadb()`)
+    auto doc = backend::load(source, len, false, false, line, text);
+
+    if (auto r = record.get()) {
+        record.stop();
+        r->bytes_in = len;
+        r->failures += doc ? 0 : 1;
+
+        if (doc)
+            backend::collect_node_stats(doc->root, *r);
+    }
+
+    if (!doc) {
+        pfs::throw_or(perr, make_error_code(pfs::errc::backend_error)
+            , tr::f_("parse error at line {}: {}", line, text));
+
+        return json<BACKEND>{};
+    }
+
+    json<BACKEND> result;
+    result._doc = doc;
+    result._ptr = & doc->root;
+
+    return result;
+}
+
+template <>
+json<BACKEND>
+json<BACKEND>::parse (string_view source, error * perr)
+{
+    return parse(source.data(), source.size(), perr);
+}
+
+template <>
+json<BACKEND>
+json<BACKEND>::parse (std::string const & source, error * perr)
+{
+    return parse(source.data(), source.size(), perr);
+}
+
+template <>
+json<BACKEND>
+json<BACKEND>::parse (pfs::filesystem::path const & path, error * perr)
+{
+    instrumentation::call_record record {instrumentation::operation::parse};
+    int line = 0;
+    std::string text;
+    auto doc = backend::load_file(pfs::utf8_encode_path(path).c_str(), line, text);
+
+    if (auto r = record.get()) {
+        record.stop();
+        std::error_code ec;
+        auto size = pfs::filesystem::file_size(path, ec);
+
+        if (!ec)
+            r->bytes_in = static_cast<std::size_t>(size);
+
+        r->failures += doc ? 0 : 1;
+
+        if (doc)
+            backend::collect_node_stats(doc->root, *r);
+    }
+
+    if (!doc) {
+        pfs::throw_or(perr, make_error_code(pfs::errc::backend_error)
+            , tr::f_("parse error at {}:{}: {}"
+                , line
+                , pfs::utf8_encode_path(path)
+                , text));
+
+        return json<BACKEND>{};
+    }
+
+    json<BACKEND> result;
+    result._doc = doc;
+    result._ptr = & doc->root;
+
+    return result;
+}
+
+namespace {
+
+bool compile_projection (std::vector<std::string> const & paths
+    , backend::projection & proj, error * perr)
+{
+    for (auto const & p: paths) {
+        if (!proj.add(p.data(), p.size())) {
+            pfs::throw_or(perr, make_error_code(std::errc::invalid_argument)
+                , tr::f_("invalid JSON Pointer: {}", p));
+
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} // namespace
+
+// Projection is parsed by the projection loader into the (small) jansson tree
+// which is converted to the document
+template <>
+json<BACKEND>
+json<BACKEND>::parse (char const * source, std::size_t len
+    , std::vector<std::string> const & paths, error * perr)
+{
+    backend::projection proj;
+
+    if (!compile_projection(paths, proj, perr))
+        return json<BACKEND>{};
+
+    json_error_t jerror;
+    instrumentation::call_record record {instrumentation::operation::parse};
+    auto j = backend::native_load_projection(source, len, JSON_DECODE_ANY, proj, & jerror);
+    auto doc = j ? backend::import(j) : nullptr;
+
+    if (auto r = record.get()) {
+        record.stop();
+        r->bytes_in = len;
+        r->failures += doc ? 0 : 1;
+
+        if (doc)
+            backend::collect_node_stats(doc->root, *r);
+    }
+
+    if (!doc) {
+        pfs::throw_or(perr, make_error_code(pfs::errc::backend_error)
+            , tr::f_("parse error at line {}: {}", jerror.line, jerror.text));
+
+        return json<BACKEND>{};
+    }
+
+    json<BACKEND> result;
+    result._doc = doc;
+    result._ptr = & doc->root;
+
+    return result;
+}
+
+template <>
+json<BACKEND>
+json<BACKEND>::parse (pfs::filesystem::path const & path
+    , std::vector<std::string> const & paths, error * perr)
+{
+    backend::projection proj;
+
+    if (!compile_projection(paths, proj, perr))
+        return json<BACKEND>{};
+
+    json_error_t jerror;
+    auto flags = JSON_DECODE_ANY | JSON_REJECT_DUPLICATES | JSON_ALLOW_NUL;
+    instrumentation::call_record record {instrumentation::operation::parse};
+    auto j = backend::native_load_file_projection(pfs::utf8_encode_path(path).c_str()
+        , flags, proj, & jerror);
+    auto doc = j ? backend::import(j) : nullptr;
+
+    if (auto r = record.get()) {
+        record.stop();
+        std::error_code ec;
+        auto size = pfs::filesystem::file_size(path, ec);
+
+        if (!ec)
+            r->bytes_in = static_cast<std::size_t>(size);
+
+        r->failures += doc ? 0 : 1;
+
+        if (doc)
+            backend::collect_node_stats(doc->root, *r);
+    }
+
+    if (!doc) {
+        pfs::throw_or(perr, make_error_code(pfs::errc::backend_error)
+            , tr::f_("parse error at {}:{}: {}"
+                , jerror.line
+                , pfs::utf8_encode_path(path)
+                , jerror.text));
+
+        return json<BACKEND>{};
+    }
+
+    json<BACKEND> result;
+    result._doc = doc;
+    result._ptr = & doc->root;
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+// Comparison operators
+//------------------------------------------------------------------------------
+template <>
+bool
+operator == (json<BACKEND> const & lhs, json<BACKEND> const & rhs)
+{
+    if (!NATIVE(lhs) || !NATIVE(rhs))
+        return !NATIVE(lhs) && !NATIVE(rhs);
+
+    return backend::equals(*NATIVE(lhs), *NATIVE(rhs));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// JSON reference
+////////////////////////////////////////////////////////////////////////////////
+template <>
+json_ref<BACKEND>::json_ref ()
+{}
+
+template <>
+json_ref<BACKEND>::json_ref (json_ref const & other)
+    : rep_type(other)
+{}
+
+template <>
+json_ref<BACKEND>::json_ref (json_ref && other)
+    : rep_type(std::move(other))
+{}
+
+template <>
+json_ref<BACKEND>::json_ref (BACKEND::ref && other)
+    : BACKEND::ref(std::move(other))
+{}
+
+template <>
+json_ref<BACKEND>::json_ref (json<BACKEND> & j)
+{
+    backend::leak(j);
+
+    if (j._ptr) {
+        backend::retain(j._doc, false);
+        _ptr = j._ptr;
+        _doc = j._doc;
+    }
+}
+
+// The reference takes over the document of the value
+template <>
+json_ref<BACKEND>::json_ref (json<BACKEND> && j)
+{
+    backend::detach(j);
+
+    if (j._ptr) {
+        j._doc->owners.fetch_sub(1, std::memory_order_acq_rel);
+        _ptr = j._ptr;
+        _doc = j._doc;
+        j._ptr = nullptr;
+        j._doc = nullptr;
+    }
+}
+
+template <>
+json_ref<BACKEND> &
+json_ref<BACKEND>::operator = (json_ref const & j)
+{
+    if (j._ptr)
+        backend::assign_copy(*this, *j._ptr);
+
+    return *this;
+}
+
+template <>
+json_ref<BACKEND> &
+json_ref<BACKEND>::operator = (json_ref && j)
+{
+    if (j._ptr) {
+        backend::assign_copy(*this, *j._ptr);
+
+        // The reference is released by the temporary
+        BACKEND::ref tmp {std::move(j)};
+    }
+
+    return *this;
+}
+
+template <>
+json_ref<BACKEND> & json_ref<BACKEND>::operator = (json<BACKEND> const & j)
+{
+    if (j._ptr)
+        backend::assign_copy(*this, *j._ptr);
+
+    return *this;
+}
+
+template <>
+json_ref<BACKEND> & json_ref<BACKEND>::operator = (json<BACKEND> && j)
+{
+    if (j._ptr) {
+        backend::assign_copy(*this, *j._ptr);
+
+        // The value is released by the temporary
+        BACKEND::rep tmp {std::move(j)};
+    }
+
+    return *this;
+}
+
+template <>
+json_ref<BACKEND>::operator bool () const noexcept
+{
+    return _ptr != nullptr;
+}
+
+template <>
+void
+json_ref<BACKEND>::assign_helper (std::nullptr_t)
+{
+    auto & slot = backend::target(*this);
+    backend::replace(*_doc, slot, backend::make_scalar(BACKEND::type_tag::null));
+}
+
+template <>
+void
+json_ref<BACKEND>::assign_helper (bool b)
+{
+    auto & slot = backend::target(*this);
+    backend::replace(*_doc, slot, backend::make_bool(b));
+}
+
+template <>
+void
+json_ref<BACKEND>::assign_helper (std::intmax_t n)
+{
+    auto & slot = backend::target(*this);
+    backend::replace(*_doc, slot, backend::make_integer(n));
+}
+
+template <>
+void
+json_ref<BACKEND>::assign_helper (double n)
+{
+    auto & slot = backend::target(*this);
+    backend::replace(*_doc, slot, backend::make_real(n));
+}
+
+template <>
+void
+json_ref<BACKEND>::assign_helper (string_view const & s)
+{
+    auto & slot = backend::target(*this);
+    auto v = backend::make_string(*_doc, s.data(), s.size(), false);
+    backend::replace(*_doc, slot, v);
+}
+
+//------------------------------------------------------------------------------
+// Modifiers
+//------------------------------------------------------------------------------
+template <>
+void
+json_ref<BACKEND>::swap (json_ref & other)
+{
+    backend::swap(*this, other);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Traits interface
+////////////////////////////////////////////////////////////////////////////////
+template <typename Derived>
+bool traits_interface<Derived>::is_null () const noexcept
+{
+    return BACKEND::type_of(*static_cast<Derived const *>(this)) == BACKEND::type_tag::null;
+}
+
+template bool traits_interface<JSON>::is_null() const noexcept;
+template bool traits_interface<JSON_REF>::is_null() const noexcept;
+template bool traits_interface<JSON_VIEW>::is_null() const noexcept;
+
+template <typename Derived>
+bool
+traits_interface<Derived>::is_bool () const noexcept
+{
+    auto type = BACKEND::type_of(*static_cast<Derived const *>(this));
+    return type == BACKEND::type_tag::true_value || type == BACKEND::type_tag::false_value;
+}
+
+template bool traits_interface<JSON>::is_bool() const noexcept;
+template bool traits_interface<JSON_REF>::is_bool() const noexcept;
+template bool traits_interface<JSON_VIEW>::is_bool() const noexcept;
+
+template <typename Derived>
+bool
+traits_interface<Derived>::is_integer () const noexcept
+{
+    return BACKEND::type_of(*static_cast<Derived const *>(this)) == BACKEND::type_tag::integer;
+}
+
+template bool traits_interface<JSON>::is_integer() const noexcept;
+template bool traits_interface<JSON_REF>::is_integer() const noexcept;
+template bool traits_interface<JSON_VIEW>::is_integer() const noexcept;
+
+template <typename Derived>
+bool
+traits_interface<Derived>::is_real () const noexcept
+{
+    return BACKEND::type_of(*static_cast<Derived const *>(this)) == BACKEND::type_tag::real;
+}
+
+template bool traits_interface<JSON>::is_real() const noexcept;
+template bool traits_interface<JSON_REF>::is_real() const noexcept;
+template bool traits_interface<JSON_VIEW>::is_real() const noexcept;
+
+template <typename Derived>
+bool
+traits_interface<Derived>::is_string () const noexcept
+{
+    return BACKEND::type_of(*static_cast<Derived const *>(this)) == BACKEND::type_tag::string;
+}
+
+template bool traits_interface<JSON>::is_string() const noexcept;
+template bool traits_interface<JSON_REF>::is_string() const noexcept;
+template bool traits_interface<JSON_VIEW>::is_string() const noexcept;
+
+template <typename Derived>
+bool
+traits_interface<Derived>::is_array () const noexcept
+{
+    return BACKEND::type_of(*static_cast<Derived const *>(this)) == BACKEND::type_tag::array;
+}
+
+template bool traits_interface<JSON>::is_array() const noexcept;
+template bool traits_interface<JSON_REF>::is_array() const noexcept;
+template bool traits_interface<JSON_VIEW>::is_array() const noexcept;
+
+template <typename Derived>
+bool
+traits_interface<Derived>::is_object () const noexcept
+{
+    return BACKEND::type_of(*static_cast<Derived const *>(this)) == BACKEND::type_tag::object;
+}
+
+template bool traits_interface<JSON>::is_object() const noexcept;
+template bool traits_interface<JSON_REF>::is_object() const noexcept;
+template bool traits_interface<JSON_VIEW>::is_object() const noexcept;
+
+////////////////////////////////////////////////////////////////////////////////
+// Modifiers interface
+////////////////////////////////////////////////////////////////////////////////
+template <typename Derived, typename Backend>
+void
+modifiers_interface<Derived, Backend>::insert_helper (string_view const & key
+    , std::nullptr_t)
+{
+    auto self = static_cast<Derived *>(this);
+    backend::insert(*self, key, backend::make_scalar(BACKEND::type_tag::null));
+}
+
+template void modifiers_interface<JSON, BACKEND>::insert_helper (string_view const &, std::nullptr_t);
+template void modifiers_interface<JSON_REF, BACKEND>::insert_helper (string_view const &, std::nullptr_t);
+
+template <typename Derived, typename Backend>
+void
+modifiers_interface<Derived, Backend>::insert_helper (string_view const & key, bool b)
+{
+    auto self = static_cast<Derived *>(this);
+    backend::insert(*self, key, backend::make_bool(b));
+}
+
+template void modifiers_interface<JSON, BACKEND>::insert_helper (string_view const &, bool);
+template void modifiers_interface<JSON_REF, BACKEND>::insert_helper (string_view const &, bool);
+
+template <typename Derived, typename Backend>
+void
+modifiers_interface<Derived, Backend>::insert_helper (string_view const & key, std::intmax_t n)
+{
+    auto self = static_cast<Derived *>(this);
+    backend::insert(*self, key, backend::make_integer(n));
+}
+
+template void modifiers_interface<JSON, BACKEND>::insert_helper (string_view const &, std::intmax_t);
+template void modifiers_interface<JSON_REF, BACKEND>::insert_helper (string_view const &, std::intmax_t);
+
+template <typename Derived, typename Backend>
+void
+modifiers_interface<Derived, Backend>::insert_helper (string_view const & key, double n)
+{
+    auto self = static_cast<Derived *>(this);
+    backend::insert(*self, key, backend::make_real(n));
+}
+
+template void modifiers_interface<JSON, BACKEND>::insert_helper (string_view const &, double);
+template void modifiers_interface<JSON_REF, BACKEND>::insert_helper (string_view const &, double);
+
+template <typename Derived, typename Backend>
+void
+modifiers_interface<Derived, Backend>::insert_helper (string_view const & key, string_view const & s)
+{
+    auto self = static_cast<Derived *>(this);
+    backend::insert_string(*self, key, s);
+}
+
+template void modifiers_interface<JSON, BACKEND>::insert_helper (string_view const &, string_view const &);
+template void modifiers_interface<JSON_REF, BACKEND>::insert_helper (string_view const &, string_view const &);
+
+template <typename Derived, typename Backend>
+void
+modifiers_interface<Derived, Backend>::insert_helper (string_view const & key
+    , value_type const & value)
+{
+    auto self = static_cast<Derived *>(this);
+
+    if (!value)
+        throw error {make_error_code(std::errc::invalid_argument), tr::_("attempt to insert unitialized value")};
+
+    backend::insert_copy(*self, key, *NATIVE(value));
+}
+
+template void modifiers_interface<JSON, BACKEND>::insert_helper (string_view const &, value_type const &);
+template void modifiers_interface<JSON_REF, BACKEND>::insert_helper (string_view const &, value_type const &);
+
+// Value is copied to the document and released
+template <typename Derived, typename Backend>
+void
+modifiers_interface<Derived, Backend>::insert (key_type const & key, value_type && value)
+{
+    auto self = static_cast<Derived *>(this);
+
+    if (!value)
+        throw error {make_error_code(std::errc::invalid_argument), tr::_("attempt to insert unitialized value")};
+
+    backend::insert_copy(*self, key, *NATIVE(value));
+
+    // The value is released by the temporary
+    BACKEND::rep tmp {std::move(value)};
+}
+
+template void modifiers_interface<JSON, BACKEND>::insert (key_type const &, value_type &&);
+template void modifiers_interface<JSON_REF, BACKEND>::insert (key_type const &, value_type &&);
+
+template <typename Derived, typename Backend>
+void
+modifiers_interface<Derived, Backend>::push_back_helper (std::nullptr_t)
+{
+    auto self = static_cast<Derived *>(this);
+    backend::push_back(*self, backend::make_scalar(BACKEND::type_tag::null));
+}
+
+template void modifiers_interface<JSON, BACKEND>::push_back_helper (std::nullptr_t);
+template void modifiers_interface<JSON_REF, BACKEND>::push_back_helper (std::nullptr_t);
+
+template <typename Derived, typename Backend>
+void
+modifiers_interface<Derived, Backend>::push_back_helper (bool b)
+{
+    auto self = static_cast<Derived *>(this);
+    backend::push_back(*self, backend::make_bool(b));
+}
+
+template void modifiers_interface<JSON, BACKEND>::push_back_helper (bool);
+template void modifiers_interface<JSON_REF, BACKEND>::push_back_helper (bool);
+
+template <typename Derived, typename Backend>
+void
+modifiers_interface<Derived, Backend>::push_back_helper (std::intmax_t n)
+{
+    auto self = static_cast<Derived *>(this);
+    backend::push_back(*self, backend::make_integer(n));
+}
+
+template void modifiers_interface<JSON, BACKEND>::push_back_helper (std::intmax_t);
+template void modifiers_interface<JSON_REF, BACKEND>::push_back_helper (std::intmax_t);
+
+template <typename Derived, typename Backend>
+void
+modifiers_interface<Derived, Backend>::push_back_helper (double n)
+{
+    auto self = static_cast<Derived *>(this);
+    backend::push_back(*self, backend::make_real(n));
+}
+
+template void modifiers_interface<JSON, BACKEND>::push_back_helper (double);
+template void modifiers_interface<JSON_REF, BACKEND>::push_back_helper (double);
+
+template <typename Derived, typename Backend>
+void
+modifiers_interface<Derived, Backend>::push_back_helper (string_view const & s)
+{
+    auto self = static_cast<Derived *>(this);
+    backend::push_back_string(*self, s);
+}
+
+template void modifiers_interface<JSON, BACKEND>::push_back_helper (string_view const &);
+template void modifiers_interface<JSON_REF, BACKEND>::push_back_helper (string_view const &);
+
+template <typename Derived, typename Backend>
+void
+modifiers_interface<Derived, Backend>::push_back_helper (value_type const & value)
+{
+    auto self = static_cast<Derived *>(this);
+
+    if (!value)
+        throw error {make_error_code(std::errc::invalid_argument), tr::_("attempt to add unitialized value")};
+
+    backend::push_back_copy(*self, *NATIVE(value));
+}
+
+template void modifiers_interface<JSON, BACKEND>::push_back_helper (value_type const &);
+template void modifiers_interface<JSON_REF, BACKEND>::push_back_helper (value_type const &);
+
+// Value is copied to the document and released
+template <typename Derived, typename Backend>
+void
+modifiers_interface<Derived, Backend>::push_back (value_type && value)
+{
+    auto self = static_cast<Derived *>(this);
+
+    if (!value)
+        throw error {make_error_code(std::errc::invalid_argument), tr::_("attempt to add unitialized value")};
+
+    backend::push_back_copy(*self, *NATIVE(value));
+
+    // The value is released by the temporary
+    BACKEND::rep tmp {std::move(value)};
+}
+
+template void modifiers_interface<JSON, BACKEND>::push_back (value_type &&);
+template void modifiers_interface<JSON_REF, BACKEND>::push_back (value_type &&);
+
+////////////////////////////////////////////////////////////////////////////////
+// Capacity interface
+////////////////////////////////////////////////////////////////////////////////
+template <typename Derived, typename Backend>
+typename capacity_interface<Derived, Backend>::size_type
+capacity_interface<Derived, Backend>::size () const noexcept
+{
+    auto self = static_cast<Derived const *>(this);
+    auto ptr = CINATIVE(*self);
+
+    if (!ptr)
+        return 0;
+
+    if (ptr->type == BACKEND::type_tag::object || ptr->type == BACKEND::type_tag::array)
+        return ptr->n;
+
+    // Scalar types
+    return 1;
+}
+
+template capacity_interface<JSON, BACKEND>::size_type capacity_interface<JSON, BACKEND>::size () const noexcept;
+template capacity_interface<JSON_REF, BACKEND>::size_type capacity_interface<JSON_REF, BACKEND>::size () const noexcept;
+template capacity_interface<JSON_VIEW, BACKEND>::size_type capacity_interface<JSON_VIEW, BACKEND>::size () const noexcept;
+
+////////////////////////////////////////////////////////////////////////////////
+// Converter interface
+////////////////////////////////////////////////////////////////////////////////
+template <typename Derived>
+std::string
+converter_interface<Derived>::to_string () const
+{
+    std::string result;
+
+    auto self = static_cast<Derived const *>(this);
+
+    if (CINATIVE(*self)) {
+        instrumentation::call_record record {instrumentation::operation::to_string};
+
+        {
+            instrumentation::phase_timer timer {instrumentation::phase::dump};
+            backend::dump(*CINATIVE(*self), JSON_COMPACT | JSON_ENCODE_ANY, result);
+        }
+
+        if (auto r = record.get()) {
+            record.stop();
+            r->bytes_out = result.size();
+            backend::collect_node_stats(*CINATIVE(*self), *r);
+        }
+    }
+
+    return result;
+};
+
+template std::string converter_interface<JSON>::to_string () const;
+template std::string converter_interface<JSON_REF>::to_string () const;
+template std::string converter_interface<JSON_VIEW>::to_string () const;
+
+////////////////////////////////////////////////////////////////////////////////
+// Mutable element accessor interface
+////////////////////////////////////////////////////////////////////////////////
+template <>
+mutable_element_accessor_interface<JSON, BACKEND>::reference
+mutable_element_accessor_interface<JSON, BACKEND>::operator [] (size_type pos)
+{
+    auto self = static_cast<JSON *>(this);
+    auto result = backend::subscript(*self, pos);
+    backend::leak(*self);
+    return reference{std::move(result)};
+}
+
+template <>
+mutable_element_accessor_interface<JSON, BACKEND>::reference
+mutable_element_accessor_interface<JSON, BACKEND>::operator [] (string_view key)
+{
+    auto self = static_cast<JSON *>(this);
+    auto result = backend::subscript(*self, key);
+    backend::leak(*self);
+    return reference{std::move(result)};
+}
+
+template <>
+mutable_element_accessor_interface<JSON_REF, BACKEND>::reference
+mutable_element_accessor_interface<JSON_REF, BACKEND>::operator [] (size_type pos)
+{
+    auto self = static_cast<JSON_REF *>(this);
+    return reference{backend::subscript(*self, pos)};
+}
+
+template <>
+mutable_element_accessor_interface<JSON_REF, BACKEND>::reference
+mutable_element_accessor_interface<JSON_REF, BACKEND>::operator [] (string_view key)
+{
+    auto self = static_cast<JSON_REF *>(this);
+    return reference{backend::subscript(*self, key)};
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Element accessor interface
+////////////////////////////////////////////////////////////////////////////////
+template <typename Derived, typename Backend>
+// Specify an explicit return type to avoid:
+// error C2244: 'jeyson::element_accessor_interface<Derived,Backend>::operator []':
+// unable to match function definition to an existing declaration
+//typename element_accessor_interface<Derived, Backend>::const_reference
+json_ref<Backend> const
+element_accessor_interface<Derived, Backend>::operator [] (size_type pos) const noexcept
+{
+    auto self = static_cast<Derived const *>(this);
+    auto ptr = CINATIVE(*self);
+
+    if (!ptr || ptr->type != BACKEND::type_tag::array || pos >= ptr->n)
+        return const_reference{};
+
+    return const_reference{BACKEND::ref{ptr->u.items + pos, self->_doc}};
+}
+
+template element_accessor_interface<JSON, BACKEND>::const_reference element_accessor_interface<JSON, BACKEND>::operator [] (size_type pos) const noexcept;
+template element_accessor_interface<JSON_REF, BACKEND>::const_reference element_accessor_interface<JSON_REF, BACKEND>::operator [] (size_type pos) const noexcept;
+
+template <typename Derived, typename Backend>
+//typename element_accessor_interface<Derived, Backend>::const_reference
+json_ref<Backend> const
+element_accessor_interface<Derived, Backend>::operator [] (string_view key) const noexcept
+{
+    auto self = static_cast<Derived const *>(this);
+    auto m = backend::find_member(CINATIVE(*self), key);
+
+    // Not found
+    if (!m)
+        return reference{};
+
+    return reference{BACKEND::ref{& m->val, self->_doc}};
+}
+
+template element_accessor_interface<JSON, BACKEND>::const_reference element_accessor_interface<JSON, BACKEND>::operator [] (string_view key) const noexcept;
+template element_accessor_interface<JSON_REF, BACKEND>::const_reference element_accessor_interface<JSON_REF, BACKEND>::operator [] (string_view key) const noexcept;
+
+template <typename Derived, typename Backend>
+typename element_accessor_interface<Derived, Backend>::const_reference
+element_accessor_interface<Derived, Backend>::at (size_type pos) const
+{
+    auto self = static_cast<Derived const *>(this);
+    auto ptr = CINATIVE(*self);
+
+    if (!ptr || ptr->type != BACKEND::type_tag::array)
+        throw error {make_error_code(errc::incopatible_type), tr::_("array expected")};
+
+    if (pos >= ptr->n) {
+        throw error {
+              make_error_code(std::errc::invalid_argument)
+            , tr::f_("index is out of bounds: {}", pos)
+        };
+    }
+
+    return reference{BACKEND::ref{ptr->u.items + pos, self->_doc}};
+}
+
+template element_accessor_interface<JSON, BACKEND>::const_reference element_accessor_interface<JSON, BACKEND>::at (size_type pos) const;
+template element_accessor_interface<JSON_REF, BACKEND>::const_reference element_accessor_interface<JSON_REF, BACKEND>::at (size_type pos) const;
+
+template <typename Derived, typename Backend>
+typename element_accessor_interface<Derived, Backend>::reference
+element_accessor_interface<Derived, Backend>::at (size_type pos)
+{
+    auto self = static_cast<Derived *>(this);
+    backend::leak(*self);
+    return static_cast<element_accessor_interface const *>(this)->at(pos);
+}
+
+template element_accessor_interface<JSON, BACKEND>::reference element_accessor_interface<JSON, BACKEND>::at (size_type pos);
+template element_accessor_interface<JSON_REF, BACKEND>::reference element_accessor_interface<JSON_REF, BACKEND>::at (size_type pos);
+
+template <typename Derived, typename Backend>
+typename element_accessor_interface<Derived, Backend>::const_reference
+element_accessor_interface<Derived, Backend>::at (string_view key) const
+{
+    auto self = static_cast<Derived const *>(this);
+    auto ptr = CINATIVE(*self);
+
+    if (!ptr || ptr->type != BACKEND::type_tag::object)
+        throw error {make_error_code(errc::incopatible_type), tr::_("object expected")};
+
+    auto m = backend::find_member(*ptr, key.data(), key.size());
+
+    if (!m)
+        throw error {
+              make_error_code(std::errc::invalid_argument)
+            , tr::f_("bad key: {}", pfs::to_string(key))
+        };
+
+    return reference{BACKEND::ref{& m->val, self->_doc}};
+}
+
+template element_accessor_interface<JSON, BACKEND>::const_reference element_accessor_interface<JSON, BACKEND>::at (string_view key) const;
+template element_accessor_interface<JSON_REF, BACKEND>::const_reference element_accessor_interface<JSON_REF, BACKEND>::at (string_view key) const;
+
+template <typename Derived, typename Backend>
+typename element_accessor_interface<Derived, Backend>::reference
+element_accessor_interface<Derived, Backend>::at (string_view key)
+{
+    auto self = static_cast<Derived *>(this);
+    backend::leak(*self);
+    return static_cast<element_accessor_interface const *>(this)->at(key);
+}
+
+template element_accessor_interface<JSON, BACKEND>::reference element_accessor_interface<JSON, BACKEND>::at (string_view key);
+template element_accessor_interface<JSON_REF, BACKEND>::reference element_accessor_interface<JSON_REF, BACKEND>::at (string_view key);
+
+template <typename Derived, typename Backend>
+bool
+element_accessor_interface<Derived, Backend>::contains (string_view key) const
+{
+    auto self = static_cast<Derived const *>(this);
+    return backend::find_member(CINATIVE(*self), key) != nullptr;
+}
+
+template bool element_accessor_interface<JSON, BACKEND>::contains (string_view key) const;
+template bool element_accessor_interface<JSON_REF, BACKEND>::contains (string_view key) const;
+
+////////////////////////////////////////////////////////////////////////////////
+// Getter interface
+////////////////////////////////////////////////////////////////////////////////
+template <typename Derived, typename Backend>
+bool
+getter_interface<Derived, Backend>::bool_value () const noexcept
+{
+    auto self = static_cast<Derived const *>(this);
+
+    PFS__ASSERT(self->is_bool(), "boolean value expected");
+    return CINATIVE(*self)->type == BACKEND::type_tag::true_value;
+}
+
+template bool getter_interface<JSON, BACKEND>::bool_value () const noexcept;
+template bool getter_interface<JSON_REF, BACKEND>::bool_value () const noexcept;
+template bool getter_interface<JSON_VIEW, BACKEND>::bool_value () const noexcept;
+
+template <typename Derived, typename Backend>
+std::intmax_t
+getter_interface<Derived, Backend>::integer_value () const noexcept
+{
+    auto self = static_cast<Derived const *>(this);
+
+    PFS__ASSERT(self->is_integer(), "integer value expected");
+    return static_cast<std::intmax_t>(CINATIVE(*self)->u.i);
+}
+
+template std::intmax_t getter_interface<JSON, BACKEND>::integer_value () const noexcept;
+template std::intmax_t getter_interface<JSON_REF, BACKEND>::integer_value () const noexcept;
+template std::intmax_t getter_interface<JSON_VIEW, BACKEND>::integer_value () const noexcept;
+
+template <typename Derived, typename Backend>
+double
+getter_interface<Derived, Backend>::real_value () const noexcept
+{
+    auto self = static_cast<Derived const *>(this);
+
+    PFS__ASSERT(self->is_real(), "real value expected");
+    return CINATIVE(*self)->u.d;
+}
+
+template double getter_interface<JSON, BACKEND>::real_value () const noexcept;
+template double getter_interface<JSON_REF, BACKEND>::real_value () const noexcept;
+template double getter_interface<JSON_VIEW, BACKEND>::real_value () const noexcept;
+
+template <typename Derived, typename Backend>
+string_view
+getter_interface<Derived, Backend>::string_value () const noexcept
+{
+    auto self = static_cast<Derived const *>(this);
+
+    PFS__ASSERT(self->is_string(), "string value expected");
+    return string_view(CINATIVE(*self)->u.s, CINATIVE(*self)->n);
+}
+
+template string_view getter_interface<JSON, BACKEND>::string_value () const noexcept;
+template string_view getter_interface<JSON_REF, BACKEND>::string_value () const noexcept;
+template string_view getter_interface<JSON_VIEW, BACKEND>::string_value () const noexcept;
+
+template <typename Derived, typename Backend>
+std::size_t
+getter_interface<Derived, Backend>::array_size () const noexcept
+{
+    auto self = static_cast<Derived const *>(this);
+
+    PFS__ASSERT(self->is_array(), "array expected");
+    return CINATIVE(*self)->n;
+}
+
+template std::size_t getter_interface<JSON, BACKEND>::array_size () const noexcept;
+template std::size_t getter_interface<JSON_REF, BACKEND>::array_size () const noexcept;
+template std::size_t getter_interface<JSON_VIEW, BACKEND>::array_size () const noexcept;
+
+template <typename Derived, typename Backend>
+std::size_t
+getter_interface<Derived, Backend>::object_size () const noexcept
+{
+    auto self = static_cast<Derived const *>(this);
+
+    PFS__ASSERT(self->is_object(), "object expected");
+    return CINATIVE(*self)->n;
+}
+
+template std::size_t getter_interface<JSON, BACKEND>::object_size () const noexcept;
+template std::size_t getter_interface<JSON_REF, BACKEND>::object_size () const noexcept;
+template std::size_t getter_interface<JSON_VIEW, BACKEND>::object_size () const noexcept;
+
+////////////////////////////////////////////////////////////////////////////////
+// Algorithm interface
+////////////////////////////////////////////////////////////////////////////////
+template <typename Derived, typename Backend>
+void
+algorithm_interface<Derived, Backend>::for_each (std::function<void (reference)> f) const noexcept
+{
+    auto self = static_cast<Derived const *>(this);
+    auto ptr = CINATIVE(*self);
+
+    if (!ptr)
+        return;
+
+    if (ptr->type == BACKEND::type_tag::object) {
+        for (std::size_t i = 0; i < ptr->n; i++)
+            f(reference{typename Backend::ref{& ptr->u.members[i].val, self->_doc}});
+    } else if (ptr->type == BACKEND::type_tag::array) {
+        for (std::size_t i = 0; i < ptr->n; i++)
+            f(reference{typename Backend::ref{ptr->u.items + i, self->_doc}});
+    }
+}
+
+template void algorithm_interface<JSON, BACKEND>::for_each (std::function<void (reference)> f) const noexcept;
+template void algorithm_interface<JSON_REF, BACKEND>::for_each (std::function<void (reference)> f) const noexcept;
+
+////////////////////////////////////////////////////////////////////////////////
+// Iterator interface
+////////////////////////////////////////////////////////////////////////////////
+namespace backend {
+namespace {
+
+// Position past the last element (member), scalar is a single element range
+inline std::size_t end_index (value const * parent) noexcept
+{
+    return (parent->type == type_tag::array || parent->type == type_tag::object)
+        ? parent->n : 1;
+}
+
+} // namespace
+} // namespace backend
+
+template <typename Derived, typename Backend>
+typename iterator_interface<Derived, Backend>::iterator
+iterator_interface<Derived, Backend>::begin ()
+{
+    auto self = static_cast<Derived *>(this);
+    backend::leak(*self);
+
+    PFS__TERMINATE(INATIVE(*self), "iterator_interface::begin(): null pointer");
+
+    iterator it;
+    it._parent = INATIVE(*self);
+    it._doc = self->_doc;
+    it._index = 0;
+
+    return it;
+}
+
+template <typename Derived, typename Backend>
+typename iterator_interface<Derived, Backend>::const_iterator
+iterator_interface<Derived, Backend>::begin () const noexcept
+{
+    auto self = static_cast<Derived const *>(this);
+
+    PFS__TERMINATE(CINATIVE(*self), "iterator_interface::begin(): null pointer");
+
+    const_iterator it;
+    it._parent = CINATIVE(*self);
+    it._doc = self->_doc;
+    it._index = 0;
+
+    return it;
+}
+
+template iterator_interface<JSON, BACKEND>::iterator iterator_interface<JSON, BACKEND>::begin ();
+template iterator_interface<JSON, BACKEND>::const_iterator iterator_interface<JSON, BACKEND>::begin () const noexcept;
+template iterator_interface<JSON_REF, BACKEND>::iterator iterator_interface<JSON_REF, BACKEND>::begin ();
+template iterator_interface<JSON_REF, BACKEND>::const_iterator iterator_interface<JSON_REF, BACKEND>::begin () const noexcept;
+
+template <typename Derived, typename Backend>
+typename iterator_interface<Derived, Backend>::iterator
+iterator_interface<Derived, Backend>::end ()
+{
+    iterator it;
+    auto self = static_cast<Derived *>(this);
+    backend::leak(*self);
+
+    PFS__TERMINATE(INATIVE(*self), "iterator_interface::end(): null pointer");
+
+    it._parent = INATIVE(*self);
+    it._doc = self->_doc;
+    it._index = backend::end_index(it._parent);
+
+    return it;
+}
+
+template <typename Derived, typename Backend>
+typename iterator_interface<Derived, Backend>::const_iterator
+iterator_interface<Derived, Backend>::end () const noexcept
+{
+    const_iterator it;
+    auto self = static_cast<Derived const *>(this);
+
+    PFS__TERMINATE(CINATIVE(*self), "iterator_interface::end(): null pointer");
+
+    it._parent = CINATIVE(*self);
+    it._doc = self->_doc;
+    it._index = backend::end_index(it._parent);
+
+    return it;
+}
+
+template iterator_interface<JSON, BACKEND>::iterator iterator_interface<JSON, BACKEND>::end ();
+template iterator_interface<JSON, BACKEND>::const_iterator iterator_interface<JSON, BACKEND>::end () const noexcept;
+template iterator_interface<JSON_REF, BACKEND>::iterator iterator_interface<JSON_REF, BACKEND>::end ();
+template iterator_interface<JSON_REF, BACKEND>::const_iterator iterator_interface<JSON_REF, BACKEND>::end () const noexcept;
+
+template <typename ValueType, typename RefType, typename Backend>
+template <typename U, typename V>
+basic_iterator<ValueType, RefType, Backend>::basic_iterator (basic_iterator<U, V, Backend> other)
+{
+    this->_parent = other._parent;
+    this->_doc = other._doc;
+    this->_index = other._index;
+}
+
+template basic_iterator<JSON const, JSON_REF const, BACKEND>::basic_iterator (basic_iterator<JSON, JSON_REF, BACKEND>);
+
+template <typename ValueType, typename RefType, typename Backend>
+bool basic_iterator<ValueType, RefType, Backend>::equals (basic_iterator<ValueType, RefType, Backend> const & other) const
+{
+    return this->_parent == other._parent
+        && this->_index == other._index;
+}
+
+template bool basic_iterator<JSON, JSON_REF, BACKEND>::equals (basic_iterator<JSON, JSON_REF, BACKEND> const & ) const;
+template bool basic_iterator<JSON const, JSON_REF const, BACKEND>::equals (basic_iterator<JSON const, JSON_REF const, BACKEND> const & ) const;
+template bool basic_iterator<JSON_VIEW const, JSON_VIEW, BACKEND>::equals (basic_iterator<JSON_VIEW const, JSON_VIEW, BACKEND> const & ) const;
+
+namespace backend {
+namespace {
+
+// Value the iterator points to
+value * element (value * parent, std::size_t index)
+{
+    if (parent->type == type_tag::object) {
+        if (index >= parent->n)
+            throw error {make_error_code(std::errc::result_out_of_range)};
+
+        return & parent->u.members[index].val;
+    } else if (parent->type == type_tag::array) {
+        if (index >= parent->n)
+            throw error {make_error_code(std::errc::result_out_of_range)};
+
+        return parent->u.items + index;
+    }
+
+    if (index > 0)
+        throw error {make_error_code(std::errc::result_out_of_range)};
+
+    return parent;
+}
+
+} // namespace
+} // namespace backend
+
+template <typename ValueType, typename RefType, typename Backend>
+typename basic_iterator<ValueType, RefType, Backend>::reference
+basic_iterator<ValueType, RefType, Backend>::ref ()
+{
+    auto ptr = backend::element(this->_parent, this->_index);
+    return reference{BACKEND::ref{ptr, this->_doc}};
+}
+
+template basic_iterator<JSON, JSON_REF, BACKEND>::reference basic_iterator<JSON, JSON_REF, BACKEND>::ref ();
+template basic_iterator<JSON const, JSON_REF const, BACKEND>::reference basic_iterator<JSON const, JSON_REF const, BACKEND>::ref ();
+
+template <>
+basic_iterator<JSON_VIEW const, JSON_VIEW, BACKEND>::reference
+basic_iterator<JSON_VIEW const, JSON_VIEW, BACKEND>::ref ()
+{
+    return backend::make_view(backend::element(this->_parent, this->_index));
+}
+
+template <typename ValueType, typename RefType, typename Backend>
+void basic_iterator<ValueType, RefType, Backend>::increment (difference_type)
+{
+    if (this->_index >= backend::end_index(this->_parent))
+        throw error {make_error_code(std::errc::result_out_of_range)};
+
+    ++this->_index;
+}
+
+template void basic_iterator<JSON, JSON_REF, BACKEND>::increment (difference_type);
+template void basic_iterator<JSON const, JSON_REF const, BACKEND>::increment (difference_type);
+template void basic_iterator<JSON_VIEW const, JSON_VIEW, BACKEND>::increment (difference_type);
+
+template <typename ValueType, typename RefType, typename Backend>
+void basic_iterator<ValueType, RefType, Backend>::decrement (difference_type)
+{
+    if (this->_index == 0)
+        throw error {make_error_code(std::errc::result_out_of_range)};
+
+    --this->_index;
+}
+
+template void basic_iterator<JSON, JSON_REF, BACKEND>::decrement (difference_type);
+template void basic_iterator<JSON const, JSON_REF const, BACKEND>::decrement (difference_type);
+template void basic_iterator<JSON_VIEW const, JSON_VIEW, BACKEND>::decrement (difference_type);
+
+// Members are stored in the vector, so object iterators are bidirectional too
+template <typename ValueType, typename RefType, typename Backend>
+bool basic_iterator<ValueType, RefType, Backend>::decrement_support () const
+{
+    return true;
+}
+
+template bool basic_iterator<JSON, JSON_REF, BACKEND>::decrement_support () const;
+template bool basic_iterator<JSON const, JSON_REF const, BACKEND>::decrement_support () const;
+template bool basic_iterator<JSON_VIEW const, JSON_VIEW, BACKEND>::decrement_support () const;
+
+template <typename ValueType, typename RefType, typename Backend>
+typename basic_iterator<ValueType, RefType, Backend>::key_type
+basic_iterator<ValueType, RefType, Backend>::key () const
+{
+    if (this->_parent->type != BACKEND::type_tag::object)
+        throw error {make_error_code(errc::incopatible_type)};
+
+    if (this->_index >= this->_parent->n)
+        throw error {make_error_code(std::errc::result_out_of_range)};
+
+    auto const & key = this->_parent->u.members[this->_index].key;
+
+    return BACKEND::key_type(key.u.s, key.n);
+}
+
+template basic_iterator<JSON, JSON_REF, BACKEND>::key_type basic_iterator<JSON, JSON_REF, BACKEND>::key () const;
+template basic_iterator<JSON const, JSON_REF const, BACKEND>::key_type basic_iterator<JSON const, JSON_REF const, BACKEND>::key () const;
+template basic_iterator<JSON_VIEW const, JSON_VIEW, BACKEND>::key_type basic_iterator<JSON_VIEW const, JSON_VIEW, BACKEND>::key () const;
+
+////////////////////////////////////////////////////////////////////////////////
+// JSON view
+////////////////////////////////////////////////////////////////////////////////
+static_assert(std::is_trivially_copyable<JSON_VIEW>::value, "JSON view must be trivially copyable");
+
+template <>
+json_view<BACKEND>::json_view (json<BACKEND> const & j) noexcept
+    : json_view(backend::make_view(CINATIVE(j)))
+{}
+
+template <>
+json_view<BACKEND>::json_view (json_ref<BACKEND> const & j) noexcept
+    : json_view(backend::make_view(CINATIVE(j)))
+{}
+
+template <>
+json_view<BACKEND>::operator bool () const noexcept
+{
+    return NATIVE(*this) != nullptr;
+}
+
+template <>
+json_view<BACKEND>
+json_view<BACKEND>::operator [] (size_type pos) const noexcept
+{
+    auto ptr = NATIVE(*this);
+
+    if (!ptr || ptr->type != BACKEND::type_tag::array || pos >= ptr->n)
+        return json_view{};
+
+    return backend::make_view(ptr->u.items + pos);
+}
+
+template <>
+json_view<BACKEND>
+json_view<BACKEND>::operator [] (string_view key) const noexcept
+{
+    auto m = backend::find_member(NATIVE(*this), key);
+    return m ? backend::make_view(& m->val) : json_view{};
+}
+
+template <>
+json_view<BACKEND>
+json_view<BACKEND>::at (size_type pos) const
+{
+    auto ptr = NATIVE(*this);
+
+    if (!ptr || ptr->type != BACKEND::type_tag::array)
+        throw error {make_error_code(errc::incopatible_type), tr::_("array expected")};
+
+    if (pos >= ptr->n) {
+        throw error {
+              make_error_code(std::errc::invalid_argument)
+            , tr::f_("index is out of bounds: {}", pos)
+        };
+    }
+
+    return backend::make_view(ptr->u.items + pos);
+}
+
+template <>
+json_view<BACKEND>
+json_view<BACKEND>::at (string_view key) const
+{
+    auto ptr = NATIVE(*this);
+
+    if (!ptr || ptr->type != BACKEND::type_tag::object)
+        throw error {make_error_code(errc::incopatible_type), tr::_("object expected")};
+
+    auto m = backend::find_member(*ptr, key.data(), key.size());
+
+    if (!m)
+        throw error {
+              make_error_code(std::errc::invalid_argument)
+            , tr::f_("bad key: {}", pfs::to_string(key))
+        };
+
+    return backend::make_view(& m->val);
+}
+
+template <>
+bool
+json_view<BACKEND>::contains (string_view key) const
+{
+    return backend::find_member(NATIVE(*this), key) != nullptr;
+}
+
+template <>
+json_view<BACKEND>::iterator
+json_view<BACKEND>::begin () const noexcept
+{
+    PFS__TERMINATE(NATIVE(*this), "json_view::begin(): null pointer");
+
+    iterator it;
+    it._parent = NATIVE(*this);
+    it._index = 0;
+
+    return it;
+}
+
+template <>
+json_view<BACKEND>::iterator
+json_view<BACKEND>::end () const noexcept
+{
+    PFS__TERMINATE(NATIVE(*this), "json_view::end(): null pointer");
+
+    iterator it;
+    it._parent = NATIVE(*this);
+    it._index = backend::end_index(it._parent);
+
+    return it;
+}
+
+} // namespace jeyson
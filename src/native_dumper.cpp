@@ -0,0 +1,389 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `jeyson-lib`.
+//
+// Changelog:
+//      2026.10.15 Initial version.
+//                 Added serialization primitives for json_writer.
+////////////////////////////////////////////////////////////////////////////////
+#include "native_dumper.hpp"
+#include "real_format.hpp"
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+
+namespace jeyson {
+namespace backend {
+
+namespace {
+
+constexpr std::size_t supported_flags = JSON_MAX_INDENT | JSON_COMPACT
+    | JSON_ENCODE_ANY | JSON_REAL_PRECISION(31);
+
+class string_output
+{
+    std::string & _s;
+
+public:
+    string_output (std::string & s) : _s(s) {}
+
+    bool write (char const * s, std::size_t n)
+    {
+        _s.append(s, n);
+        return true;
+    }
+
+    bool put (char c)
+    {
+        _s.push_back(c);
+        return true;
+    }
+};
+
+class file_output
+{
+    std::FILE * _fp;
+    std::size_t _size {0};
+    char _buffer[64 * 1024];
+
+public:
+    file_output (std::FILE * fp) : _fp(fp) {}
+
+    bool flush ()
+    {
+        if (_size > 0 && std::fwrite(_buffer, 1, _size, _fp) != _size)
+            return false;
+
+        _size = 0;
+        return true;
+    }
+
+    bool write (char const * s, std::size_t n)
+    {
+        if (_size + n > sizeof(_buffer)) {
+            if (!flush())
+                return false;
+
+            if (n > sizeof(_buffer))
+                return std::fwrite(s, 1, n, _fp) == n;
+        }
+
+        std::memcpy(_buffer + _size, s, n);
+        _size += n;
+        return true;
+    }
+
+    bool put (char c)
+    {
+        if (_size == sizeof(_buffer) && !flush())
+            return false;
+
+        _buffer[_size++] = c;
+        return true;
+    }
+};
+
+template <typename Output>
+class dumper
+{
+    Output & _out;
+    int _indent {0};
+    int _precision {0};
+    bool _compact {false};
+
+public:
+    dumper (Output & out, std::size_t flags)
+        : _out(out)
+        , _indent(static_cast<int>(flags & JSON_MAX_INDENT))
+        , _precision(static_cast<int>((flags >> 11) & 0x1F))
+        , _compact((flags & JSON_COMPACT) != 0)
+    {}
+
+    bool dump (json_t * json, int depth)
+    {
+        switch (json_typeof(json)) {
+            case JSON_NULL:
+                return _out.write("null", 4);
+            case JSON_TRUE:
+                return _out.write("true", 4);
+            case JSON_FALSE:
+                return _out.write("false", 5);
+            case JSON_INTEGER:
+                return dump_integer(json_integer_value(json));
+            case JSON_REAL:
+                return dump_real(json_real_value(json));
+            case JSON_STRING:
+                return dump_string(json_string_value(json), json_string_length(json));
+            case JSON_ARRAY:
+                return dump_array(json, depth);
+            case JSON_OBJECT:
+                return dump_object(json, depth);
+            default:
+                return false;
+        }
+    }
+
+    bool dump_indent (int depth, bool space)
+    {
+        if (_indent > 0) {
+            if (!_out.put('\n'))
+                return false;
+
+            for (int n = depth * _indent; n > 0; n--) {
+                if (!_out.put(' '))
+                    return false;
+            }
+
+            return true;
+        }
+
+        return (space && !_compact) ? _out.put(' ') : true;
+    }
+
+    bool dump_integer (json_int_t value)
+    {
+        char buf[24];
+        char * end = buf + sizeof(buf);
+        char * p = end;
+
+        auto u = static_cast<std::uint64_t>(value);
+
+        if (value < 0)
+            u = ~u + 1;
+
+        do {
+            *--p = static_cast<char>('0' + u % 10);
+            u /= 10;
+        } while (u != 0);
+
+        if (value < 0)
+            *--p = '-';
+
+        return _out.write(p, static_cast<std::size_t>(end - p));
+    }
+
+    bool dump_real (double value)
+    {
+        char buf[number::format_buffer_size];
+        auto end = number::format_precision(value, _precision, buf);
+        return _out.write(buf, static_cast<std::size_t>(end - buf));
+    }
+
+    bool dump_string (char const * s, std::size_t n)
+    {
+        static char const * HEX = "0123456789ABCDEF";
+
+        if (!_out.put('"'))
+            return false;
+
+        auto end = s + n;
+        auto run = s;
+
+        for (auto p = s; p != end; ++p) {
+            auto c = static_cast<unsigned char>(*p);
+
+            if (c >= 0x20 && c != '"' && c != '\\')
+                continue;
+
+            if (p != run && !_out.write(run, static_cast<std::size_t>(p - run)))
+                return false;
+
+            run = p + 1;
+
+            char seq[6] = {'\\', 0, 0, 0, 0, 0};
+            std::size_t len = 2;
+
+            switch (c) {
+                case '"': seq[1] = '"'; break;
+                case '\\': seq[1] = '\\'; break;
+                case '\b': seq[1] = 'b'; break;
+                case '\f': seq[1] = 'f'; break;
+                case '\n': seq[1] = 'n'; break;
+                case '\r': seq[1] = 'r'; break;
+                case '\t': seq[1] = 't'; break;
+                default:
+                    seq[1] = 'u';
+                    seq[2] = '0';
+                    seq[3] = '0';
+                    seq[4] = HEX[c >> 4];
+                    seq[5] = HEX[c & 0x0F];
+                    len = 6;
+                    break;
+            }
+
+            if (!_out.write(seq, len))
+                return false;
+        }
+
+        if (end != run && !_out.write(run, static_cast<std::size_t>(end - run)))
+            return false;
+
+        return _out.put('"');
+    }
+
+private:
+    bool dump_array (json_t * json, int depth)
+    {
+        auto n = json_array_size(json);
+
+        if (!_out.put('['))
+            return false;
+
+        if (n == 0)
+            return _out.put(']');
+
+        if (!dump_indent(depth + 1, false))
+            return false;
+
+        for (std::size_t i = 0; i < n; i++) {
+            if (!dump(json_array_get(json, i), depth + 1))
+                return false;
+
+            if (i < n - 1) {
+                if (!_out.put(',') || !dump_indent(depth + 1, true))
+                    return false;
+            } else {
+                if (!dump_indent(depth, false))
+                    return false;
+            }
+        }
+
+        return _out.put(']');
+    }
+
+    bool dump_object (json_t * json, int depth)
+    {
+        auto it = json_object_iter(json);
+
+        if (!_out.put('{'))
+            return false;
+
+        if (!it)
+            return _out.put('}');
+
+        if (!dump_indent(depth + 1, false))
+            return false;
+
+        while (it) {
+            auto next = json_object_iter_next(json, it);
+
+#if JANSSON_VERSION_HEX >= 0x020E00
+            if (!dump_string(json_object_iter_key(it), json_object_iter_key_len(it)))
+                return false;
+#else
+            auto key = json_object_iter_key(it);
+
+            if (!dump_string(key, std::strlen(key)))
+                return false;
+#endif
+
+            if (!(_compact ? _out.put(':') : _out.write(": ", 2)))
+                return false;
+
+            if (!dump(json_object_iter_value(it), depth + 1))
+                return false;
+
+            if (next) {
+                if (!_out.put(',') || !dump_indent(depth + 1, true))
+                    return false;
+            } else {
+                if (!dump_indent(depth, false))
+                    return false;
+            }
+
+            it = next;
+        }
+
+        return _out.put('}');
+    }
+};
+
+template <typename Output>
+int dump (json_t const * json, std::size_t flags, Output & out, int depth = 0)
+{
+    auto j = const_cast<json_t *>(json);
+
+    if (!(flags & JSON_ENCODE_ANY) && !json_is_array(j) && !json_is_object(j))
+        return -1;
+
+    dumper<Output> d {out, flags};
+    return d.dump(j, depth) ? 0 : -1;
+}
+
+int jansson_dump_callback (char const * buffer, std::size_t size, void * data)
+{
+    static_cast<std::string *>(data)->append(buffer, size);
+    return 0;
+}
+
+} // namespace
+
+int native_dump (json_t const * json, std::size_t flags, std::string & output
+    , int depth)
+{
+    if (!json)
+        return -1;
+
+    if (flags & ~supported_flags)
+        return json_dump_callback(json, jansson_dump_callback, & output, flags);
+
+    string_output out {output};
+    return dump(json, flags, out, depth);
+}
+
+void native_dump_indent (int depth, bool space, std::size_t flags, std::string & output)
+{
+    string_output out {output};
+    dumper<string_output> {out, flags}.dump_indent(depth, space);
+}
+
+void native_dump_string (char const * s, std::size_t n, std::string & output)
+{
+    string_output out {output};
+    dumper<string_output> {out, 0}.dump_string(s, n);
+}
+
+void native_dump_integer (json_int_t value, std::string & output)
+{
+    string_output out {output};
+    dumper<string_output> {out, 0}.dump_integer(value);
+}
+
+void native_dump_real (double value, int precision, std::string & output)
+{
+    if (precision > 31)
+        precision = 31;
+
+    std::size_t flags = precision > 0 ? JSON_REAL_PRECISION(precision) : 0;
+    string_output out {output};
+    dumper<string_output> {out, flags}.dump_real(value);
+}
+
+int native_dump_file (json_t const * json, char const * path, std::size_t flags)
+{
+    if (!json || !path)
+        return -1;
+
+    if (flags & ~supported_flags)
+        return json_dump_file(json, path, flags);
+
+    auto fp = std::fopen(path, "w");
+
+    if (!fp)
+        return -1;
+
+    std::unique_ptr<file_output> out {new file_output(fp)};
+    auto rc = dump(json, flags, *out);
+
+    if (rc == 0 && !out->flush())
+        rc = -1;
+
+    if (std::fclose(fp) != 0)
+        rc = -1;
+
+    return rc;
+}
+
+}} // namespace jeyson::backend
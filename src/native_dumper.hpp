@@ -0,0 +1,63 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `jeyson-lib`.
+//
+// Changelog:
+//      2026.10.15 Initial version.
+//                 Added serialization primitives for json_writer.
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include <jansson.h>
+#include <cstddef>
+#include <string>
+
+namespace jeyson {
+namespace backend {
+
+/**
+ * Replacement for `json_dump_callback()` appending JSON representation of
+ * @a json to @a output. Output is the same as jansson produces except real
+ * numbers: they are written in the shortest form that round-trips if
+ * `JSON_REAL_PRECISION` is not specified (or zero), e.g. `0.1` instead of
+ * `0.10000000000000001`.
+ *
+ * Supports `JSON_COMPACT`, `JSON_INDENT`, `JSON_REAL_PRECISION` and
+ * `JSON_ENCODE_ANY` flags, with other flags the jansson serializer is used.
+ *
+ * @a depth is the nesting level of @a json in the enclosing output (affects
+ * indentation only).
+ *
+ * @return 0 on success or -1 on failure.
+ */
+int native_dump (json_t const * json, std::size_t flags, std::string & output
+    , int depth = 0);
+
+/**
+ * Appends line break and indentation for nesting level @a depth (or a space
+ * if @a space is @c true and output is neither indented nor compact) the same
+ * way as `native_dump()` does between elements.
+ */
+void native_dump_indent (int depth, bool space, std::size_t flags, std::string & output);
+
+/**
+ * Appends quoted and escaped string.
+ */
+void native_dump_string (char const * s, std::size_t n, std::string & output);
+
+/**
+ * Appends integer value.
+ */
+void native_dump_integer (json_int_t value, std::string & output);
+
+/**
+ * Appends real value (see `native_dump()` for @a precision).
+ */
+void native_dump_real (double value, int precision, std::string & output);
+
+/**
+ * Replacement for `json_dump_file()`, see `native_dump()`.
+ */
+int native_dump_file (json_t const * json, char const * path, std::size_t flags);
+
+}} // namespace jeyson::backend
@@ -0,0 +1,763 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `jeyson-lib`.
+//
+// Changelog:
+//      2026.10.15 Initial version.
+//                 Added instrumentation phases.
+//                 Files are memory mapped.
+//                 Large files are parsed in parallel.
+//                 Added projection parsing.
+//      2026.10.16 Last of duplicate keys wins in projection parsing.
+////////////////////////////////////////////////////////////////////////////////
+#include "native_loader.hpp"
+#include "instrumentation.hpp"
+#include "mapped_file.hpp"
+#include "structural_index.hpp"
+#include "structural_parser.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace jeyson {
+namespace backend {
+
+namespace {
+
+using structural::parse_errc;
+
+// Builds jansson tree from the parser events.
+class jansson_builder
+{
+    struct frame
+    {
+        json_t * container {nullptr};
+        std::string key;
+    };
+
+    json_t * _root {nullptr};
+    std::vector<frame> _frames; // Frames are reused to keep allocated key buffers
+    std::size_t _depth {0};
+    bool _reject_duplicates {false};
+
+public:
+    jansson_builder (bool reject_duplicates)
+        : _reject_duplicates(reject_duplicates)
+    {}
+
+    ~jansson_builder ()
+    {
+        if (_root)
+            json_decref(_root);
+    }
+
+    json_t * release () noexcept
+    {
+        auto result = _root;
+        _root = nullptr;
+        return result;
+    }
+
+    parse_errc on_null () { return add(json_null()); }
+    parse_errc on_bool (bool value) { return add(value ? json_true() : json_false()); }
+    parse_errc on_integer (std::int64_t value) { return add(json_integer(static_cast<json_int_t>(value))); }
+    parse_errc on_real (double value) { return add(json_real(value)); }
+
+    parse_errc on_string (char const * s, std::size_t n)
+    {
+        return add(json_stringn_nocheck(s, n));
+    }
+
+    parse_errc on_key (char const * s, std::size_t n)
+    {
+        auto & f = _frames[_depth - 1];
+
+        if (_reject_duplicates && json_object_getn(f.container, s, n) != nullptr)
+            return parse_errc::duplicate_key;
+
+        f.key.assign(s, n);
+        return parse_errc::success;
+    }
+
+    parse_errc on_begin_array () { return push(json_array()); }
+    parse_errc on_begin_object () { return push(json_object()); }
+
+    parse_errc on_end_array ()
+    {
+        --_depth;
+        return parse_errc::success;
+    }
+
+    parse_errc on_end_object ()
+    {
+        --_depth;
+        return parse_errc::success;
+    }
+
+private:
+    // value must be a new reference
+    parse_errc add (json_t * value)
+    {
+        if (!value)
+            return parse_errc::out_of_memory;
+
+        if (_depth == 0) {
+            _root = value;
+            return parse_errc::success;
+        }
+
+        auto & f = _frames[_depth - 1];
+
+        // Both functions steal the reference even on failure
+        auto rc = json_is_object(f.container)
+            ? json_object_setn_new_nocheck(f.container, f.key.data(), f.key.size(), value)
+            : json_array_append_new(f.container, value);
+
+        return rc == 0 ? parse_errc::success : parse_errc::handler_failure;
+    }
+
+    parse_errc push (json_t * container)
+    {
+        auto rc = add(container);
+
+        if (rc != parse_errc::success)
+            return rc;
+
+        if (_depth == _frames.size())
+            _frames.emplace_back();
+
+        _frames[_depth++].container = container;
+        return parse_errc::success;
+    }
+};
+
+enum json_error_code error_code (parse_errc ec) noexcept
+{
+    switch (ec) {
+        case parse_errc::premature_end: return json_error_premature_end_of_input;
+        case parse_errc::end_of_input_expected: return json_error_end_of_input_expected;
+        case parse_errc::depth_exceeded: return json_error_stack_overflow;
+        case parse_errc::invalid_utf8: return json_error_invalid_utf8;
+        case parse_errc::null_character: return json_error_null_character;
+        case parse_errc::null_byte_in_key: return json_error_null_byte_in_key;
+        case parse_errc::duplicate_key: return json_error_duplicate_key;
+        case parse_errc::integer_overflow:
+        case parse_errc::real_overflow: return json_error_numeric_overflow;
+        case parse_errc::out_of_memory: return json_error_out_of_memory;
+        case parse_errc::handler_failure: return json_error_unknown;
+        default: return json_error_invalid_syntax;
+    }
+}
+
+void set_error (json_error_t * error, char const * source, int line, int column
+    , std::size_t position, enum json_error_code code, char const * text)
+{
+    if (!error)
+        return;
+
+    error->line = line;
+    error->column = column;
+    error->position = static_cast<int>(position);
+
+    std::snprintf(error->source, JSON_ERROR_SOURCE_LENGTH, "%s", source);
+    std::snprintf(error->text, JSON_ERROR_TEXT_LENGTH - 1, "%s", text);
+
+#if JANSSON_VERSION_HEX >= 0x020B00
+    error->text[JSON_ERROR_TEXT_LENGTH - 1] = static_cast<char>(code);
+#else
+    (void)code;
+#endif
+}
+
+structural::parse_options parse_options (std::size_t flags) noexcept
+{
+    structural::parse_options opts;
+    opts.decode_any  = (flags & JSON_DECODE_ANY) != 0;
+    opts.allow_nul   = (flags & JSON_ALLOW_NUL) != 0;
+    opts.int_as_real = (flags & JSON_DECODE_INT_AS_REAL) != 0;
+    opts.eof_check   = (flags & JSON_DISABLE_EOF_CHECK) == 0;
+    return opts;
+}
+
+json_t * load (char const * buffer, std::size_t buflen, std::size_t flags
+    , char const * source, json_error_t * error)
+{
+    structural::index idx;
+
+    {
+        instrumentation::phase_timer timer {instrumentation::phase::index};
+        idx.build(buffer, buflen);
+    }
+
+    jansson_builder builder {(flags & JSON_REJECT_DUPLICATES) != 0};
+    structural::parser<jansson_builder> p {buffer, buflen, idx, builder, parse_options(flags)};
+
+    parse_errc rc = parse_errc::success;
+
+    {
+        instrumentation::phase_timer timer {instrumentation::phase::build};
+        rc = p.parse();
+    }
+
+    if (rc != parse_errc::success) {
+        int line = 0;
+        int column = 0;
+        p.location(p.error_position(), line, column);
+        set_error(error, source, line, column, p.error_position(), error_code(rc)
+            , structural::message(rc));
+        return nullptr;
+    }
+
+    return builder.release();
+}
+
+} // namespace
+
+json_t * native_loadb (char const * buffer, std::size_t buflen, std::size_t flags
+    , json_error_t * error)
+{
+    // Structural index positions are 32-bit
+    if (buflen > structural::index::max_length)
+        return json_loadb(buffer, buflen, flags, error);
+
+    if (!buffer) {
+        set_error(error, "<buffer>", -1, -1, 0, json_error_invalid_argument, "wrong arguments");
+        return nullptr;
+    }
+
+    return load(buffer, buflen, flags, "<buffer>", error);
+}
+
+namespace {
+
+template <typename Loader>
+json_t * load_file (char const * path, json_error_t * error, Loader && loader)
+{
+    if (!path) {
+        set_error(error, "<path>", -1, -1, 0, json_error_invalid_argument, "wrong arguments");
+        return nullptr;
+    }
+
+    mapped_file file;
+    int rc = 0;
+
+    {
+        instrumentation::phase_timer timer {instrumentation::phase::read};
+        rc = file.open(path);
+    }
+
+    if (rc != 0) {
+        std::string text = std::string{"unable to open "} + path + ": " + std::strerror(rc);
+        set_error(error, path, -1, -1, 0, json_error_cannot_open_file, text.c_str());
+        return nullptr;
+    }
+
+    return loader(file.data(), file.size());
+}
+
+} // namespace
+
+json_t * native_load_file (char const * path, std::size_t flags, json_error_t * error
+    , std::size_t parallel_threshold, std::size_t threads)
+{
+    return load_file(path, error, [=] (char const * data, std::size_t size) {
+        if (parallel_threshold > 0 && size >= parallel_threshold) {
+            if (auto j = parallel_loadb(data, size, flags, true, threads))
+                return j;
+        }
+
+        if (size > structural::index::max_length)
+            return json_loadb(data, size, flags, error);
+
+        return load(data, size, flags, path, error);
+    });
+}
+
+json_t * jansson_load_file (char const * path, std::size_t flags, json_error_t * error
+    , std::size_t parallel_threshold, std::size_t threads)
+{
+    return load_file(path, error, [=] (char const * data, std::size_t size) {
+        if (parallel_threshold > 0 && size >= parallel_threshold) {
+            if (auto j = parallel_loadb(data, size, flags, false, threads))
+                return j;
+        }
+
+        instrumentation::phase_timer timer {instrumentation::phase::build};
+        auto j = json_loadb(data, size, flags, error);
+
+        // Report the file as the error source as `json_load_file()` does
+        if (!j && error)
+            std::snprintf(error->source, JSON_ERROR_SOURCE_LENGTH, "%s", path);
+
+        return j;
+    });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Projection
+////////////////////////////////////////////////////////////////////////////////
+constexpr std::size_t projection::node::no_index;
+
+projection::node const * projection::node::find (char const * key, std::size_t n) const noexcept
+{
+    for (auto const & c: children) {
+        if (c.token.size() == n && std::memcmp(c.token.data(), key, n) == 0)
+            return c.target.get();
+    }
+
+    return any.get();
+}
+
+projection::node const * projection::node::find (std::size_t index) const noexcept
+{
+    for (auto const & c: children) {
+        if (c.index == index)
+            return c.target.get();
+    }
+
+    return any.get();
+}
+
+namespace {
+
+// Unescapes reference token (`~1` -> `/`, `~0` -> `~`)
+bool decode_token (char const * first, char const * last, std::string & token)
+{
+    token.clear();
+
+    for (; first != last; ++first) {
+        if (*first != '~') {
+            token.push_back(*first);
+            continue;
+        }
+
+        if (++first == last)
+            return false;
+
+        if (*first == '0')
+            token.push_back('~');
+        else if (*first == '1')
+            token.push_back('/');
+        else
+            return false;
+    }
+
+    return true;
+}
+
+// Returns array index for numeric token without leading zeros
+std::size_t token_index (std::string const & token) noexcept
+{
+    if (token.empty() || token.size() > 18 || (token.size() > 1 && token[0] == '0'))
+        return projection::node::no_index;
+
+    std::size_t result = 0;
+
+    for (auto c: token) {
+        if (c < '0' || c > '9')
+            return projection::node::no_index;
+
+        result = result * 10 + static_cast<std::size_t>(c - '0');
+    }
+
+    return result;
+}
+
+} // namespace
+
+bool projection::add (char const * pointer, std::size_t len)
+{
+    if (len > 0 && pointer[0] != '/')
+        return false;
+
+    auto target = & _root;
+    auto p = pointer;
+    auto end = pointer + len;
+    std::string token;
+
+    while (p != end && !target->selected) {
+        auto first = p + 1;
+        auto last = static_cast<char const *>(std::memchr(first, '/', static_cast<std::size_t>(end - first)));
+
+        if (!last)
+            last = end;
+
+        if (!decode_token(first, last, token))
+            return false;
+
+        if (token == "*") {
+            if (!target->any)
+                target->any.reset(new node);
+
+            target = target->any.get();
+        } else {
+            auto pos = std::find_if(target->children.begin(), target->children.end()
+                , [& token] (node::child const & c) { return c.token == token; });
+
+            if (pos == target->children.end()) {
+                node::child c;
+                c.token = token;
+                c.index = token_index(token);
+                c.target.reset(new node);
+                target->children.push_back(std::move(c));
+                pos = target->children.end() - 1;
+            }
+
+            target = pos->target.get();
+        }
+
+        p = last;
+    }
+
+    // Selected value includes everything below
+    target->selected = true;
+    target->children.clear();
+    target->any.reset();
+
+    return true;
+}
+
+namespace {
+
+// Walks the structural index building selected values only.
+class projector
+{
+    char const * _data;
+    std::size_t _len;
+    structural::index const & _idx;
+    structural::parser<jansson_builder> & _parser;
+    jansson_builder & _builder;
+    std::size_t _i {0};          // Next position in the index
+    std::size_t _error_pos {0};
+
+public:
+    projector (char const * data, std::size_t len, structural::index const & idx
+        , structural::parser<jansson_builder> & parser, jansson_builder & builder)
+        : _data(data)
+        , _len(len)
+        , _idx(idx)
+        , _parser(parser)
+        , _builder(builder)
+    {}
+
+    std::size_t error_position () const noexcept
+    {
+        return _error_pos;
+    }
+
+    std::size_t index_position () const noexcept
+    {
+        return _i;
+    }
+
+    // Projects the value at the current index position, @a result is
+    // @c nullptr if the value contains nothing selected or on error.
+    parse_errc project (projection::node const & target, json_t *& result)
+    {
+        result = nullptr;
+
+        if (target.selected) {
+            auto rc = _parser.parse_value(_i);
+
+            if (rc != parse_errc::success)
+                return fail(_parser.error_position(), rc);
+
+            result = _builder.release();
+            return parse_errc::success;
+        }
+
+        std::size_t pos = 0;
+
+        if (!peek(pos))
+            return fail(_len, parse_errc::premature_end);
+
+        auto rc = parse_errc::success;
+
+        switch (_data[pos]) {
+            case '{': rc = project_object(target, result); break;
+            case '[': rc = project_array(target, result); break;
+            default: return skip();
+        }
+
+        if (rc != parse_errc::success && result) {
+            json_decref(result);
+            result = nullptr;
+        }
+
+        return rc;
+    }
+
+    // Skips the value at the current index position
+    parse_errc skip ()
+    {
+        std::size_t pos = 0;
+
+        if (!peek(pos))
+            return fail(_len, parse_errc::premature_end);
+
+        switch (_data[pos]) {
+            case '{':
+            case '[':
+                break;
+
+            case '}': case ']': case ',': case ':':
+                return fail(pos, parse_errc::invalid_token);
+
+            default:
+                ++_i;
+                return parse_errc::success;
+        }
+
+        std::size_t depth = 0;
+
+        do {
+            if (_i >= _idx.size())
+                return fail(_len, parse_errc::premature_end);
+
+            switch (_data[_idx[_i++]]) {
+                case '{': case '[': ++depth; break;
+                case '}': case ']': --depth; break;
+                default: break;
+            }
+        } while (depth > 0);
+
+        return parse_errc::success;
+    }
+
+private:
+    bool peek (std::size_t & pos) const noexcept
+    {
+        if (_i >= _idx.size())
+            return false;
+
+        pos = _idx[_i];
+        return true;
+    }
+
+    parse_errc fail (std::size_t pos, parse_errc ec) noexcept
+    {
+        _error_pos = pos;
+        return ec;
+    }
+
+    parse_errc project_object (projection::node const & target, json_t *& result)
+    {
+        std::size_t pos = 0;
+        std::string key;
+        ++_i;
+
+        if (!peek(pos))
+            return fail(_len, parse_errc::premature_end);
+
+        if (_data[pos] == '}') {
+            ++_i;
+            return parse_errc::success;
+        }
+
+        for (;;) {
+            if (_data[pos] != '"')
+                return fail(pos, parse_errc::string_or_rbrace_expected);
+
+            char const * s = nullptr;
+            std::size_t n = 0;
+            auto rc = _parser.key_at(pos, s, n);
+
+            if (rc != parse_errc::success)
+                return fail(_parser.error_position(), rc);
+
+            ++_i;
+
+            if (!peek(pos))
+                return fail(_len, parse_errc::premature_end);
+
+            if (_data[pos] != ':')
+                return fail(pos, parse_errc::colon_expected);
+
+            ++_i;
+
+            if (auto child = target.find(s, n)) {
+                // Key data is invalidated by parsing of the value
+                key.assign(s, n);
+                json_t * value = nullptr;
+                rc = project(*child, value);
+
+                if (rc != parse_errc::success)
+                    return rc;
+
+                // Duplicate key replaces the previous member even if nothing
+                // is projected from its value (last one wins as in full parsing)
+                if (result)
+                    json_object_deln(result, key.data(), key.size());
+
+                if (value) {
+                    if (!result)
+                        result = json_object();
+
+                    // Value is released by the call on failure
+                    if (json_object_setn_new_nocheck(result, key.data(), key.size(), value) != 0)
+                        return fail(pos, parse_errc::out_of_memory);
+                }
+            } else {
+                rc = skip();
+
+                if (rc != parse_errc::success)
+                    return rc;
+            }
+
+            if (!peek(pos))
+                return fail(_len, parse_errc::premature_end);
+
+            ++_i;
+
+            if (_data[pos] == '}')
+                return parse_errc::success;
+
+            if (_data[pos] != ',')
+                return fail(pos, parse_errc::rbrace_expected);
+
+            if (!peek(pos))
+                return fail(_len, parse_errc::premature_end);
+
+            if (_data[pos] != '"')
+                return fail(pos, parse_errc::string_expected);
+        }
+    }
+
+    parse_errc project_array (projection::node const & target, json_t *& result)
+    {
+        std::size_t pos = 0;
+        ++_i;
+
+        if (!peek(pos))
+            return fail(_len, parse_errc::premature_end);
+
+        if (_data[pos] == ']') {
+            ++_i;
+            return parse_errc::success;
+        }
+
+        for (std::size_t index = 0; ; index++) {
+            parse_errc rc = parse_errc::success;
+
+            if (auto child = target.find(index)) {
+                json_t * value = nullptr;
+                rc = project(*child, value);
+
+                if (rc == parse_errc::success && value) {
+                    if (!result)
+                        result = json_array();
+
+                    if (json_array_append_new(result, value) != 0)
+                        return fail(pos, parse_errc::out_of_memory);
+                }
+            } else {
+                rc = skip();
+            }
+
+            if (rc != parse_errc::success)
+                return rc;
+
+            if (!peek(pos))
+                return fail(_len, parse_errc::premature_end);
+
+            ++_i;
+
+            if (_data[pos] == ']')
+                return parse_errc::success;
+
+            if (_data[pos] != ',')
+                return fail(pos, parse_errc::rbracket_expected);
+        }
+    }
+};
+
+json_t * load_projection (char const * buffer, std::size_t buflen, std::size_t flags
+    , projection const & proj, char const * source, json_error_t * error)
+{
+    structural::index idx;
+
+    {
+        instrumentation::phase_timer timer {instrumentation::phase::index};
+        idx.build(buffer, buflen);
+    }
+
+    jansson_builder builder {(flags & JSON_REJECT_DUPLICATES) != 0};
+    structural::parser<jansson_builder> p {buffer, buflen, idx, builder, parse_options(flags)};
+    projector walker {buffer, buflen, idx, p, builder};
+
+    instrumentation::phase_timer timer {instrumentation::phase::build};
+    json_t * result = nullptr;
+    auto rc = parse_errc::success;
+    auto error_pos = std::size_t{0};
+
+    if (idx.size() == 0) {
+        rc = parse_errc::premature_end;
+        error_pos = buflen;
+    } else if ((flags & JSON_DECODE_ANY) == 0 && buffer[idx[0]] != '[' && buffer[idx[0]] != '{') {
+        rc = parse_errc::container_expected;
+        error_pos = idx[0];
+    } else {
+        rc = walker.project(proj.root(), result);
+        error_pos = walker.error_position();
+
+        if (rc == parse_errc::success && (flags & JSON_DISABLE_EOF_CHECK) == 0
+                && walker.index_position() < idx.size()) {
+            rc = parse_errc::end_of_input_expected;
+            error_pos = idx[walker.index_position()];
+        }
+    }
+
+    if (rc != parse_errc::success) {
+        if (result)
+            json_decref(result);
+
+        int line = 0;
+        int column = 0;
+        p.location(error_pos, line, column);
+        set_error(error, source, line, column, error_pos, error_code(rc), structural::message(rc));
+        return nullptr;
+    }
+
+    // Root is always present
+    if (!result) {
+        switch (buffer[idx[0]]) {
+            case '{': result = json_object(); break;
+            case '[': result = json_array(); break;
+            default: result = json_null(); break;
+        }
+    }
+
+    return result;
+}
+
+} // namespace
+
+json_t * native_load_projection (char const * buffer, std::size_t buflen, std::size_t flags
+    , projection const & proj, json_error_t * error)
+{
+    if (!buffer || buflen > structural::index::max_length) {
+        set_error(error, "<buffer>", -1, -1, 0, json_error_invalid_argument, "wrong arguments");
+        return nullptr;
+    }
+
+    return load_projection(buffer, buflen, flags, proj, "<buffer>", error);
+}
+
+json_t * native_load_file_projection (char const * path, std::size_t flags
+    , projection const & proj, json_error_t * error)
+{
+    return load_file(path, error, [&] (char const * data, std::size_t size) -> json_t * {
+        if (size > structural::index::max_length) {
+            set_error(error, path, -1, -1, 0, json_error_invalid_argument, "file is too large");
+            return nullptr;
+        }
+
+        return load_projection(data, size, flags, proj, path, error);
+    });
+}
+
+}} // namespace jeyson::backend
@@ -0,0 +1,124 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `jeyson-lib`.
+//
+// Changelog:
+//      2026.10.15 Initial version.
+//                 Files are memory mapped.
+//                 Added parallel loader.
+//                 Added projection loader.
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include <jansson.h>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace jeyson {
+namespace backend {
+
+/**
+ * Replacement for `json_loadb()` based on the native two-stage parser.
+ * Supports `JSON_REJECT_DUPLICATES`, `JSON_DISABLE_EOF_CHECK`,
+ * `JSON_DECODE_ANY`, `JSON_DECODE_INT_AS_REAL` and `JSON_ALLOW_NUL` flags.
+ */
+json_t * native_loadb (char const * buffer, std::size_t buflen, std::size_t flags
+    , json_error_t * error);
+
+/**
+ * Replacement for `json_load_file()` based on the native two-stage parser.
+ * File content is memory mapped (see `mapped_file`). Files of
+ * @a parallel_threshold bytes and more are parsed by `parallel_loadb()` with
+ * @a threads threads if possible (zero threshold disables parallel parsing).
+ */
+json_t * native_load_file (char const * path, std::size_t flags, json_error_t * error
+    , std::size_t parallel_threshold = 0, std::size_t threads = 0);
+
+/**
+ * Replacement for `json_load_file()` parsing memory mapped file content with
+ * `json_loadb()` instead of buffered stream reads. Supports the same flags
+ * and parallel parsing as `native_load_file()`.
+ */
+json_t * jansson_load_file (char const * path, std::size_t flags, json_error_t * error
+    , std::size_t parallel_threshold = 0, std::size_t threads = 0);
+
+/**
+ * Parses text which root is an array in parallel: the array is split on
+ * element boundaries found by a structural pre-scan, element ranges are
+ * parsed by @a threads threads (zero means `std::thread::hardware_concurrency()`)
+ * with the native parser (if @a native is @c true) or with `json_loadb()` and
+ * spliced into a single array.
+ *
+ * @return @c nullptr if the text is not a top-level array, is too small to
+ *         split, or any range fails to parse. The caller falls back to the
+ *         serial parser then, so errors are reported exactly as without
+ *         splitting.
+ */
+json_t * parallel_loadb (char const * buffer, std::size_t buflen, std::size_t flags
+    , bool native, std::size_t threads);
+
+/**
+ * Set of JSON Pointer (RFC 6901) paths compiled into a tree. Reference
+ * token `*` matches any object member or array element, numeric tokens
+ * match both object members and array elements.
+ */
+class projection
+{
+public:
+    struct node
+    {
+        static constexpr std::size_t no_index = static_cast<std::size_t>(-1);
+
+        struct child
+        {
+            std::string token;
+            std::size_t index {no_index}; // Array index if token is numeric
+            std::unique_ptr<node> target;
+        };
+
+        std::vector<child> children;
+        std::unique_ptr<node> any;        // Target of `*`
+        bool selected {false};            // Whole value is selected
+
+        node const * find (char const * key, std::size_t n) const noexcept;
+        node const * find (std::size_t index) const noexcept;
+    };
+
+private:
+    node _root;
+
+public:
+    /**
+     * Adds path @a pointer (empty string selects the whole document).
+     *
+     * @return @c false if @a pointer is not a valid JSON Pointer.
+     */
+    bool add (char const * pointer, std::size_t len);
+
+    node const & root () const noexcept
+    {
+        return _root;
+    }
+};
+
+/**
+ * Parses only values selected by @a proj with the native parser: other
+ * values are skipped by the structural index without building nodes or
+ * decoding strings (skipped values are checked for bracket balance only).
+ * Containers on the selected paths keep only members/elements that contain
+ * selected values, the root is always present. Supports the same flags as
+ * `native_loadb()`.
+ */
+json_t * native_load_projection (char const * buffer, std::size_t buflen, std::size_t flags
+    , projection const & proj, json_error_t * error);
+
+/**
+ * Parses file content by `native_load_projection()`, file is memory mapped.
+ */
+json_t * native_load_file_projection (char const * path, std::size_t flags
+    , projection const & proj, json_error_t * error);
+
+}} // namespace jeyson::backend
@@ -0,0 +1,143 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `jeyson-lib`.
+//
+// Changelog:
+//      2026.10.15 Initial version.
+////////////////////////////////////////////////////////////////////////////////
+#include "native_loader.hpp"
+#include "instrumentation.hpp"
+#include "structural_index.hpp"
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace jeyson {
+namespace backend {
+
+namespace {
+
+// Number of ranges per thread, more ranges balance the load better
+constexpr std::size_t parts_per_thread = 4;
+
+// Ranges are copied (with brackets added) to be parsed as separate arrays,
+// so only a few ranges per thread are in memory at once.
+json_t * parse_range (char const * first, char const * last, std::size_t flags
+    , bool native, std::string & buffer)
+{
+    buffer.clear();
+    buffer.reserve(static_cast<std::size_t>(last - first) + 2);
+    buffer.push_back('[');
+    buffer.append(first, last);
+    buffer.push_back(']');
+
+    auto j = native
+        ? native_loadb(buffer.data(), buffer.size(), flags, nullptr)
+        : json_loadb(buffer.data(), buffer.size(), flags, nullptr);
+
+    // Empty range means misplaced comma (e.g. `[1,,2]`)
+    if (j && (!json_is_array(j) || json_array_size(j) == 0)) {
+        json_decref(j);
+        j = nullptr;
+    }
+
+    return j;
+}
+
+} // namespace
+
+json_t * parallel_loadb (char const * buffer, std::size_t buflen, std::size_t flags
+    , bool native, std::size_t threads)
+{
+    if (!buffer)
+        return nullptr;
+
+    if (threads == 0)
+        threads = static_cast<std::size_t>((std::max)(std::thread::hardware_concurrency(), 1u));
+
+    if (threads < 2)
+        return nullptr;
+
+    std::vector<std::size_t> bounds;
+
+    {
+        instrumentation::phase_timer timer {instrumentation::phase::index};
+
+        // Ranges must fit the structural index of the native parser
+        auto parts = (std::max)(threads * parts_per_thread
+            , buflen / (structural::index::max_length / 2) + 1);
+
+        if (!structural::split_array(buffer, buflen, parts, bounds))
+            return nullptr;
+    }
+
+    // Opening bracket, closing bracket and at least one comma
+    if (bounds.size() < 3)
+        return nullptr;
+
+    instrumentation::phase_timer timer {instrumentation::phase::build};
+
+    auto part_count = bounds.size() - 1;
+    std::vector<json_t *> parts(part_count, nullptr);
+    std::atomic<std::size_t> next {0};
+    std::atomic<bool> failed {false};
+
+    auto worker = [&] {
+        std::string range;
+
+        try {
+            for (;;) {
+                auto k = next.fetch_add(1, std::memory_order_relaxed);
+
+                if (k >= part_count || failed.load(std::memory_order_relaxed))
+                    return;
+
+                parts[k] = parse_range(buffer + bounds[k] + 1, buffer + bounds[k + 1]
+                    , flags, native, range);
+
+                if (!parts[k]) {
+                    failed.store(true, std::memory_order_relaxed);
+                    return;
+                }
+            }
+        } catch (...) {
+            failed.store(true, std::memory_order_relaxed);
+        }
+    };
+
+    threads = (std::min)(threads, part_count);
+
+    std::vector<std::thread> pool;
+    pool.reserve(threads - 1);
+
+    try {
+        for (std::size_t i = 1; i < threads; i++)
+            pool.emplace_back(worker);
+    } catch (...) {
+        // Proceed with the threads already started
+    }
+
+    worker();
+
+    for (auto & t: pool)
+        t.join();
+
+    json_t * result = failed ? nullptr : json_array();
+
+    for (auto part: parts) {
+        if (result && json_array_extend(result, part) != 0) {
+            json_decref(result);
+            result = nullptr;
+        }
+
+        if (part)
+            json_decref(part);
+    }
+
+    return result;
+}
+
+}} // namespace jeyson::backend
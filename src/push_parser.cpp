@@ -0,0 +1,829 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `jeyson-lib`.
+//
+// Changelog:
+//      2026.10.15 Initial version.
+////////////////////////////////////////////////////////////////////////////////
+#include "jeyson/push_parser.hpp"
+#include "jeyson/backend/jansson.hpp"
+#include "jeyson/number.hpp"
+#include "structural_parser.hpp"
+#include <pfs/i18n.hpp>
+#include <jansson.h>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace jeyson {
+
+using BACKEND = backend::jansson;
+using JSON    = json<BACKEND>;
+
+#define NATIVE(x) ((x)._ptr)
+
+namespace {
+
+using structural::parse_errc;
+
+constexpr std::size_t max_depth = 2048;
+
+inline bool is_whitespace (char c) noexcept
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+inline bool is_number_char (char c) noexcept
+{
+    return (c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E';
+}
+
+inline int hex_value (char c) noexcept
+{
+    if (c >= '0' && c <= '9')
+        return c - '0';
+
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+
+    if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+
+    return -1;
+}
+
+void append_utf8 (std::string & s, std::uint32_t cp)
+{
+    if (cp < 0x80) {
+        s.push_back(static_cast<char>(cp));
+    } else if (cp < 0x800) {
+        s.push_back(static_cast<char>(0xC0 | (cp >> 6)));
+        s.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+    } else if (cp < 0x10000) {
+        s.push_back(static_cast<char>(0xE0 | (cp >> 12)));
+        s.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+        s.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+    } else {
+        s.push_back(static_cast<char>(0xF0 | (cp >> 18)));
+        s.push_back(static_cast<char>(0x80 | ((cp >> 12) & 0x3F)));
+        s.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+        s.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+    }
+}
+
+// Validates UTF-8 (overlong forms, surrogates and code points above U+10FFFF
+// are rejected).
+bool is_valid_utf8 (char const * p, char const * end) noexcept
+{
+    auto u = [] (char c) { return static_cast<unsigned char>(c); };
+
+    while (p != end) {
+        auto c0 = u(*p);
+
+        if (c0 < 0x80) {
+            ++p;
+            continue;
+        }
+
+        std::size_t n = 0;
+        unsigned char lo = 0x80;
+        unsigned char hi = 0xBF;
+
+        if (c0 >= 0xC2 && c0 <= 0xDF) {
+            n = 1;
+        } else if (c0 >= 0xE0 && c0 <= 0xEF) {
+            n = 2;
+
+            if (c0 == 0xE0)
+                lo = 0xA0;
+            else if (c0 == 0xED)
+                hi = 0x9F;
+        } else if (c0 >= 0xF0 && c0 <= 0xF4) {
+            n = 3;
+
+            if (c0 == 0xF0)
+                lo = 0x90;
+            else if (c0 == 0xF4)
+                hi = 0x8F;
+        } else {
+            return false;
+        }
+
+        if (static_cast<std::size_t>(end - p) <= n)
+            return false;
+
+        if (u(p[1]) < lo || u(p[1]) > hi)
+            return false;
+
+        for (std::size_t i = 2; i <= n; i++) {
+            if ((u(p[i]) & 0xC0) != 0x80)
+                return false;
+        }
+
+        p += n + 1;
+    }
+
+    return true;
+}
+
+} // namespace
+
+template <>
+class json_push_parser<BACKEND>::state
+{
+    enum class syntax
+    {
+          value           // Value expected
+        , array_begin     // Value or ']' expected
+        , array_continue  // ',' or ']' expected
+        , object_begin    // Key or '}' expected
+        , object_key      // Key expected
+        , object_colon    // ':' expected
+        , object_continue // ',' or '}' expected
+    };
+
+    enum class token
+    {
+          none
+        , string
+        , string_escape
+        , string_unicode
+        , surrogate_backslash // '\' of the low surrogate escape expected
+        , surrogate_u         // 'u' of the low surrogate escape expected
+        , number
+        , literal
+    };
+
+    struct frame
+    {
+        json_t * container {nullptr};
+        std::string key;
+    };
+
+    value_callback _on_value;
+
+    syntax _syntax {syntax::value};
+    token _token {token::none};
+    bool _is_key {false};            // String token is an object key
+    std::string _buffer;             // Incomplete token
+    std::uint32_t _cp {0};           // Code point of the Unicode escape
+    std::uint32_t _high {0};         // High surrogate or zero
+    int _hex_count {0};
+    char const * _literal {nullptr}; // Literal in progress
+    std::size_t _matched {0};        // Matched characters of the literal
+    std::size_t _token_offset {0};   // Offset of the number token
+    bool _boundary {false};          // Whitespace must follow top-level number or literal
+
+    json_t * _root {nullptr};        // Top-level container in progress
+    std::vector<frame> _frames;      // Frames are reused to keep allocated key buffers
+    std::size_t _depth {0};
+
+    std::size_t _offset {0};         // Offset of the current chunk
+    char const * _chunk {nullptr};   // Current chunk
+    bool _failed {false};
+    parse_errc _error {parse_errc::success};
+    std::size_t _error_offset {0};
+
+public:
+    state (value_callback && on_value)
+        : _on_value(std::move(on_value))
+    {}
+
+    ~state ()
+    {
+        clear();
+    }
+
+    std::size_t offset () const noexcept { return _offset; }
+    bool failed () const noexcept { return _failed; }
+    std::size_t error_offset () const noexcept { return _error_offset; }
+
+    bool incomplete () const noexcept
+    {
+        return _token != token::none || _depth > 0;
+    }
+
+    void reset () noexcept
+    {
+        clear();
+        _offset = 0;
+        _failed = false;
+        _error = parse_errc::success;
+        _error_offset = 0;
+    }
+
+    bool feed (char const * data, std::size_t len, error * perr)
+    {
+        if (_failed)
+            return report(perr);
+
+        _chunk = data;
+
+        auto rc = parse(data, data + len);
+
+        _offset += len;
+
+        return rc == parse_errc::success ? true : report(perr);
+    }
+
+    bool finish (error * perr)
+    {
+        if (_failed)
+            return report(perr);
+
+        _chunk = nullptr;
+
+        auto rc = parse_errc::success;
+
+        if (_token == token::number)
+            rc = complete_number();
+
+        if (rc == parse_errc::success && incomplete())
+            rc = fail(_offset, parse_errc::premature_end);
+
+        _boundary = false;
+
+        return rc == parse_errc::success ? true : report(perr);
+    }
+
+private:
+    void clear () noexcept
+    {
+        if (_root)
+            json_decref(_root);
+
+        _root = nullptr;
+        _depth = 0;
+        _syntax = syntax::value;
+        _token = token::none;
+        _high = 0;
+        _boundary = false;
+    }
+
+    std::size_t position (char const * p) const noexcept
+    {
+        return _chunk ? _offset + static_cast<std::size_t>(p - _chunk) : _offset;
+    }
+
+    parse_errc fail (std::size_t pos, parse_errc ec) noexcept
+    {
+        clear();
+        _failed = true;
+        _error = ec;
+        _error_offset = pos;
+        return ec;
+    }
+
+    bool report (error * perr)
+    {
+        pfs::throw_or(perr, make_error_code(pfs::errc::backend_error)
+            , tr::f_("parse error at offset {}: {}", _error_offset, structural::message(_error)));
+
+        return false;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Grammar
+    ////////////////////////////////////////////////////////////////////////////
+    parse_errc parse (char const * p, char const * end)
+    {
+        while (p != end) {
+            if (_token != token::none) {
+                auto rc = continue_token(p, end);
+
+                if (rc != parse_errc::success)
+                    return rc;
+
+                continue;
+            }
+
+            auto c = *p;
+
+            if (is_whitespace(c)) {
+                _boundary = false;
+                ++p;
+                continue;
+            }
+
+            if (_boundary)
+                return fail(position(p), parse_errc::invalid_token);
+
+            auto rc = parse_errc::success;
+
+            switch (_syntax) {
+                case syntax::array_begin:
+                    if (c == ']') {
+                        rc = end_container(p);
+                        break;
+                    }
+
+                    rc = begin_value(p);
+                    break;
+
+                case syntax::value:
+                    rc = begin_value(p);
+                    break;
+
+                case syntax::array_continue:
+                    if (c == ',') {
+                        _syntax = syntax::value;
+                        ++p;
+                    } else if (c == ']') {
+                        rc = end_container(p);
+                    } else {
+                        rc = fail(position(p), parse_errc::rbracket_expected);
+                    }
+
+                    break;
+
+                case syntax::object_begin:
+                case syntax::object_key:
+                    if (c == '"') {
+                        begin_string(p, true);
+                    } else if (c == '}' && _syntax == syntax::object_begin) {
+                        rc = end_container(p);
+                    } else {
+                        rc = fail(position(p), _syntax == syntax::object_begin
+                            ? parse_errc::string_or_rbrace_expected
+                            : parse_errc::string_expected);
+                    }
+
+                    break;
+
+                case syntax::object_colon:
+                    if (c == ':') {
+                        _syntax = syntax::value;
+                        ++p;
+                    } else {
+                        rc = fail(position(p), parse_errc::colon_expected);
+                    }
+
+                    break;
+
+                case syntax::object_continue:
+                    if (c == ',') {
+                        _syntax = syntax::object_key;
+                        ++p;
+                    } else if (c == '}') {
+                        rc = end_container(p);
+                    } else {
+                        rc = fail(position(p), parse_errc::rbrace_expected);
+                    }
+
+                    break;
+            }
+
+            if (rc != parse_errc::success)
+                return rc;
+        }
+
+        return parse_errc::success;
+    }
+
+    parse_errc begin_value (char const *& p)
+    {
+        switch (*p) {
+            case '{':
+                return begin_container(p, json_object());
+
+            case '[':
+                return begin_container(p, json_array());
+
+            case '"':
+                begin_string(p, false);
+                return parse_errc::success;
+
+            case 't':
+                return begin_literal(p, "true");
+
+            case 'f':
+                return begin_literal(p, "false");
+
+            case 'n':
+                return begin_literal(p, "null");
+
+            default:
+                if (*p == '-' || (*p >= '0' && *p <= '9')) {
+                    _buffer.clear();
+                    _token_offset = position(p);
+                    _token = token::number;
+                    return parse_errc::success;
+                }
+
+                return fail(position(p), parse_errc::invalid_token);
+        }
+    }
+
+    parse_errc begin_container (char const *& p, json_t * container)
+    {
+        if (!container)
+            return fail(position(p), parse_errc::out_of_memory);
+
+        if (_depth >= max_depth) {
+            json_decref(container);
+            return fail(position(p), parse_errc::depth_exceeded);
+        }
+
+        if (_depth == 0) {
+            _root = container;
+        } else {
+            auto rc = add_member(container);
+
+            if (rc != parse_errc::success)
+                return fail(position(p), rc);
+        }
+
+        if (_depth == _frames.size())
+            _frames.emplace_back();
+
+        _frames[_depth++].container = container;
+        _syntax = json_is_object(container) ? syntax::object_begin : syntax::array_begin;
+        ++p;
+
+        return parse_errc::success;
+    }
+
+    parse_errc end_container (char const *& p)
+    {
+        ++p;
+
+        if (--_depth == 0) {
+            auto root = _root;
+            _root = nullptr;
+            _syntax = syntax::value;
+            emit(root);
+        } else {
+            _syntax = after_value();
+        }
+
+        return parse_errc::success;
+    }
+
+    syntax after_value () const noexcept
+    {
+        if (_depth == 0)
+            return syntax::value;
+
+        return json_is_object(_frames[_depth - 1].container)
+            ? syntax::object_continue : syntax::array_continue;
+    }
+
+    // value must be a new reference
+    parse_errc add_member (json_t * value)
+    {
+        auto & f = _frames[_depth - 1];
+
+        // Both functions steal the reference even on failure
+        auto rc = json_is_object(f.container)
+            ? json_object_setn_new_nocheck(f.container, f.key.data(), f.key.size(), value)
+            : json_array_append_new(f.container, value);
+
+        return rc == 0 ? parse_errc::success : parse_errc::handler_failure;
+    }
+
+    // Adds completed scalar, value must be a new reference
+    parse_errc add_scalar (std::size_t pos, json_t * value)
+    {
+        if (!value)
+            return fail(pos, parse_errc::out_of_memory);
+
+        if (_depth == 0) {
+            _syntax = syntax::value;
+            emit(value);
+            return parse_errc::success;
+        }
+
+        auto rc = add_member(value);
+
+        if (rc != parse_errc::success)
+            return fail(pos, rc);
+
+        _syntax = after_value();
+        return parse_errc::success;
+    }
+
+    // Passes ownership of the completed top-level value to the callback
+    void emit (json_t * value)
+    {
+        JSON result;
+        NATIVE(result) = value;
+
+        if (_on_value)
+            _on_value(std::move(result));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Tokens
+    ////////////////////////////////////////////////////////////////////////////
+    void begin_string (char const *& p, bool is_key)
+    {
+        _buffer.clear();
+        _is_key = is_key;
+        _token = token::string;
+        ++p;
+    }
+
+    parse_errc begin_literal (char const *& p, char const * literal)
+    {
+        _literal = literal;
+        _matched = 1;
+        _token = token::literal;
+        ++p;
+        return parse_errc::success;
+    }
+
+    parse_errc continue_token (char const *& p, char const * end)
+    {
+        switch (_token) {
+            case token::string: {
+                auto start = p;
+
+                while (p != end) {
+                    auto c = static_cast<unsigned char>(*p);
+
+                    if (c == '"') {
+                        _buffer.append(start, p);
+                        ++p;
+                        return complete_string(p - 1);
+                    }
+
+                    if (c == '\\') {
+                        _buffer.append(start, p);
+                        _token = token::string_escape;
+                        ++p;
+                        return parse_errc::success;
+                    }
+
+                    if (c < 0x20)
+                        return fail(position(p), parse_errc::control_character);
+
+                    ++p;
+                }
+
+                _buffer.append(start, p);
+                return parse_errc::success;
+            }
+
+            case token::string_escape: {
+                auto c = *p;
+
+                switch (c) {
+                    case '"': _buffer.push_back('"'); break;
+                    case '\\': _buffer.push_back('\\'); break;
+                    case '/': _buffer.push_back('/'); break;
+                    case 'b': _buffer.push_back('\b'); break;
+                    case 'f': _buffer.push_back('\f'); break;
+                    case 'n': _buffer.push_back('\n'); break;
+                    case 'r': _buffer.push_back('\r'); break;
+                    case 't': _buffer.push_back('\t'); break;
+                    case 'u':
+                        _cp = 0;
+                        _hex_count = 0;
+                        _token = token::string_unicode;
+                        ++p;
+                        return parse_errc::success;
+                    default:
+                        return fail(position(p), parse_errc::invalid_escape);
+                }
+
+                _token = token::string;
+                ++p;
+                return parse_errc::success;
+            }
+
+            case token::string_unicode: {
+                while (p != end && _hex_count < 4) {
+                    auto h = hex_value(*p);
+
+                    if (h < 0)
+                        return fail(position(p), parse_errc::invalid_escape);
+
+                    _cp = (_cp << 4) | static_cast<std::uint32_t>(h);
+                    ++_hex_count;
+                    ++p;
+                }
+
+                if (_hex_count < 4)
+                    return parse_errc::success;
+
+                return complete_unicode(p);
+            }
+
+            case token::surrogate_backslash:
+                if (*p != '\\')
+                    return fail(position(p), parse_errc::invalid_unicode);
+
+                _token = token::surrogate_u;
+                ++p;
+                return parse_errc::success;
+
+            case token::surrogate_u:
+                if (*p != 'u')
+                    return fail(position(p), parse_errc::invalid_unicode);
+
+                _cp = 0;
+                _hex_count = 0;
+                _token = token::string_unicode;
+                ++p;
+                return parse_errc::success;
+
+            case token::number: {
+                auto start = p;
+
+                while (p != end && is_number_char(*p))
+                    ++p;
+
+                _buffer.append(start, p);
+
+                // Number is completed by a delimiter (not consumed)
+                return p != end ? complete_number() : parse_errc::success;
+            }
+
+            case token::literal: {
+                while (p != end && _literal[_matched] != '\0') {
+                    if (*p != _literal[_matched])
+                        return fail(position(p), parse_errc::invalid_token);
+
+                    ++_matched;
+                    ++p;
+                }
+
+                if (_literal[_matched] != '\0')
+                    return parse_errc::success;
+
+                _token = token::none;
+
+                auto value = _literal[0] == 't' ? json_true()
+                    : _literal[0] == 'f' ? json_false()
+                    : json_null();
+
+                _boundary = _depth == 0;
+                return add_scalar(position(p), value);
+            }
+
+            case token::none:
+                break;
+        }
+
+        return parse_errc::success;
+    }
+
+    parse_errc complete_unicode (char const * p)
+    {
+        auto pos = position(p);
+
+        if (_high != 0) {
+            if (_cp < 0xDC00 || _cp > 0xDFFF)
+                return fail(pos, parse_errc::invalid_unicode);
+
+            _cp = 0x10000 + ((_high - 0xD800) << 10) + (_cp - 0xDC00);
+            _high = 0;
+        } else if (_cp >= 0xD800 && _cp <= 0xDBFF) {
+            _high = _cp;
+            _token = token::surrogate_backslash;
+            return parse_errc::success;
+        } else if (_cp >= 0xDC00 && _cp <= 0xDFFF) {
+            return fail(pos, parse_errc::invalid_unicode);
+        } else if (_cp == 0) {
+            return fail(pos, parse_errc::null_character);
+        }
+
+        append_utf8(_buffer, _cp);
+        _token = token::string;
+        return parse_errc::success;
+    }
+
+    // @a quote is the closing quote position
+    parse_errc complete_string (char const * quote)
+    {
+        _token = token::none;
+
+        if (!is_valid_utf8(_buffer.data(), _buffer.data() + _buffer.size()))
+            return fail(position(quote), parse_errc::invalid_utf8);
+
+        if (_is_key) {
+            _frames[_depth - 1].key.assign(_buffer);
+            _syntax = syntax::object_colon;
+            return parse_errc::success;
+        }
+
+        return add_scalar(position(quote), json_stringn_nocheck(_buffer.data(), _buffer.size()));
+    }
+
+    parse_errc complete_number ()
+    {
+        _token = token::none;
+        _boundary = _depth == 0;
+
+        auto pos = _token_offset;
+        char const * begin = _buffer.data();
+        char const * end = begin + _buffer.size();
+        char const * p = begin;
+        number::decimal d;
+
+        if (!number::scan(p, end, d) || p != end)
+            return fail(pos, parse_errc::invalid_token);
+
+        if (d.is_integer) {
+            auto max_abs = static_cast<std::uint64_t>((std::numeric_limits<std::int64_t>::max)());
+
+            if (d.integer_overflow || d.integer > max_abs + (d.negative ? 1 : 0))
+                return fail(pos, parse_errc::integer_overflow);
+
+            auto value = d.negative
+                ? static_cast<std::int64_t>(~d.integer + 1)
+                : static_cast<std::int64_t>(d.integer);
+
+            return add_scalar(pos, json_integer(static_cast<json_int_t>(value)));
+        }
+
+        double value = 0;
+        auto rc = number::to_double(d, value);
+
+        if (rc == number::conversion::inexact)
+            rc = number::strtod(begin, end, value);
+
+        if (rc == number::conversion::overflow)
+            return fail(pos, parse_errc::real_overflow);
+
+        return add_scalar(pos, json_real(value));
+    }
+};
+
+template <>
+json_push_parser<BACKEND>::json_push_parser (value_callback on_value)
+    : _d(new state(std::move(on_value)))
+{}
+
+template <>
+json_push_parser<BACKEND>::json_push_parser (json_push_parser && other) noexcept
+    : _d(other._d)
+{
+    other._d = nullptr;
+}
+
+template <>
+json_push_parser<BACKEND> &
+json_push_parser<BACKEND>::operator = (json_push_parser && other) noexcept
+{
+    if (this != & other) {
+        delete _d;
+        _d = other._d;
+        other._d = nullptr;
+    }
+
+    return *this;
+}
+
+template <>
+json_push_parser<BACKEND>::~json_push_parser ()
+{
+    delete _d;
+}
+
+template <>
+bool json_push_parser<BACKEND>::feed (char const * data, std::size_t len, error * perr)
+{
+    return _d->feed(data, len, perr);
+}
+
+template <>
+bool json_push_parser<BACKEND>::finish (error * perr)
+{
+    return _d->finish(perr);
+}
+
+template <>
+void json_push_parser<BACKEND>::reset ()
+{
+    _d->reset();
+}
+
+template <>
+std::size_t json_push_parser<BACKEND>::offset () const noexcept
+{
+    return _d->offset();
+}
+
+template <>
+bool json_push_parser<BACKEND>::failed () const noexcept
+{
+    return _d->failed();
+}
+
+template <>
+std::size_t json_push_parser<BACKEND>::error_offset () const noexcept
+{
+    return _d->error_offset();
+}
+
+template <>
+bool json_push_parser<BACKEND>::incomplete () const noexcept
+{
+    return _d->incomplete();
+}
+
+} // namespace jeyson
@@ -0,0 +1,33 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `jeyson-lib`.
+//
+// Changelog:
+//      2026.10.15 Initial version.
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include <cstddef>
+
+namespace jeyson {
+namespace number {
+
+/// Buffer size enough for any output of the format functions.
+constexpr std::size_t format_buffer_size = 64;
+
+/**
+ * Writes shortest representation of finite @a value that round-trips
+ * (Ryu algorithm). Output always contains decimal point or exponent,
+ * e.g. `0.1`, `100.0`, `1e-7`, `-1.5e300`.
+ *
+ * @return Pointer past the last written character.
+ */
+char * format_shortest (double value, char * buf) noexcept;
+
+/**
+ * Writes @a value formatted as `%.<precision>g` (normalized in the same way as
+ * `format_shortest()` does).
+ */
+char * format_precision (double value, int precision, char * buf) noexcept;
+
+}} // namespace jeyson::number
@@ -0,0 +1,437 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `jeyson-lib`.
+//
+// Changelog:
+//      2026.10.15 Initial version.
+//                 Added top-level array pre-scan for parallel parsing.
+////////////////////////////////////////////////////////////////////////////////
+#include "structural_index.hpp"
+#include <cstring>
+
+#if defined(__AVX2__)
+#   define JEYSON__STRUCTURAL_AVX2 1
+#   include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   define JEYSON__STRUCTURAL_SSE2 1
+#   include <emmintrin.h>
+#elif defined(__ARM_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+#   define JEYSON__STRUCTURAL_NEON 1
+#   include <arm_neon.h>
+#endif
+
+#if defined(__PCLMUL__) || (defined(_MSC_VER) && defined(__AVX2__))
+#   define JEYSON__STRUCTURAL_CLMUL 1
+#   include <wmmintrin.h>
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#   include <intrin.h>
+#endif
+
+namespace jeyson {
+namespace structural {
+
+namespace {
+
+constexpr std::size_t BLOCK_SIZE = 64;
+
+// Per-block character classes, one bit per byte.
+struct block_masks
+{
+    std::uint64_t backslash;
+    std::uint64_t quote;
+    std::uint64_t op;  // {}[]:,
+    std::uint64_t ws;  // space, \t, \n, \r
+};
+
+inline unsigned trailing_zeros (std::uint64_t x) noexcept
+{
+#if defined(_MSC_VER) && !defined(__clang__) && defined(_M_X64)
+    unsigned long r;
+    _BitScanForward64(& r, x);
+    return static_cast<unsigned>(r);
+#elif defined(_MSC_VER) && !defined(__clang__)
+    unsigned long r;
+
+    if (_BitScanForward(& r, static_cast<unsigned long>(x)))
+        return static_cast<unsigned>(r);
+
+    _BitScanForward(& r, static_cast<unsigned long>(x >> 32));
+    return static_cast<unsigned>(r) + 32;
+#else
+    return static_cast<unsigned>(__builtin_ctzll(x));
+#endif
+}
+
+// Bit i of the result is the XOR of bits 0..i of x.
+inline std::uint64_t prefix_xor (std::uint64_t x) noexcept
+{
+#if JEYSON__STRUCTURAL_CLMUL
+    __m128i all_ones = _mm_set1_epi8('\xFF');
+    __m128i result = _mm_clmulepi64_si128(_mm_set_epi64x(0, static_cast<long long>(x)), all_ones, 0);
+    return static_cast<std::uint64_t>(_mm_cvtsi128_si64(result));
+#else
+    x ^= x << 1;
+    x ^= x << 2;
+    x ^= x << 4;
+    x ^= x << 8;
+    x ^= x << 16;
+    x ^= x << 32;
+    return x;
+#endif
+}
+
+#if JEYSON__STRUCTURAL_AVX2
+
+inline std::uint64_t to_mask (__m256i lo, __m256i hi) noexcept
+{
+    return static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm256_movemask_epi8(lo)))
+        | (static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm256_movemask_epi8(hi))) << 32);
+}
+
+inline void classify (char const * p, block_masks & m) noexcept
+{
+    __m256i const v[2] = {
+          _mm256_loadu_si256(reinterpret_cast<__m256i const *>(p))
+        , _mm256_loadu_si256(reinterpret_cast<__m256i const *>(p + 32))
+    };
+
+    __m256i backslash[2], quote[2], op[2], ws[2];
+
+    for (int i = 0; i < 2; i++) {
+        // `[` | 0x20 == `{`, `]` | 0x20 == `}`
+        __m256i lower = _mm256_or_si256(v[i], _mm256_set1_epi8(0x20));
+
+        backslash[i] = _mm256_cmpeq_epi8(v[i], _mm256_set1_epi8('\\'));
+        quote[i] = _mm256_cmpeq_epi8(v[i], _mm256_set1_epi8('"'));
+        op[i] = _mm256_or_si256(
+              _mm256_or_si256(_mm256_cmpeq_epi8(lower, _mm256_set1_epi8('{'))
+                , _mm256_cmpeq_epi8(lower, _mm256_set1_epi8('}')))
+            , _mm256_or_si256(_mm256_cmpeq_epi8(v[i], _mm256_set1_epi8(','))
+                , _mm256_cmpeq_epi8(v[i], _mm256_set1_epi8(':'))));
+        ws[i] = _mm256_or_si256(
+              _mm256_or_si256(_mm256_cmpeq_epi8(v[i], _mm256_set1_epi8(' '))
+                , _mm256_cmpeq_epi8(v[i], _mm256_set1_epi8('\t')))
+            , _mm256_or_si256(_mm256_cmpeq_epi8(v[i], _mm256_set1_epi8('\n'))
+                , _mm256_cmpeq_epi8(v[i], _mm256_set1_epi8('\r'))));
+    }
+
+    m.backslash = to_mask(backslash[0], backslash[1]);
+    m.quote = to_mask(quote[0], quote[1]);
+    m.op = to_mask(op[0], op[1]);
+    m.ws = to_mask(ws[0], ws[1]);
+}
+
+#elif JEYSON__STRUCTURAL_SSE2
+
+inline std::uint64_t to_mask (__m128i const * x) noexcept
+{
+    return static_cast<std::uint64_t>(static_cast<std::uint16_t>(_mm_movemask_epi8(x[0])))
+        | (static_cast<std::uint64_t>(static_cast<std::uint16_t>(_mm_movemask_epi8(x[1]))) << 16)
+        | (static_cast<std::uint64_t>(static_cast<std::uint16_t>(_mm_movemask_epi8(x[2]))) << 32)
+        | (static_cast<std::uint64_t>(static_cast<std::uint16_t>(_mm_movemask_epi8(x[3]))) << 48);
+}
+
+inline void classify (char const * p, block_masks & m) noexcept
+{
+    __m128i backslash[4], quote[4], op[4], ws[4];
+
+    for (int i = 0; i < 4; i++) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<__m128i const *>(p + i * 16));
+
+        // `[` | 0x20 == `{`, `]` | 0x20 == `}`
+        __m128i lower = _mm_or_si128(v, _mm_set1_epi8(0x20));
+
+        backslash[i] = _mm_cmpeq_epi8(v, _mm_set1_epi8('\\'));
+        quote[i] = _mm_cmpeq_epi8(v, _mm_set1_epi8('"'));
+        op[i] = _mm_or_si128(
+              _mm_or_si128(_mm_cmpeq_epi8(lower, _mm_set1_epi8('{'))
+                , _mm_cmpeq_epi8(lower, _mm_set1_epi8('}')))
+            , _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(','))
+                , _mm_cmpeq_epi8(v, _mm_set1_epi8(':'))));
+        ws[i] = _mm_or_si128(
+              _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(' '))
+                , _mm_cmpeq_epi8(v, _mm_set1_epi8('\t')))
+            , _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('\n'))
+                , _mm_cmpeq_epi8(v, _mm_set1_epi8('\r'))));
+    }
+
+    m.backslash = to_mask(backslash);
+    m.quote = to_mask(quote);
+    m.op = to_mask(op);
+    m.ws = to_mask(ws);
+}
+
+#elif JEYSON__STRUCTURAL_NEON
+
+inline std::uint64_t to_mask (uint8x16_t const * x) noexcept
+{
+    uint8x16_t const bits = {1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+    uint8x16_t sum0 = vpaddq_u8(vandq_u8(x[0], bits), vandq_u8(x[1], bits));
+    uint8x16_t sum1 = vpaddq_u8(vandq_u8(x[2], bits), vandq_u8(x[3], bits));
+    sum0 = vpaddq_u8(sum0, sum1);
+    sum0 = vpaddq_u8(sum0, sum0);
+    return vgetq_lane_u64(vreinterpretq_u64_u8(sum0), 0);
+}
+
+inline void classify (char const * p, block_masks & m) noexcept
+{
+    uint8x16_t backslash[4], quote[4], op[4], ws[4];
+
+    for (int i = 0; i < 4; i++) {
+        uint8x16_t v = vld1q_u8(reinterpret_cast<std::uint8_t const *>(p + i * 16));
+
+        // `[` | 0x20 == `{`, `]` | 0x20 == `}`
+        uint8x16_t lower = vorrq_u8(v, vdupq_n_u8(0x20));
+
+        backslash[i] = vceqq_u8(v, vdupq_n_u8('\\'));
+        quote[i] = vceqq_u8(v, vdupq_n_u8('"'));
+        op[i] = vorrq_u8(
+              vorrq_u8(vceqq_u8(lower, vdupq_n_u8('{')), vceqq_u8(lower, vdupq_n_u8('}')))
+            , vorrq_u8(vceqq_u8(v, vdupq_n_u8(',')), vceqq_u8(v, vdupq_n_u8(':'))));
+        ws[i] = vorrq_u8(
+              vorrq_u8(vceqq_u8(v, vdupq_n_u8(' ')), vceqq_u8(v, vdupq_n_u8('\t')))
+            , vorrq_u8(vceqq_u8(v, vdupq_n_u8('\n')), vceqq_u8(v, vdupq_n_u8('\r'))));
+    }
+
+    m.backslash = to_mask(backslash);
+    m.quote = to_mask(quote);
+    m.op = to_mask(op);
+    m.ws = to_mask(ws);
+}
+
+#else
+
+inline void classify (char const * p, block_masks & m) noexcept
+{
+    m.backslash = m.quote = m.op = m.ws = 0;
+
+    for (std::size_t i = 0; i < BLOCK_SIZE; i++) {
+        std::uint64_t bit = std::uint64_t{1} << i;
+
+        switch (p[i]) {
+            case '\\': m.backslash |= bit; break;
+            case '"': m.quote |= bit; break;
+            case '{': case '}': case '[': case ']': case ':': case ',': m.op |= bit; break;
+            case ' ': case '\t': case '\n': case '\r': m.ws |= bit; break;
+            default: break;
+        }
+    }
+}
+
+#endif
+
+// State carried between blocks.
+class block_scanner
+{
+    std::uint64_t _next_is_escaped {0};   // first char of the next block is escaped
+    std::uint64_t _prev_in_string {0};    // all ones if previous block ended inside string
+    std::uint64_t _prev_scalar {0};       // last char of previous block is a non-quote scalar
+
+private:
+    // Returns mask of characters escaped by backslash.
+    std::uint64_t escaped (std::uint64_t backslash) noexcept
+    {
+        constexpr std::uint64_t ODD_BITS = 0xAAAAAAAAAAAAAAAAULL;
+
+        if (!backslash) {
+            auto result = _next_is_escaped;
+            _next_is_escaped = 0;
+            return result;
+        }
+
+        // Backslash escaped by the previous block is not the start of an escape sequence
+        auto potential_escape = backslash & ~_next_is_escaped;
+        auto maybe_escaped = potential_escape << 1;
+        auto even_series_codes_and_odd_bits = (maybe_escaped | ODD_BITS) - potential_escape;
+        auto escape_and_terminal_code = even_series_codes_and_odd_bits ^ ODD_BITS;
+        auto result = escape_and_terminal_code ^ (backslash | _next_is_escaped);
+        auto escape = escape_and_terminal_code & backslash;
+        _next_is_escaped = escape >> 63;
+        return result;
+    }
+
+public:
+    std::uint64_t next (char const * p) noexcept
+    {
+        block_masks m;
+        classify(p, m);
+
+        auto quote = m.quote & ~escaped(m.backslash);
+        auto in_string = prefix_xor(quote) ^ _prev_in_string;
+        _prev_in_string = static_cast<std::uint64_t>(static_cast<std::int64_t>(in_string) >> 63);
+
+        // String content with closing quote, without opening quote
+        auto string_tail = in_string ^ quote;
+
+        auto scalar = ~(m.op | m.ws);
+        auto nonquote_scalar = scalar & ~quote;
+        auto follows_nonquote_scalar = (nonquote_scalar << 1) | _prev_scalar;
+        _prev_scalar = nonquote_scalar >> 63;
+
+        auto scalar_start = scalar & ~follows_nonquote_scalar;
+
+        return (m.op | scalar_start) & ~string_tail;
+    }
+};
+
+inline index::position_type * flatten (index::position_type * out
+    , std::uint64_t bits, index::position_type base) noexcept
+{
+    while (bits) {
+        *out++ = base + trailing_zeros(bits);
+        bits &= bits - 1;
+    }
+
+    return out;
+}
+
+} // namespace
+
+void index::build (char const * data, std::size_t len)
+{
+    if (_capacity < len + 1) {
+        _positions.reset(new position_type[len + 1]);
+        _capacity = len + 1;
+    }
+
+    block_scanner scanner;
+    auto out = _positions.get();
+    std::size_t pos = 0;
+
+    for (; pos + BLOCK_SIZE <= len; pos += BLOCK_SIZE)
+        out = flatten(out, scanner.next(data + pos), static_cast<position_type>(pos));
+
+    if (pos < len) {
+        // Pad the tail with whitespaces, they are never structural
+        char tail[BLOCK_SIZE];
+        std::memset(tail, ' ', BLOCK_SIZE);
+        std::memcpy(tail, data + pos, len - pos);
+        out = flatten(out, scanner.next(tail), static_cast<position_type>(pos));
+    }
+
+    _count = static_cast<std::size_t>(out - _positions.get());
+    *out = static_cast<position_type>(len);
+}
+
+namespace {
+
+class array_splitter
+{
+    std::vector<std::size_t> & _bounds;
+    std::size_t _step;
+    std::size_t _next_split;
+    std::size_t _depth {0};
+    bool _closed {false};
+
+public:
+    array_splitter (std::vector<std::size_t> & bounds, std::size_t step)
+        : _bounds(bounds)
+        , _step(step)
+        , _next_split(step)
+    {}
+
+    bool closed () const noexcept
+    {
+        return _closed;
+    }
+
+    // @a block is the 64-byte block at position @a base
+    bool process (char const * block, std::uint64_t bits, std::size_t base)
+    {
+        for (; bits; bits &= bits - 1) {
+            auto offset = trailing_zeros(bits);
+            auto pos = base + offset;
+
+            // Nothing is allowed after the top-level array
+            if (_closed)
+                return false;
+
+            switch (block[offset]) {
+                case '[':
+                    if (_depth++ == 0)
+                        _bounds.push_back(pos);
+                    break;
+
+                case '{':
+                    if (_depth++ == 0)
+                        return false;
+                    break;
+
+                case ']':
+                case '}':
+                    if (_depth == 0)
+                        return false;
+
+                    if (--_depth == 0) {
+                        _bounds.push_back(pos);
+                        _closed = true;
+                    }
+
+                    break;
+
+                case ',':
+                    if (_depth == 1 && pos >= _next_split) {
+                        _bounds.push_back(pos);
+                        _next_split = pos + _step;
+                    }
+
+                    break;
+
+                default:
+                    // Top-level scalar
+                    if (_depth == 0)
+                        return false;
+
+                    break;
+            }
+        }
+
+        return true;
+    }
+};
+
+} // namespace
+
+bool split_array (char const * data, std::size_t len, std::size_t parts
+    , std::vector<std::size_t> & bounds)
+{
+    bounds.clear();
+
+    block_scanner scanner;
+    array_splitter splitter {bounds, len / (parts > 0 ? parts : 1) + 1};
+    std::size_t pos = 0;
+
+    for (; pos + BLOCK_SIZE <= len; pos += BLOCK_SIZE) {
+        if (!splitter.process(data + pos, scanner.next(data + pos), pos))
+            return false;
+    }
+
+    if (pos < len) {
+        char tail[BLOCK_SIZE];
+        std::memset(tail, ' ', BLOCK_SIZE);
+        std::memcpy(tail, data + pos, len - pos);
+
+        if (!splitter.process(tail, scanner.next(tail), pos))
+            return false;
+    }
+
+    return splitter.closed();
+}
+
+char const * implementation () noexcept
+{
+#if JEYSON__STRUCTURAL_AVX2
+    return "avx2";
+#elif JEYSON__STRUCTURAL_SSE2
+    return "sse2";
+#elif JEYSON__STRUCTURAL_NEON
+    return "neon";
+#else
+    return "scalar";
+#endif
+}
+
+}} // namespace jeyson::structural
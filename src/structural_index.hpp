@@ -0,0 +1,84 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `jeyson-lib`.
+//
+// Changelog:
+//      2026.10.15 Initial version.
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace jeyson {
+namespace structural {
+
+/**
+ * Structural index of a JSON text (stage 1 of the native parser).
+ *
+ * Contains, in ascending order, the positions of the structural characters
+ * `{`, `}`, `[`, `]`, `:`, `,` outside of strings, of the opening quotes of
+ * strings and of the first characters of other scalars (numbers, literals).
+ * The index is terminated by the length of the text.
+ */
+class index
+{
+public:
+    using position_type = std::uint32_t;
+
+    /// Maximum length of the text that can be indexed.
+    static constexpr std::size_t max_length = (std::numeric_limits<position_type>::max)() - 1;
+
+private:
+    std::unique_ptr<position_type[]> _positions;
+    std::size_t _capacity {0};
+    std::size_t _count {0};
+
+public:
+    /**
+     * Builds index for @a data with length @a len (must not exceed @c max_length).
+     * Previously built index is discarded, memory is reused if possible.
+     */
+    void build (char const * data, std::size_t len);
+
+    /// Number of positions excluding the terminating one.
+    std::size_t size () const noexcept
+    {
+        return _count;
+    }
+
+    position_type const * data () const noexcept
+    {
+        return _positions.get();
+    }
+
+    position_type operator [] (std::size_t i) const noexcept
+    {
+        return _positions[i];
+    }
+};
+
+/**
+ * Structural pre-scan for parallel parsing of a top-level array: finds the
+ * opening bracket, about @a parts - 1 commas separating elements of the
+ * top-level array at roughly equal distances and the closing bracket, and
+ * stores their positions in @a bounds (in ascending order).
+ *
+ * Only nesting is tracked, values are not validated: each range between the
+ * bounds must be parsed as a list of elements to check the text.
+ *
+ * @return @c false if the text is not a single top-level array.
+ */
+bool split_array (char const * data, std::size_t len, std::size_t parts
+    , std::vector<std::size_t> & bounds);
+
+/**
+ * Name of the block classifier the indexer is built with: "avx2", "sse2",
+ * "neon" or "scalar".
+ */
+char const * implementation () noexcept;
+
+}} // namespace jeyson::structural
@@ -0,0 +1,756 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `jeyson-lib`.
+//
+// Changelog:
+//      2026.10.15 Initial version.
+//                 Numbers are parsed by `number::scan()` and `number::to_double()`.
+//                 Added parsing of a single value from the index position.
+////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include "structural_index.hpp"
+#include "jeyson/number.hpp"
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace jeyson {
+namespace structural {
+
+enum class parse_errc
+{
+      success = 0
+    , premature_end
+    , invalid_token
+    , container_expected
+    , string_or_rbrace_expected
+    , string_expected
+    , colon_expected
+    , rbrace_expected
+    , rbracket_expected
+    , end_of_input_expected
+    , depth_exceeded
+    , control_character
+    , invalid_escape
+    , invalid_unicode
+    , invalid_utf8
+    , null_character
+    , null_byte_in_key
+    , duplicate_key
+    , integer_overflow
+    , real_overflow
+    , out_of_memory
+    , handler_failure
+};
+
+inline char const * message (parse_errc ec) noexcept
+{
+    switch (ec) {
+        case parse_errc::success: return "no error";
+        case parse_errc::premature_end: return "premature end of input";
+        case parse_errc::invalid_token: return "invalid token";
+        case parse_errc::container_expected: return "'[' or '{' expected";
+        case parse_errc::string_or_rbrace_expected: return "string or '}' expected";
+        case parse_errc::string_expected: return "string expected";
+        case parse_errc::colon_expected: return "':' expected";
+        case parse_errc::rbrace_expected: return "'}' expected";
+        case parse_errc::rbracket_expected: return "']' expected";
+        case parse_errc::end_of_input_expected: return "end of file expected";
+        case parse_errc::depth_exceeded: return "maximum parsing depth reached";
+        case parse_errc::control_character: return "control character in string";
+        case parse_errc::invalid_escape: return "invalid escape";
+        case parse_errc::invalid_unicode: return "invalid Unicode escape";
+        case parse_errc::invalid_utf8: return "invalid UTF-8";
+        case parse_errc::null_character: return "\\u0000 is not allowed";
+        case parse_errc::null_byte_in_key: return "NUL byte in object key not supported";
+        case parse_errc::duplicate_key: return "duplicate object key";
+        case parse_errc::integer_overflow: return "too big integer";
+        case parse_errc::real_overflow: return "real number overflow";
+        case parse_errc::out_of_memory: return "out of memory";
+        case parse_errc::handler_failure: return "value construction failure";
+    }
+
+    return "unknown error";
+}
+
+struct parse_options
+{
+    bool decode_any {true};   // Accept any value at the top level, not only arrays and objects
+    bool allow_nul {false};   // Allow `\u0000` in string values
+    bool int_as_real {false}; // Decode integer numbers as reals
+    bool eof_check {true};    // Only whitespaces are allowed after the top level value
+    std::size_t max_depth {2048};
+};
+
+/**
+ * Stage 2 of the native parser: walks the structural index and reports
+ * values to the @a Handler.
+ *
+ * Handler requirements (every method returns @c parse_errc::success to
+ * continue parsing or an error code to stop it):
+ *
+ *      parse_errc on_null ();
+ *      parse_errc on_bool (bool);
+ *      parse_errc on_integer (std::int64_t);
+ *      parse_errc on_real (double);
+ *      parse_errc on_string (char const *, std::size_t);
+ *      parse_errc on_key (char const *, std::size_t);
+ *      parse_errc on_begin_array ();
+ *      parse_errc on_end_array ();
+ *      parse_errc on_begin_object ();
+ *      parse_errc on_end_object ();
+ *
+ * String and key data passed to the handler are valid only during the call.
+ */
+template <typename Handler>
+class parser
+{
+    enum class state
+    {
+          object_begin
+        , object_field
+        , object_continue
+        , array_begin
+        , array_continue
+        , document_end
+    };
+
+    char const * _data {nullptr};
+    std::size_t _len {0};
+    index const & _index;
+    Handler & _h;
+    parse_options _opts;
+    std::size_t _i {0};               // Next position in the index
+    std::vector<bool> _scopes;        // `true` for object scope
+    std::string _buffer;              // Buffer for unescaped strings
+    std::size_t _error_pos {0};
+
+public:
+    parser (char const * data, std::size_t len, index const & idx, Handler & h
+        , parse_options const & opts = parse_options{})
+        : _data(data)
+        , _len(len)
+        , _index(idx)
+        , _h(h)
+        , _opts(opts)
+    {}
+
+    /**
+     * Byte offset of the error in the input.
+     */
+    std::size_t error_position () const noexcept
+    {
+        return _error_pos;
+    }
+
+    /**
+     * Calculates one-based line and column numbers for byte offset @a pos.
+     */
+    void location (std::size_t pos, int & line, int & column) const noexcept
+    {
+        line = 1;
+        column = 0;
+
+        for (std::size_t i = 0; i < pos && i < _len; i++) {
+            if (_data[i] == '\n') {
+                line++;
+                column = 0;
+            } else {
+                column++;
+            }
+        }
+    }
+
+    parse_errc parse ()
+    {
+        if (_index.size() == 0)
+            return fail(_len, parse_errc::premature_end);
+
+        if (!_opts.decode_any && _data[_index[0]] != '[' && _data[_index[0]] != '{')
+            return fail(_index[0], parse_errc::container_expected);
+
+        std::size_t i = 0;
+        auto rc = parse_value(i);
+
+        if (rc == parse_errc::success && _opts.eof_check && i < _index.size())
+            return fail(_index[i], parse_errc::end_of_input_expected);
+
+        return rc;
+    }
+
+    /**
+     * Parses a single value starting at the index position @a i (allows to
+     * parse values selected by the caller walking the index). On success
+     * @a i is set to the index position past the value.
+     */
+    parse_errc parse_value (std::size_t & i)
+    {
+        _i = i;
+        _scopes.clear();
+
+        auto rc = parse_next();
+
+        if (rc == parse_errc::success)
+            i = _i;
+
+        return rc;
+    }
+
+    /**
+     * Validates and decodes object key with opening quote at @a pos. Result
+     * points either into the input or into the internal buffer (valid until
+     * the next parsing call).
+     */
+    parse_errc key_at (std::size_t pos, char const *& s, std::size_t & n)
+    {
+        bool has_nul = false;
+        auto rc = parse_string(pos, s, n, has_nul);
+
+        if (rc != parse_errc::success)
+            return rc;
+
+        if (has_nul)
+            return fail(pos, parse_errc::null_byte_in_key);
+
+        return parse_errc::success;
+    }
+
+private:
+    // Parses value at the current index position
+    parse_errc parse_next ()
+    {
+        std::size_t pos = 0;
+
+        if (!next(pos))
+            return fail(_len, parse_errc::premature_end);
+
+        state st;
+        auto rc = begin_value(pos, st);
+
+        while (rc == parse_errc::success) {
+            switch (st) {
+                case state::object_begin:
+                    if (!next(pos))
+                        return fail(_len, parse_errc::premature_end);
+
+                    if (_data[pos] == '}') {
+                        rc = end_scope(pos, st);
+                    } else if (_data[pos] == '"') {
+                        rc = parse_key(pos);
+                        st = state::object_field;
+                    } else {
+                        return fail(pos, parse_errc::string_or_rbrace_expected);
+                    }
+
+                    break;
+
+                case state::object_field:
+                    if (!next(pos))
+                        return fail(_len, parse_errc::premature_end);
+
+                    if (_data[pos] != ':')
+                        return fail(pos, parse_errc::colon_expected);
+
+                    if (!next(pos))
+                        return fail(_len, parse_errc::premature_end);
+
+                    rc = begin_value(pos, st);
+                    break;
+
+                case state::object_continue:
+                    if (!next(pos))
+                        return fail(_len, parse_errc::premature_end);
+
+                    if (_data[pos] == ',') {
+                        if (!next(pos))
+                            return fail(_len, parse_errc::premature_end);
+
+                        if (_data[pos] != '"')
+                            return fail(pos, parse_errc::string_expected);
+
+                        rc = parse_key(pos);
+                        st = state::object_field;
+                    } else if (_data[pos] == '}') {
+                        rc = end_scope(pos, st);
+                    } else {
+                        return fail(pos, parse_errc::rbrace_expected);
+                    }
+
+                    break;
+
+                case state::array_begin:
+                    if (!next(pos))
+                        return fail(_len, parse_errc::premature_end);
+
+                    if (_data[pos] == ']')
+                        rc = end_scope(pos, st);
+                    else
+                        rc = begin_value(pos, st);
+
+                    break;
+
+                case state::array_continue:
+                    if (!next(pos))
+                        return fail(_len, parse_errc::premature_end);
+
+                    if (_data[pos] == ',') {
+                        if (!next(pos))
+                            return fail(_len, parse_errc::premature_end);
+
+                        rc = begin_value(pos, st);
+                    } else if (_data[pos] == ']') {
+                        rc = end_scope(pos, st);
+                    } else {
+                        return fail(pos, parse_errc::rbracket_expected);
+                    }
+
+                    break;
+
+                case state::document_end:
+                    return parse_errc::success;
+            }
+        }
+
+        return rc;
+    }
+
+
+    bool next (std::size_t & pos) noexcept
+    {
+        if (_i >= _index.size())
+            return false;
+
+        pos = _index[_i++];
+        return true;
+    }
+
+    parse_errc fail (std::size_t pos, parse_errc ec) noexcept
+    {
+        _error_pos = pos;
+        return ec;
+    }
+
+    parse_errc check (std::size_t pos, parse_errc ec) noexcept
+    {
+        if (ec != parse_errc::success)
+            _error_pos = pos;
+
+        return ec;
+    }
+
+    state state_after_value () const noexcept
+    {
+        if (_scopes.empty())
+            return state::document_end;
+
+        return _scopes.back() ? state::object_continue : state::array_continue;
+    }
+
+    parse_errc begin_value (std::size_t pos, state & st)
+    {
+        switch (_data[pos]) {
+            case '{':
+                if (_scopes.size() >= _opts.max_depth)
+                    return fail(pos, parse_errc::depth_exceeded);
+
+                _scopes.push_back(true);
+                st = state::object_begin;
+                return check(pos, _h.on_begin_object());
+
+            case '[':
+                if (_scopes.size() >= _opts.max_depth)
+                    return fail(pos, parse_errc::depth_exceeded);
+
+                _scopes.push_back(false);
+                st = state::array_begin;
+                return check(pos, _h.on_begin_array());
+
+            default:
+                st = state_after_value();
+                return parse_scalar(pos);
+        }
+    }
+
+    parse_errc end_scope (std::size_t pos, state & st)
+    {
+        auto is_object = _scopes.back();
+        _scopes.pop_back();
+        st = state_after_value();
+        return check(pos, is_object ? _h.on_end_object() : _h.on_end_array());
+    }
+
+    static bool is_boundary (char c) noexcept
+    {
+        switch (c) {
+            case ' ': case '\t': case '\n': case '\r':
+            case ',': case ':': case '[': case ']': case '{': case '}':
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    bool match_literal (std::size_t pos, char const * lit, std::size_t n) const noexcept
+    {
+        return _len - pos >= n
+            && std::memcmp(_data + pos, lit, n) == 0
+            && (pos + n == _len || is_boundary(_data[pos + n]));
+    }
+
+    parse_errc parse_scalar (std::size_t pos)
+    {
+        switch (_data[pos]) {
+            case '"': {
+                char const * s = nullptr;
+                std::size_t n = 0;
+                bool has_nul = false;
+                auto rc = parse_string(pos, s, n, has_nul);
+
+                if (rc != parse_errc::success)
+                    return rc;
+
+                return check(pos, _h.on_string(s, n));
+            }
+
+            case 't':
+                if (!match_literal(pos, "true", 4))
+                    return fail(pos, parse_errc::invalid_token);
+
+                return check(pos, _h.on_bool(true));
+
+            case 'f':
+                if (!match_literal(pos, "false", 5))
+                    return fail(pos, parse_errc::invalid_token);
+
+                return check(pos, _h.on_bool(false));
+
+            case 'n':
+                if (!match_literal(pos, "null", 4))
+                    return fail(pos, parse_errc::invalid_token);
+
+                return check(pos, _h.on_null());
+
+            case '-':
+            case '0': case '1': case '2': case '3': case '4':
+            case '5': case '6': case '7': case '8': case '9':
+                return parse_number(pos);
+
+            default:
+                return fail(pos, parse_errc::invalid_token);
+        }
+    }
+
+    parse_errc parse_key (std::size_t pos)
+    {
+        char const * s = nullptr;
+        std::size_t n = 0;
+        auto rc = key_at(pos, s, n);
+
+        if (rc != parse_errc::success)
+            return rc;
+
+        return check(pos, _h.on_key(s, n));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Numbers
+    ////////////////////////////////////////////////////////////////////////////
+    parse_errc parse_number (std::size_t pos)
+    {
+        char const * p = _data + pos;
+        char const * end = _data + _len;
+        number::decimal d;
+
+        if (!number::scan(p, end, d))
+            return fail(pos, parse_errc::invalid_token);
+
+        if (p != end && !is_boundary(*p))
+            return fail(pos, parse_errc::invalid_token);
+
+        if (d.is_integer && !_opts.int_as_real) {
+            auto max_abs = static_cast<std::uint64_t>((std::numeric_limits<std::int64_t>::max)());
+
+            if (d.integer_overflow)
+                return fail(pos, parse_errc::integer_overflow);
+
+            if (d.negative) {
+                if (d.integer > max_abs + 1)
+                    return fail(pos, parse_errc::integer_overflow);
+
+                return check(pos, _h.on_integer(static_cast<std::int64_t>(~d.integer + 1)));
+            }
+
+            if (d.integer > max_abs)
+                return fail(pos, parse_errc::integer_overflow);
+
+            return check(pos, _h.on_integer(static_cast<std::int64_t>(d.integer)));
+        }
+
+        double value = 0;
+        auto rc = number::to_double(d, value);
+
+        if (rc == number::conversion::inexact)
+            rc = number::strtod(_data + pos, p, value);
+
+        if (rc == number::conversion::overflow)
+            return fail(pos, parse_errc::real_overflow);
+
+        return check(pos, _h.on_real(value));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Strings
+    ////////////////////////////////////////////////////////////////////////////
+    // Checks eight bytes at once for quote, backslash, control and non-ASCII characters.
+    static bool is_plain_ascii8 (char const * p) noexcept
+    {
+        constexpr std::uint64_t ONES = 0x0101010101010101ULL;
+        constexpr std::uint64_t HIGH = 0x8080808080808080ULL;
+
+        std::uint64_t w;
+        std::memcpy(& w, p, sizeof(w));
+
+        auto has_zero = [] (std::uint64_t x) { return (x - ONES) & ~x & HIGH; };
+
+        auto special = has_zero(w ^ (ONES * '"'))
+            | has_zero(w ^ (ONES * '\\'))
+            | ((w - ONES * 0x20) & ~w & HIGH)
+            | (w & HIGH);
+
+        return special == 0;
+    }
+
+    // Returns pointer past the valid UTF-8 sequence starting at @a p or
+    // @c nullptr if sequence is invalid.
+    static char const * skip_utf8 (char const * p, char const * end) noexcept
+    {
+        auto u = [] (char c) { return static_cast<unsigned char>(c); };
+        auto c0 = u(*p);
+
+        std::size_t n = 0;
+        unsigned char lo = 0x80;
+        unsigned char hi = 0xBF;
+
+        if (c0 >= 0xC2 && c0 <= 0xDF) {
+            n = 1;
+        } else if (c0 >= 0xE0 && c0 <= 0xEF) {
+            n = 2;
+
+            if (c0 == 0xE0)
+                lo = 0xA0;        // Overlong
+            else if (c0 == 0xED)
+                hi = 0x9F;        // Surrogates
+        } else if (c0 >= 0xF0 && c0 <= 0xF4) {
+            n = 3;
+
+            if (c0 == 0xF0)
+                lo = 0x90;        // Overlong
+            else if (c0 == 0xF4)
+                hi = 0x8F;        // Above U+10FFFF
+        } else {
+            return nullptr;
+        }
+
+        if (static_cast<std::size_t>(end - p) <= n)
+            return nullptr;
+
+        if (u(p[1]) < lo || u(p[1]) > hi)
+            return nullptr;
+
+        for (std::size_t i = 2; i <= n; i++) {
+            if ((u(p[i]) & 0xC0) != 0x80)
+                return nullptr;
+        }
+
+        return p + n + 1;
+    }
+
+    static int hex_value (char c) noexcept
+    {
+        if (c >= '0' && c <= '9')
+            return c - '0';
+
+        if (c >= 'a' && c <= 'f')
+            return c - 'a' + 10;
+
+        if (c >= 'A' && c <= 'F')
+            return c - 'A' + 10;
+
+        return -1;
+    }
+
+    static bool read_hex4 (char const * p, char const * end, std::uint32_t & result) noexcept
+    {
+        if (end - p < 4)
+            return false;
+
+        result = 0;
+
+        for (int i = 0; i < 4; i++) {
+            auto h = hex_value(p[i]);
+
+            if (h < 0)
+                return false;
+
+            result = (result << 4) | static_cast<std::uint32_t>(h);
+        }
+
+        return true;
+    }
+
+    static void append_utf8 (std::string & s, std::uint32_t cp)
+    {
+        if (cp < 0x80) {
+            s.push_back(static_cast<char>(cp));
+        } else if (cp < 0x800) {
+            s.push_back(static_cast<char>(0xC0 | (cp >> 6)));
+            s.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+        } else if (cp < 0x10000) {
+            s.push_back(static_cast<char>(0xE0 | (cp >> 12)));
+            s.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+            s.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+        } else {
+            s.push_back(static_cast<char>(0xF0 | (cp >> 18)));
+            s.push_back(static_cast<char>(0x80 | ((cp >> 12) & 0x3F)));
+            s.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+            s.push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+        }
+    }
+
+    // Scans unescaped characters starting from @a p, stops at quote, backslash or end.
+    parse_errc scan_plain (char const *& p, char const * end)
+    {
+        for (;;) {
+            while (end - p >= 8 && is_plain_ascii8(p))
+                p += 8;
+
+            if (p == end)
+                return parse_errc::success;
+
+            auto c = static_cast<unsigned char>(*p);
+
+            if (c == '"' || c == '\\')
+                return parse_errc::success;
+
+            if (c < 0x20)
+                return fail(static_cast<std::size_t>(p - _data), parse_errc::control_character);
+
+            if (c >= 0x80) {
+                auto next = skip_utf8(p, end);
+
+                if (!next)
+                    return fail(static_cast<std::size_t>(p - _data), parse_errc::invalid_utf8);
+
+                p = next;
+            } else {
+                ++p;
+            }
+        }
+    }
+
+    /**
+     * Parses string started by quote at @a pos. Result points either into the
+     * input (no escapes) or into the internal buffer.
+     */
+    parse_errc parse_string (std::size_t pos, char const *& s, std::size_t & n, bool & has_nul)
+    {
+        char const * end = _data + _len;
+        char const * p = _data + pos + 1;
+        char const * start = p;
+
+        has_nul = false;
+
+        auto rc = scan_plain(p, end);
+
+        if (rc != parse_errc::success)
+            return rc;
+
+        if (p == end)
+            return fail(_len, parse_errc::premature_end);
+
+        if (*p == '"') {
+            s = start;
+            n = static_cast<std::size_t>(p - start);
+            return parse_errc::success;
+        }
+
+        _buffer.assign(start, p);
+
+        for (;;) {
+            if (p == end)
+                return fail(_len, parse_errc::premature_end);
+
+            if (*p == '"')
+                break;
+
+            // Backslash
+            auto escape_pos = static_cast<std::size_t>(p - _data);
+            ++p;
+
+            if (p == end)
+                return fail(_len, parse_errc::premature_end);
+
+            switch (*p++) {
+                case '"': _buffer.push_back('"'); break;
+                case '\\': _buffer.push_back('\\'); break;
+                case '/': _buffer.push_back('/'); break;
+                case 'b': _buffer.push_back('\b'); break;
+                case 'f': _buffer.push_back('\f'); break;
+                case 'n': _buffer.push_back('\n'); break;
+                case 'r': _buffer.push_back('\r'); break;
+                case 't': _buffer.push_back('\t'); break;
+                case 'u': {
+                    std::uint32_t cp = 0;
+
+                    if (!read_hex4(p, end, cp))
+                        return fail(escape_pos, parse_errc::invalid_escape);
+
+                    p += 4;
+
+                    if (cp >= 0xD800 && cp <= 0xDBFF) {
+                        std::uint32_t low = 0;
+
+                        if (end - p < 2 || p[0] != '\\' || p[1] != 'u' || !read_hex4(p + 2, end, low))
+                            return fail(escape_pos, parse_errc::invalid_unicode);
+
+                        if (low < 0xDC00 || low > 0xDFFF)
+                            return fail(escape_pos, parse_errc::invalid_unicode);
+
+                        p += 6;
+                        cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+                    } else if (cp >= 0xDC00 && cp <= 0xDFFF) {
+                        return fail(escape_pos, parse_errc::invalid_unicode);
+                    } else if (cp == 0) {
+                        if (!_opts.allow_nul)
+                            return fail(escape_pos, parse_errc::null_character);
+
+                        has_nul = true;
+                    }
+
+                    append_utf8(_buffer, cp);
+                    break;
+                }
+
+                default:
+                    return fail(escape_pos, parse_errc::invalid_escape);
+            }
+
+            auto run = p;
+            rc = scan_plain(p, end);
+
+            if (rc != parse_errc::success)
+                return rc;
+
+            _buffer.append(run, p);
+        }
+
+        s = _buffer.data();
+        n = _buffer.size();
+        return parse_errc::success;
+    }
+};
+
+}} // namespace jeyson::structural
@@ -0,0 +1,241 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `jeyson-lib`.
+//
+// Changelog:
+//      2026.10.15 Initial version.
+//      2026.10.16 Non-finite real numbers are rejected.
+////////////////////////////////////////////////////////////////////////////////
+#include "jeyson/writer.hpp"
+#include "jeyson/backend/jansson.hpp"
+#include "native_dumper.hpp"
+#include <pfs/assert.hpp>
+#include <pfs/i18n.hpp>
+#include <cmath>
+#include <jansson.h>
+
+namespace jeyson {
+
+using BACKEND = backend::jansson;
+using WRITER  = json_writer<BACKEND>;
+
+#define NATIVE(x) ((x)._ptr)
+
+#ifdef NDEBUG
+#   define WRITER_CHECK(x, msg)
+#else
+#   define WRITER_CHECK(x, msg) PFS__ASSERT(x, msg)
+#endif
+
+namespace {
+
+// Writes separator before the element at nesting level @a depth the same way
+// as `native_dump()` does
+void write_separator (bool & empty, std::size_t depth, std::size_t flags, std::string & out)
+{
+    if (empty) {
+        backend::native_dump_indent(static_cast<int>(depth), false, flags, out);
+        empty = false;
+    } else {
+        out.push_back(',');
+        backend::native_dump_indent(static_cast<int>(depth), true, flags, out);
+    }
+}
+
+} // namespace
+
+template <>
+void WRITER::init (json_writer_options const & opts)
+{
+    auto indent = opts.indent > 31 ? 31 : opts.indent;
+    auto precision = opts.precision > 31 ? 31 : opts.precision;
+
+    if (opts.compact)
+        _flags |= JSON_COMPACT;
+    else if (indent > 0)
+        _flags |= JSON_INDENT(indent);
+
+    if (precision > 0) {
+        _flags |= JSON_REAL_PRECISION(precision);
+        _precision = precision;
+    }
+}
+
+template <>
+void WRITER::before_value ()
+{
+    if (_levels.empty()) {
+        WRITER_CHECK(!_complete, "top-level value is already written");
+        return;
+    }
+
+    auto & top = _levels.back();
+
+    if (top.object) {
+        WRITER_CHECK(_key_pending, "object member key expected");
+        _key_pending = false;
+        return;
+    }
+
+    write_separator(top.empty, _levels.size(), _flags, *_out);
+}
+
+template <>
+void WRITER::after_value ()
+{
+    if (_levels.empty()) {
+        _complete = true;
+        flush();
+    } else if (_sink && _buffer.size() >= sink_threshold) {
+        flush();
+    }
+}
+
+template <>
+WRITER & WRITER::begin_object ()
+{
+    before_value();
+    _out->push_back('{');
+    _levels.push_back(level{true, true});
+    return *this;
+}
+
+template <>
+WRITER & WRITER::end_object ()
+{
+    WRITER_CHECK(!_levels.empty() && _levels.back().object, "end of object is unexpected");
+    WRITER_CHECK(!_key_pending, "object member value expected");
+
+    auto empty = _levels.back().empty;
+    _levels.pop_back();
+
+    if (!empty)
+        backend::native_dump_indent(static_cast<int>(_levels.size()), false, _flags, *_out);
+
+    _out->push_back('}');
+    after_value();
+    return *this;
+}
+
+template <>
+WRITER & WRITER::begin_array ()
+{
+    before_value();
+    _out->push_back('[');
+    _levels.push_back(level{false, true});
+    return *this;
+}
+
+template <>
+WRITER & WRITER::end_array ()
+{
+    WRITER_CHECK(!_levels.empty() && !_levels.back().object, "end of array is unexpected");
+
+    auto empty = _levels.back().empty;
+    _levels.pop_back();
+
+    if (!empty)
+        backend::native_dump_indent(static_cast<int>(_levels.size()), false, _flags, *_out);
+
+    _out->push_back(']');
+    after_value();
+    return *this;
+}
+
+template <>
+WRITER & WRITER::key (string_view k)
+{
+    WRITER_CHECK(!_levels.empty() && _levels.back().object, "key outside of object");
+    WRITER_CHECK(!_key_pending, "object member value expected");
+
+    write_separator(_levels.back().empty, _levels.size(), _flags, *_out);
+
+    backend::native_dump_string(k.data(), k.size(), *_out);
+
+    if (_flags & JSON_COMPACT)
+        _out->push_back(':');
+    else
+        _out->append(": ", 2);
+
+    _key_pending = true;
+    return *this;
+}
+
+template <>
+WRITER & WRITER::write_value (std::nullptr_t)
+{
+    before_value();
+    _out->append("null", 4);
+    after_value();
+    return *this;
+}
+
+template <>
+WRITER & WRITER::write_value (bool b)
+{
+    before_value();
+
+    if (b)
+        _out->append("true", 4);
+    else
+        _out->append("false", 5);
+
+    after_value();
+    return *this;
+}
+
+template <>
+WRITER & WRITER::write_value (std::intmax_t n)
+{
+    before_value();
+    backend::native_dump_integer(static_cast<json_int_t>(n), *_out);
+    after_value();
+    return *this;
+}
+
+template <>
+WRITER & WRITER::write_value (double n)
+{
+    // Not representable in JSON (rejected by the backend for values too)
+    if (!std::isfinite(n))
+        throw error {make_error_code(std::errc::invalid_argument), tr::_("attempt to write non-finite real number")};
+
+    before_value();
+    backend::native_dump_real(n, _precision, *_out);
+    after_value();
+    return *this;
+}
+
+template <>
+WRITER & WRITER::write_value (string_view s)
+{
+    before_value();
+    backend::native_dump_string(s.data(), s.size(), *_out);
+    after_value();
+    return *this;
+}
+
+template <>
+WRITER & WRITER::write_value (value_type const & j)
+{
+    if (!NATIVE(j))
+        throw error {make_error_code(std::errc::invalid_argument), tr::_("attempt to write null value")};
+
+    before_value();
+
+    auto rc = backend::native_dump(NATIVE(j), _flags | JSON_ENCODE_ANY, *_out
+        , static_cast<int>(_levels.size()));
+
+    if (rc < 0) {
+        throw error {
+              make_error_code(pfs::errc::backend_error)
+            , tr::_("serialize JSON value failure")
+        };
+    }
+
+    after_value();
+    return *this;
+}
+
+} // namespace jeyson
@@ -8,11 +8,13 @@
 //      2022.02.07 Initial version (jeyson-lib).
 //      2022.09.26 Refactored.
 //      2024.03.31 Refactored based on tests from nlohmann/json repository.
+//      2026.10.15 Added native backend tests.
 ////////////////////////////////////////////////////////////////////////////////
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #include "doctest.h"
 #include "pfs/jeyson/json.hpp"
 #include "pfs/jeyson/backend/jansson.hpp"
+#include "pfs/jeyson/backend/native.hpp"
 
 template <typename Backend>
 void run_iterator_tests ()
@@ -1294,3 +1296,7 @@ void run_iterator_tests ()
 TEST_CASE("Iterators") {
     run_iterator_tests<jeyson::backend::jansson>();
 }
+
+TEST_CASE("Iterators native backend") {
+    run_iterator_tests<jeyson::backend::native>();
+}
@@ -5,6 +5,27 @@
 //
 // Changelog:
 //      2022.02.07 Initial version.
+//      2026.10.15 Added native parser tests.
+//                 Added real numbers serialization tests.
+//                 Added arena-backed document tests.
+//                 Added object member write-through tests.
+//                 Added json_view tests.
+//                 Added copy-on-write tests.
+//                 Added instrumentation tests.
+//                 Added file parsing tests.
+//                 Added push parser tests.
+//                 Added JSON Lines parser tests.
+//                 Added parallel parsing tests.
+//                 Added lazy document tests.
+//                 Added streaming writer tests.
+//                 Added inline getter tests.
+//                 Added native backend tests.
+//      2026.10.16 Added tests for modification through references taken
+//                 before copying.
+//                 Added projection tests for duplicate keys.
+//                 Added streaming writer tests for non-finite numbers.
+//                 Added copy-on-write tests for at().
+//                 Added tests for document modification outside of the scope.
 ////////////////////////////////////////////////////////////////////////////////
 
 // Avoid warning C4996:
@@ -18,9 +39,19 @@
 #include "pfs/filesystem.hpp"
 #include "pfs/fmt.hpp"
 #include "pfs/jeyson/json.hpp"
+#include "pfs/jeyson/document.hpp"
 #include "pfs/jeyson/backend/jansson.hpp"
+#include "pfs/jeyson/backend/native.hpp"
+#include "pfs/jeyson/instrumentation.hpp"
+#include "pfs/jeyson/lazy.hpp"
+#include "pfs/jeyson/lines.hpp"
+#include "pfs/jeyson/push_parser.hpp"
+#include "pfs/jeyson/writer.hpp"
 #include "pfs/optional.hpp"
 #include <array>
+#include <fstream>
+#include <iterator>
+#include <limits>
 #include <vector>
 
 namespace fs = pfs::filesystem;
@@ -673,6 +704,40 @@ void run_access_tests ()
         CHECK(is_real(j["real"]));
         CHECK(is_string(j["string"]));
     }
+
+    // Write through references to object members
+    {
+        std::string long_key(300, 'k');
+        std::string nul_key {"a\0b", 3};
+
+        json j;
+        j["x"] = 1;
+        j[long_key] = 2;
+        j[nul_key] = 3;
+        j["y"] = 4;
+
+        CHECK_EQ(j.size(), 4);
+
+        auto rx = j["x"];
+        auto rx_copy = rx;
+        rx_copy = "one";
+        CHECK_EQ(jeyson::get<std::string>(j["x"]), std::string{"one"});
+
+        j.at(long_key) = 20;
+        CHECK_EQ(jeyson::get<int>(j[long_key]), 20);
+
+        j.at(nul_key) = 30;
+        CHECK_EQ(jeyson::get<int>(j[nul_key]), 30);
+        CHECK_FALSE(j.contains("a"));
+
+        for (auto it = j.begin(); it != j.end(); ++it) {
+            if (it.key() == "y")
+                it.ref() = 40;
+        }
+
+        CHECK_EQ(jeyson::get<int>(j["y"]), 40);
+        CHECK_EQ(j.size(), 4);
+    }
 }
 
 template <typename Backend, typename Int>
@@ -935,6 +1000,332 @@ void run_parsing_tests ()
         REQUIRE(code.is_string());
         REQUIRE_EQ(jeyson::get<std::string>(code), std::string{"ja"});
     }
+
+    // File parsing semantics: NUL characters are allowed, duplicate keys are rejected
+    {
+        auto path = fs::temp_directory_path() / pfs::utf8_decode_path("jeyson-parse-test.json");
+
+        auto write_file = [& path] (std::string const & content) {
+            std::ofstream ofs(pfs::utf8_encode_path(path), std::ios::binary | std::ios::trunc);
+            ofs << content;
+        };
+
+        write_file(R"({"a": "x\u0000y", "b": [1, 2]})");
+        auto j = json::parse(path);
+        REQUIRE(j);
+        CHECK_EQ(jeyson::get<std::string>(j["a"]), std::string{"x\0y", 3});
+        CHECK_EQ(j["b"].size(), 2);
+
+        write_file(R"({"a": 1, "a": 2})");
+        CHECK_THROWS(json::parse(path));
+
+        write_file("");
+        CHECK_THROWS(json::parse(path));
+
+        write_file("[1, 2");
+        CHECK_THROWS(json::parse(path));
+
+        fs::remove(path);
+        CHECK_THROWS(json::parse(path));
+    }
+}
+
+template <typename Backend>
+void run_view_tests ()
+{
+    using json = jeyson::json<Backend>;
+    using json_view = jeyson::json_view<Backend>;
+
+    static_assert(std::is_trivially_copyable<json_view>::value, "");
+
+    {
+        json_view v;
+        CHECK_FALSE(v);
+        CHECK_FALSE(v.is_null());
+        CHECK_EQ(v.size(), 0);
+        CHECK_FALSE(v[0]);
+        CHECK_FALSE(v["a"]);
+    }
+
+    {
+        auto j = json::parse(std::string{R"({"a":[1,2.5,"three",null,true],"b":{"c":"d"}})"});
+        json const & cj = j;
+        json_view v {cj};
+
+        REQUIRE(v);
+        CHECK(v.is_object());
+        CHECK_EQ(v.size(), 2);
+        CHECK(v.contains("a"));
+        CHECK_FALSE(v.contains("x"));
+        CHECK_FALSE(v["x"]);
+        CHECK_FALSE(v["a"]["x"]);
+        CHECK_FALSE(v["a"][5]);
+
+        auto a = v["a"];
+        CHECK(is_array(a));
+        CHECK_EQ(jeyson::get<int>(a[0]), 1);
+        CHECK_EQ(jeyson::get<double>(a[1]), 2.5);
+        CHECK_EQ(jeyson::get<std::string>(a.at(2)), std::string{"three"});
+        CHECK(is_null(a[3]));
+        CHECK(is_bool(a[4]));
+        CHECK_EQ(jeyson::get_or<int>(a[3], 42), 42);
+        CHECK_EQ(jeyson::get<std::string>(v.at("b").at("c")), std::string{"d"});
+        CHECK_EQ(to_string(v["b"]), std::string{R"({"c":"d"})"});
+
+        REQUIRE_THROWS(a.at(5));
+        REQUIRE_THROWS(v.at("x"));
+        REQUIRE_THROWS(a.at("x"));
+
+        // View of a reference
+        json_view vr {j["b"]};
+        CHECK_EQ(jeyson::get<std::string>(vr["c"]), std::string{"d"});
+
+        int sum = 0;
+
+        for (auto it = a.begin(); it != a.end(); ++it) {
+            if ((*it).is_integer())
+                sum += jeyson::get<int>(*it);
+        }
+
+        CHECK_EQ(sum, 1);
+
+        std::string keys;
+
+        for (auto it = v.begin(); it != v.end(); ++it)
+            keys += it.key();
+
+        CHECK_EQ(keys, std::string{"ab"});
+
+        auto rit = a.rbegin();
+        CHECK(is_bool(*rit));
+
+        json_view scalar = a[0];
+        auto sit = scalar.begin();
+        CHECK_EQ(jeyson::get<int>(*sit), 1);
+        CHECK(++sit == scalar.end());
+    }
+
+    // Getters read scalars inline, results are the same for values,
+    // references and views
+    {
+        using jeyson::get;
+        using jeyson::get_or;
+
+        auto j = json::parse(std::string{R"([true, false, -9223372036854775808, 2.5, "abc", "-17", [1, 2], {"a": 1}, null])"});
+        j.push_back(std::string{"4\0x", 3});
+
+        auto check = [] (json_view v, jeyson::json_ref<Backend> r, json const & x) {
+            bool s1 = false, s2 = false, s3 = false;
+
+            auto d1 = v.template get<double>(s1);
+            auto d2 = r.template get<double>(s2);
+            auto d3 = x.template get<double>(s3);
+            CHECK_EQ(s1, s2);
+            CHECK_EQ(s1, s3);
+
+            if (s1) {
+                CHECK_EQ(d1, d2);
+                CHECK_EQ(d1, d3);
+            }
+
+            auto n1 = v.template get<std::intmax_t>(s1);
+            auto n2 = r.template get<std::intmax_t>(s2);
+            CHECK_EQ(s1, s2);
+            CHECK_EQ(n1, n2);
+
+            CHECK_EQ(v.template get<bool>(s1), r.template get<bool>(s2));
+            CHECK_EQ(get_or<std::string>(v, "alt"), get_or<std::string>(r, "alt"));
+        };
+
+        json const & cj = j;
+
+        for (std::size_t i = 0; i < j.size(); i++)
+            check(json_view{cj}[i], j[i], json{j[i]});
+
+        json_view v {cj};
+        CHECK_EQ(get<bool>(v[0]), true);
+        CHECK_EQ(get<int>(v[1]), 0);
+        CHECK_EQ(get<std::intmax_t>(v[2]), (std::numeric_limits<std::intmax_t>::min)());
+        CHECK_EQ(get<double>(v[3]), 2.5);
+        CHECK_EQ(get<std::string>(v[4]), std::string{"abc"});
+        CHECK_EQ(get<int>(v[5]), -17);
+        CHECK_EQ(get<std::size_t>(v[6]), 2);
+        CHECK_EQ(get<std::size_t>(v[7]), 1);
+        CHECK_EQ(get_or<int>(v[8], 42), 42);
+        CHECK_EQ(get<std::string>(v[9]), std::string{"4\0x", 3});
+        CHECK_EQ(get_or<int>(v[10], 42), 42);
+        CHECK_EQ(get_or<int>(json{}, 42), 42);
+
+        bool success = true;
+        json{}.template get<int>(success);
+        CHECK_FALSE(success);
+    }
+}
+
+template <typename Backend>
+void run_copy_on_write_tests ()
+{
+    using json = jeyson::json<Backend>;
+
+    auto const source = std::string{R"({"a":{"b":[1,2,3]},"c":"text"})"};
+
+    // Modification of the copy
+    {
+        auto j1 = json::parse(source);
+        json j2 = j1;
+        json j3;
+        j3 = j1;
+
+        CHECK(j1 == j2);
+        CHECK(j1 == j3);
+
+        j2["a"]["b"][0] = 10;
+        j3.insert("d", 42);
+
+        CHECK_EQ(to_string(j1), source);
+        CHECK_EQ(to_string(j2), std::string{R"({"a":{"b":[10,2,3]},"c":"text"})"});
+        CHECK_EQ(to_string(j3), std::string{R"({"a":{"b":[1,2,3]},"c":"text","d":42})"});
+    }
+
+    // Modification of the original
+    {
+        auto j1 = json::parse(source);
+        json j2 = j1;
+
+        j1["c"] = "changed";
+
+        CHECK_EQ(jeyson::get<std::string>(j1["c"]), std::string{"changed"});
+        CHECK_EQ(to_string(j2), source);
+    }
+
+    // In-place modification of scalars
+    {
+        json j1 {42};
+        json j2 = j1;
+        j2 = 43;
+
+        json s1 {"hello"};
+        json s2 = s1;
+        s2 = "world";
+
+        CHECK_EQ(jeyson::get<int>(j1), 42);
+        CHECK_EQ(jeyson::get<int>(j2), 43);
+        CHECK_EQ(jeyson::get<std::string>(s1), std::string{"hello"});
+        CHECK_EQ(jeyson::get<std::string>(s2), std::string{"world"});
+    }
+
+    // Modification through iterators and moved copies
+    {
+        auto j1 = json::parse(std::string{"[1,2,3]"});
+        json j2 = j1;
+
+        for (auto it = j2.begin(); it != j2.end(); ++it)
+            it.ref() = 0;
+
+        json j3 = j1;
+        json container;
+        container.push_back(std::move(j3));
+        container[0].push_back(4);
+
+        CHECK_EQ(to_string(j1), std::string{"[1,2,3]"});
+        CHECK_EQ(to_string(j2), std::string{"[0,0,0]"});
+        CHECK_EQ(to_string(container), std::string{"[[1,2,3,4]]"});
+    }
+
+    // Modification through references and iterators taken before the copy
+    {
+        auto j1 = json::parse(std::string{R"({"x":1})"});
+        auto r = j1["x"];
+        json j2 = j1;
+        r = 5;
+
+        CHECK_EQ(to_string(j1), std::string{R"({"x":5})"});
+        CHECK_EQ(to_string(j2), std::string{R"({"x":1})"});
+
+        auto j3 = json::parse(std::string{"[1,2,3]"});
+        auto it = j3.begin();
+        json j4 = j3;
+        it.ref() = 42;
+
+        CHECK_EQ(to_string(j3), std::string{"[42,2,3]"});
+        CHECK_EQ(to_string(j4), std::string{"[1,2,3]"});
+
+        // Copy of the reassigned value
+        j3 = json::parse(std::string{"[7]"});
+        json j5 = j3;
+        j5[0] = 8;
+
+        CHECK_EQ(to_string(j3), std::string{"[7]"});
+        CHECK_EQ(to_string(j5), std::string{"[8]"});
+    }
+
+    // Last copy modifies the tree in place
+    {
+        auto j1 = json::parse(source);
+
+        {
+            json j2 = j1;
+        }
+
+        j1["c"] = 1;
+        CHECK_EQ(jeyson::get<int>(j1["c"]), 1);
+    }
+
+    // Deep copy
+    {
+        auto j1 = json::parse(source);
+        auto j2 = j1.deep_copy();
+
+        CHECK(j1 == j2);
+
+        j2["a"]["b"].push_back(4);
+
+        CHECK_EQ(to_string(j1), source);
+        CHECK_EQ(j2["a"]["b"].size(), 4);
+        CHECK_FALSE(json{}.deep_copy());
+    }
+}
+
+// Modification of copies through `at()`
+template <typename Backend>
+void run_copy_on_write_at_tests ()
+{
+    using json = jeyson::json<Backend>;
+
+    auto const source = std::string{R"({"k":1,"arr":[1]})"};
+
+    {
+        auto j1 = json::parse(source);
+        json j2 = j1;
+
+        j2.at("k") = 5;
+        j2.at("arr").push_back(2);
+        j2.at("arr").at(0) = 0;
+
+        CHECK_EQ(to_string(j1), source);
+        CHECK_EQ(to_string(j2), std::string{R"({"k":5,"arr":[0,2]})"});
+    }
+
+    // Reference taken before the copy
+    {
+        auto j1 = json::parse(source);
+        auto r = j1.at("k");
+        json j2 = j1;
+        r = 5;
+
+        CHECK_EQ(to_string(j1), std::string{R"({"k":5,"arr":[1]})"});
+        CHECK_EQ(to_string(j2), source);
+    }
+
+    // Constant access does not copy
+    {
+        auto const j1 = json::parse(source);
+        json j2 = j1;
+
+        CHECK_EQ(jeyson::get<int>(j1.at("k")), 1);
+        CHECK_EQ(jeyson::get<int>(j2.at("arr").at(0)), 1);
+        CHECK(j1 == j2);
+    }
 }
 
 template <typename Backend>
@@ -1034,6 +1425,1284 @@ void run_serializer_tests ()
 
     CHECK_EQ(text, R"({"app":{"font":{"family":"Roboto","pixelSize":14,"weight":50,"italic":true}},"messenger":{"font":{"family":"Roboto","pixelSize":14,"weight":50,"italic":true},"balloon":{"back":{"color":{"mine":"#5d90c2","opponent":"#e0e0e0"}},"fore":{"color":{"mine":"#f8f8f8","opponent":"#333333"}}}}})");
     //fmt::print("{}\n", text);
+
+    // Real numbers in shortest round-trip form
+    {
+        json r;
+        r.push_back(0.1);
+        r.push_back(100.0);
+        r.push_back(-0.0);
+        r.push_back(1e300);
+        r.push_back(1.5e-7);
+        r.push_back(123.456);
+        r.push_back(1e16);
+        r.push_back(1e17);
+        r.push_back(5e-324);
+
+        CHECK_EQ(to_string(r), std::string{"[0.1,100.0,-0.0,1e300,1.5e-7,123.456,10000000000000000.0,1e17,5e-324]"});
+    }
+
+    // Escaped strings
+    {
+        json e;
+        e.push_back("\"\\/\b\f\n\r\t\x01\x1F\x7F\xD0\x96");
+
+        CHECK_EQ(to_string(e), std::string{"[\"\\\"\\\\/\\b\\f\\n\\r\\t\\u0001\\u001F\x7F\xD0\x96\"]"});
+    }
+
+    // Save with indent and precision override
+    {
+        auto a = json::parse(std::string{R"({"a": [0.1, []], "b": null, "c": 1})"});
+
+        auto path = fs::temp_directory_path() / pfs::utf8_decode_path("jeyson-serializer-test.json");
+
+        auto read_file = [] (fs::path const & path) {
+            std::ifstream ifs(path, std::ios::binary);
+            return std::string{std::istreambuf_iterator<char>{ifs}, std::istreambuf_iterator<char>{}};
+        };
+
+        a.save(path);
+        CHECK_EQ(read_file(path), std::string{"{\n    \"a\": [\n        0.1,\n        []\n    ],\n    \"b\": null,\n    \"c\": 1\n}"});
+
+        a.save(path, true, 0, 17);
+        CHECK_EQ(read_file(path), std::string{R"({"a":[0.10000000000000001,[]],"b":null,"c":1})"});
+
+        a.save(path, false, 0);
+        CHECK_EQ(read_file(path), std::string{R"({"a": [0.1, []], "b": null, "c": 1})"});
+
+        fs::remove(path);
+    }
+
+    // Real numbers survive serialization round-trip
+    {
+        auto popts = doctest::getContextOptions();
+        auto program = fs::path(pfs::utf8_decode_path(popts->binary_name.c_str()));
+        auto program_dir = program.parent_path();
+
+        auto j1 = json::parse(program_dir / pfs::utf8_decode_path("data/canada.json"));
+        auto j2 = json::parse(to_string(j1));
+
+        CHECK(j1 == j2);
+    }
+}
+
+void run_native_parser_tests ()
+{
+    using backend = jeyson::backend::jansson;
+    using json = jeyson::json<backend>;
+
+    auto popts = doctest::getContextOptions();
+    auto program = fs::path(pfs::utf8_decode_path(popts->binary_name.c_str()));
+    auto program_dir = program.parent_path();
+
+    auto parse_builtin = [] (std::string const & s) {
+        backend::set_parser_engine(backend::parser_engine::jansson);
+        auto j = json::parse(s);
+        backend::set_parser_engine(backend::parser_engine::native);
+        return j;
+    };
+
+    auto parse_file_builtin = [] (fs::path const & path) {
+        backend::set_parser_engine(backend::parser_engine::jansson);
+        auto j = json::parse(path);
+        backend::set_parser_engine(backend::parser_engine::native);
+        return j;
+    };
+
+    backend::set_parser_engine(backend::parser_engine::native);
+    REQUIRE(backend::get_parser_engine() == backend::parser_engine::native);
+
+    run_parsing_tests<backend>();
+
+    // Same trees as built by jansson
+    for (char const * name: {"data/twitter.json", "data/canada.json", "data/citm_catalog.json"}) {
+        auto path = program_dir / pfs::utf8_decode_path(name);
+        CHECK_EQ(json::parse(path), parse_file_builtin(path));
+    }
+
+    for (auto const & entry: fs::directory_iterator(program_dir / pfs::utf8_decode_path("data/roundtrip"))) {
+        CHECK_EQ(json::parse(entry.path()), parse_file_builtin(entry.path()));
+    }
+
+    for (auto const & entry: fs::directory_iterator(program_dir / pfs::utf8_decode_path("data/jsonchecker"))) {
+        auto filename = pfs::utf8_encode_path(entry.path().filename());
+
+        if (filename.find("_EXCLUDE") != std::string::npos || entry.path().extension() != ".json")
+            continue;
+
+        if (filename.compare(0, 4, "pass") == 0) {
+            CHECK_EQ(json::parse(entry.path()), parse_file_builtin(entry.path()));
+        } else {
+            CHECK_THROWS(json::parse(entry.path()));
+        }
+    }
+
+    // Scalars at the top level
+    CHECK_EQ(jeyson::get<int>(json::parse(std::string{" 42 "})), 42);
+    CHECK_EQ(jeyson::get<std::string>(json::parse(std::string{"\"Hello\""})), std::string{"Hello"});
+    CHECK(json::parse(std::string{"null"}).is_null());
+    CHECK_THROWS(json::parse(std::string{""}));
+    CHECK_THROWS(json::parse(std::string{"   "}));
+    CHECK_THROWS(json::parse(std::string{"nul"}));
+    CHECK_THROWS(json::parse(std::string{"truex"}));
+    CHECK_THROWS(json::parse(std::string{"[1 2]"}));
+    CHECK_THROWS(json::parse(std::string{"[1,]"}));
+    CHECK_THROWS(json::parse(std::string{"{\"a\":1}}"}));
+
+    // Numbers
+    CHECK_EQ(jeyson::get<std::intmax_t>(json::parse(std::string{"9223372036854775807"}))
+        , (std::numeric_limits<std::intmax_t>::max)());
+    CHECK_EQ(jeyson::get<std::intmax_t>(json::parse(std::string{"-9223372036854775808"}))
+        , (std::numeric_limits<std::intmax_t>::min)());
+    CHECK_THROWS(json::parse(std::string{"9223372036854775808"}));
+    CHECK_THROWS(json::parse(std::string{"-9223372036854775809"}));
+    CHECK_THROWS(json::parse(std::string{"1e400"}));
+    CHECK_THROWS(json::parse(std::string{"-"}));
+    CHECK_THROWS(json::parse(std::string{"1."}));
+    CHECK_THROWS(json::parse(std::string{"01"}));
+
+    for (char const * s: {"0.1", "-2.5e-3", "1E22", "1e23", "123456789012345678901234567890.5"
+            , "2.2250738585072014e-308", "4.9e-324", "1.7976931348623157e308", "0.30000000000000004"
+            , "[3.14159, -0.0, 1e-7, 9007199254740993.0]"}) {
+        CHECK_EQ(json::parse(std::string{s}), parse_builtin(s));
+    }
+
+    // Strings
+    for (char const * s: {R"(["\"\\\/\b\f\n\r\t"])", R"(["\u00e9\u4e2d\ud83d\ude00"])"
+            , "[\"\xc3\xa9\xe4\xb8\xad\xf0\x9f\x98\x80\"]"}) {
+        CHECK_EQ(json::parse(std::string{s}), parse_builtin(s));
+    }
+
+    CHECK_THROWS(json::parse(std::string{R"(["\ud83d"])"}));
+    CHECK_THROWS(json::parse(std::string{R"(["\ude00"])"}));
+    CHECK_THROWS(json::parse(std::string{R"(["\u0000"])"}));
+    CHECK_THROWS(json::parse(std::string{R"(["\x"])"}));
+    CHECK_THROWS(json::parse(std::string{"[\"\xc0\xaf\"]"}));
+    CHECK_THROWS(json::parse(std::string{"[\"\xed\xa0\x80\"]"}));
+    CHECK_THROWS(json::parse(std::string{"[\"\x01\"]"}));
+    CHECK_THROWS(json::parse(std::string{"[\"unclosed]"}));
+
+    // Escapes and quotes crossing 64-byte block boundaries
+    for (std::size_t offset = 50; offset < 80; offset++) {
+        for (std::size_t backslashes = 1; backslashes < 5; backslashes++) {
+            std::string s = "[\"" + std::string(offset, 'x');
+
+            for (std::size_t i = 0; i < backslashes; i++)
+                s += "\\\\";
+
+            s += "\\\"{}[],:\", \"tail\"]";
+
+            auto j = json::parse(s);
+            REQUIRE_EQ(j.size(), 2);
+            CHECK_EQ(j, parse_builtin(s));
+        }
+    }
+
+    // Duplicate keys are rejected for files only (as by jansson)
+    CHECK_EQ(jeyson::get<int>(json::parse(std::string{R"({"a":1,"a":2})"})["a"]), 2);
+
+    // Depth limit
+    CHECK_NOTHROW(json::parse(std::string(2048, '[') + std::string(2048, ']')));
+    CHECK_THROWS(json::parse(std::string(2049, '[') + std::string(2049, ']')));
+
+    backend::set_parser_engine(backend::parser_engine::jansson);
+}
+
+void run_document_tests ()
+{
+    using backend = jeyson::backend::jansson;
+    using json = jeyson::json<backend>;
+    using json_document = jeyson::json_document<backend>;
+
+    auto popts = doctest::getContextOptions();
+    auto program = fs::path(pfs::utf8_decode_path(popts->binary_name.c_str()));
+    auto program_dir = program.parent_path();
+
+    for (auto name: {"data/twitter.json", "data/canada.json", "data/citm_catalog.json"}) {
+        auto path = program_dir / pfs::utf8_decode_path(name);
+        auto j = json::parse(path);
+        auto doc = json_document::parse(path);
+
+        REQUIRE(doc.root());
+        CHECK(doc.root() == j);
+
+        auto stats = doc.stats();
+        CHECK_GT(stats.used, 0);
+        CHECK_GE(stats.reserved, stats.used);
+        CHECK_GT(stats.allocations, 0);
+        CHECK_GE(stats.chunks, 1);
+
+        // Copy made outside the scope is independent of the document
+        json copy = doc.root();
+        doc = json_document{};
+        CHECK(copy == j);
+    }
+
+    {
+        auto doc = json_document::parse(std::string{R"({"a": [1, 2, 3], "b": "text"})"});
+        auto used = doc.stats().used;
+
+        {
+            json_document::scope s {doc};
+            doc.root()["a"].push_back(4);
+            doc.root()["c"] = "new text";
+            doc.root()["b"] = 3.14;
+        }
+
+        CHECK_GT(doc.stats().used, used);
+        CHECK_EQ(to_string(doc.root()), std::string{R"({"a":[1,2,3,4],"b":3.14,"c":"new text"})"});
+
+        auto doc2 = std::move(doc);
+        CHECK(!doc.root());
+        CHECK_EQ(doc.stats().reserved, 0);
+        CHECK_EQ(doc2.root()["a"].size(), 4);
+    }
+
+    // Document nodes can be modified in the document scope only
+    {
+        auto is_not_permitted = [] (auto f) {
+            try {
+                f();
+            } catch (jeyson::error const & ex) {
+                return ex.code() == std::make_error_code(std::errc::operation_not_permitted);
+            }
+
+            return false;
+        };
+
+        auto doc = json_document::parse(std::string{R"({"a": [1, 2, 3], "b": "text"})"});
+
+        CHECK(is_not_permitted([& doc] { doc.root()["a"].push_back(4); }));
+        CHECK(is_not_permitted([& doc] { doc.root()["a"][5]; }));
+        CHECK(is_not_permitted([& doc] { doc.root()["c"]; }));
+        CHECK(is_not_permitted([& doc] { doc.root().insert("c", json{1}); }));
+        CHECK(is_not_permitted([& doc] { doc.root()["b"] = 3.14; }));
+
+        {
+            auto other = json_document::parse(std::string{"{}"});
+            json_document::scope s {other};
+            CHECK(is_not_permitted([& doc] { doc.root()["a"].push_back(4); }));
+        }
+
+        // Reading is allowed
+        CHECK_EQ(doc.root()["a"].size(), 3);
+        CHECK_EQ(to_string(doc.root()), std::string{R"({"a":[1,2,3],"b":"text"})"});
+
+        // Value created outside of the scope is copied into the arena
+        json value {json::parse(std::string{"[4, 5]"})};
+        auto used = doc.stats().used;
+
+        {
+            json_document::scope s {doc};
+            doc.root()["a"].push_back(std::move(value));
+            doc.root().insert("c", json{"new text"});
+        }
+
+        CHECK_GT(doc.stats().used, used);
+        CHECK_EQ(to_string(doc.root()), std::string{R"({"a":[1,2,3,[4,5]],"b":"text","c":"new text"})"});
+    }
+
+    {
+        jeyson::error err;
+        auto doc = json_document::parse(std::string{"[1, 2"}, & err);
+        CHECK(!doc.root());
+        CHECK(err.code() != std::error_code{});
+    }
+
+    // Heap values are not affected
+    {
+        json j;
+        j["a"] = 1;
+        j["b"] = "text";
+        CHECK_EQ(to_string(j), std::string{R"({"a":1,"b":"text"})"});
+    }
+}
+
+#if JEYSON__INSTRUMENTATION_ENABLED
+void run_instrumentation_tests ()
+{
+    using backend = jeyson::backend::jansson;
+    using json = jeyson::json<backend>;
+    namespace instr = jeyson::instrumentation;
+
+    std::vector<instr::stats> records;
+
+    auto sink = [] (instr::stats const & record, void * user_data) {
+        static_cast<std::vector<instr::stats> *>(user_data)->push_back(record);
+    };
+
+    std::string source {R"({"a": [1, 2.5, "text"], "b": {"c": null, "d": true}})"};
+
+    // Calls of the thread are not recorded while instrumentation is disabled
+    CHECK(!instr::enabled());
+    json::parse(source);
+    CHECK_EQ(instr::thread_totals().calls, 0);
+
+    instr::enable(sink, & records);
+    REQUIRE(instr::enabled());
+
+    for (auto engine: {backend::parser_engine::jansson, backend::parser_engine::native}) {
+        backend::set_parser_engine(engine);
+        records.clear();
+        instr::reset_thread_totals();
+
+        auto j = json::parse(source);
+
+        REQUIRE_EQ(records.size(), 1);
+        auto const & r = records.back();
+        CHECK(r.op == instr::operation::parse);
+        CHECK_EQ(r.calls, 1);
+        CHECK_EQ(r.failures, 0);
+        CHECK_EQ(r.bytes_in, source.size());
+        CHECK_EQ(r.nulls, 1);
+        CHECK_EQ(r.booleans, 1);
+        CHECK_EQ(r.integers, 1);
+        CHECK_EQ(r.reals, 1);
+        CHECK_EQ(r.strings, 1);
+        CHECK_EQ(r.arrays, 1);
+        CHECK_EQ(r.objects, 2);
+        CHECK_EQ(r.nodes(), 8);
+        CHECK_EQ(r.max_depth, 2);
+        CHECK_GT(r.allocations, 0);
+        CHECK_GT(r.allocated_bytes, 0);
+        CHECK_GE(r.total_ns, r.elapsed(instr::phase::build));
+
+        if (engine == backend::parser_engine::native)
+            CHECK_GE(r.total_ns, r.elapsed(instr::phase::index) + r.elapsed(instr::phase::build));
+
+        auto s = to_string(j);
+
+        REQUIRE_EQ(records.size(), 2);
+        CHECK(records.back().op == instr::operation::to_string);
+        CHECK_EQ(records.back().bytes_out, s.size());
+        CHECK_EQ(records.back().nodes(), 8);
+
+        jeyson::error err;
+        json::parse(std::string{"[1, 2"}, & err);
+
+        REQUIRE_EQ(records.size(), 3);
+        CHECK_EQ(records.back().failures, 1);
+
+        auto totals = instr::thread_totals();
+        CHECK_EQ(totals.calls, 3);
+        CHECK_EQ(totals.failures, 1);
+        CHECK_EQ(totals.bytes_in, source.size() + 5);
+        CHECK_EQ(totals.bytes_out, s.size());
+        CHECK_EQ(totals.max_depth, 2);
+    }
+
+    backend::set_parser_engine(backend::parser_engine::jansson);
+
+    // Scalar root
+    {
+        records.clear();
+        json::parse(std::string{"42"});
+        REQUIRE_EQ(records.size(), 1);
+        CHECK_EQ(records.back().integers, 1);
+        CHECK_EQ(records.back().max_depth, 0);
+    }
+
+    instr::disable();
+    records.clear();
+    json::parse(source);
+    CHECK(records.empty());
+}
+#endif
+
+void run_push_parser_tests ()
+{
+    using backend = jeyson::backend::jansson;
+    using json = jeyson::json<backend>;
+    using json_push_parser = jeyson::json_push_parser<backend>;
+
+    std::vector<json> values;
+    json_push_parser parser {[& values] (json && j) { values.push_back(std::move(j)); }};
+
+    auto popts = doctest::getContextOptions();
+    auto program = fs::path(pfs::utf8_decode_path(popts->binary_name.c_str()));
+    auto program_dir = program.parent_path();
+
+    // Same trees as parsed from the whole text, for various chunk sizes
+    for (char const * name: {"data/twitter.json", "data/canada.json", "data/citm_catalog.json"}) {
+        std::ifstream ifs(pfs::utf8_encode_path(program_dir / pfs::utf8_decode_path(name)), std::ios::binary);
+        std::string content {std::istreambuf_iterator<char>{ifs}, std::istreambuf_iterator<char>{}};
+        auto expected = json::parse(content);
+
+        for (std::size_t chunk_size: {std::size_t{1}, std::size_t{7}, std::size_t{4096}, content.size()}) {
+            values.clear();
+            parser.reset();
+
+            bool success = true;
+
+            for (std::size_t pos = 0; pos < content.size() && success; pos += chunk_size)
+                success = parser.feed(content.data() + pos, (std::min)(chunk_size, content.size() - pos));
+
+            REQUIRE(success);
+            REQUIRE(parser.finish());
+            REQUIRE_EQ(values.size(), 1);
+            CHECK_EQ(values[0], expected);
+            CHECK_EQ(parser.offset(), content.size());
+        }
+    }
+
+    // Values are emitted as soon as they are closed
+    {
+        values.clear();
+        parser.reset();
+
+        parser.feed(jeyson::string_view{R"({"a": [1, "te)"});
+        CHECK(values.empty());
+        CHECK(parser.incomplete());
+
+        parser.feed(jeyson::string_view{R"(xt\n\u00e9\ud83d)"});
+        parser.feed(jeyson::string_view{R"(\ude00"]})"});
+        REQUIRE_EQ(values.size(), 1);
+        CHECK(!parser.incomplete());
+        CHECK_EQ(jeyson::get<std::string>(values[0]["a"][1]), std::string{"text\n\xc3\xa9\xf0\x9f\x98\x80"});
+
+        // Sequence of values (JSON Lines)
+        parser.feed(jeyson::string_view{"[1]\n{\"b\": true}\n\"s\"\nnull\n-1.5e"});
+        REQUIRE_EQ(values.size(), 5);
+        CHECK(values[4].is_null());
+
+        // Top-level number is completed by whitespace or by finish()
+        parser.feed(jeyson::string_view{"3"});
+        CHECK_EQ(values.size(), 5);
+        REQUIRE(parser.finish());
+        REQUIRE_EQ(values.size(), 6);
+        CHECK_EQ(jeyson::get<double>(values[5]), -1500.0);
+
+        parser.feed(jeyson::string_view{"42 "});
+        REQUIRE_EQ(values.size(), 7);
+        CHECK_EQ(jeyson::get<int>(values[6]), 42);
+    }
+
+    // Errors with byte offsets
+    for (auto const & item: std::vector<std::pair<std::string, std::size_t>> {
+              {"[1, 2}", 5}
+            , {"{\"a\" 1}", 5}
+            , {"[tru", 4}
+            , {"[trux]", 4}
+            , {"[\"\\x\"]", 3}
+            , {"[\"\\u0000\"]", 8}
+            , {"[\"\\ud83d\"]", 8}
+            , {"[\"\xc0\xaf\"]", 4}
+            , {"[01]", 1}
+            , {"9223372036854775808 ", 0}
+            , {"true1", 4}
+            , {"{\"a\":[", 6}}) {
+        jeyson::error err;
+        parser.reset();
+
+        // Feed by one byte
+        bool success = true;
+
+        for (std::size_t i = 0; i < item.first.size() && success; i++)
+            success = parser.feed(item.first.data() + i, 1, & err);
+
+        if (success)
+            success = parser.finish(& err);
+
+        CHECK_MESSAGE(!success, item.first);
+        CHECK(parser.failed());
+        CHECK_MESSAGE(parser.error_offset() == item.second, item.first);
+        CHECK(err.code() != std::error_code{});
+
+        // Parser rejects input until reset
+        CHECK_THROWS(parser.feed(jeyson::string_view{"1 "}));
+    }
+
+    // Depth limit
+    {
+        parser.reset();
+        CHECK(parser.feed(std::string(2048, '[') + std::string(2048, ']')));
+        parser.reset();
+        CHECK_THROWS(parser.feed(std::string(2049, '[')));
+    }
+
+    // Parser can be moved
+    {
+        values.clear();
+        parser.reset();
+        parser.feed(jeyson::string_view{"[1,"});
+
+        auto other = std::move(parser);
+        other.feed(jeyson::string_view{"2]"});
+        REQUIRE_EQ(values.size(), 1);
+        CHECK_EQ(values[0].size(), 2);
+    }
+}
+
+void run_lines_tests ()
+{
+    using backend = jeyson::backend::jansson;
+    using json = jeyson::json<backend>;
+    using json_line = jeyson::json_line<backend>;
+
+    auto popts = doctest::getContextOptions();
+    auto program = fs::path(pfs::utf8_decode_path(popts->binary_name.c_str()));
+    auto program_dir = program.parent_path();
+
+    std::ifstream ifs(pfs::utf8_encode_path(program_dir / pfs::utf8_decode_path("data/twitter.json")), std::ios::binary);
+    std::string content {std::istreambuf_iterator<char>{ifs}, std::istreambuf_iterator<char>{}};
+    auto statuses = json::parse(content)["statuses"];
+
+    // One status per line, every tenth line is broken, blank lines between
+    std::string input;
+    std::vector<json> expected;
+
+    for (std::size_t i = 0; i < 500; i++) {
+        auto status = statuses[i % statuses.size()];
+
+        if (i % 10 == 5) {
+            input += "{\"broken\": \n";
+        } else {
+            input += to_string(status) + (i % 3 == 0 ? "\r\n" : "\n");
+            expected.push_back(json{status});
+        }
+
+        if (i % 7 == 0)
+            input += "  \n";
+    }
+
+    for (std::size_t threads: {std::size_t{1}, std::size_t{4}, std::size_t{0}}) {
+        jeyson::parse_lines_options opts;
+        opts.threads = threads;
+        opts.batch_size = 4096;
+
+        auto lines = jeyson::parse_lines<backend>(input, opts);
+
+        REQUIRE_EQ(lines.size(), 500);
+
+        std::size_t k = 0;
+        std::size_t prev_line = 0;
+
+        for (std::size_t i = 0; i < lines.size(); i++) {
+            auto const & line = lines[i];
+
+            CHECK_GT(line.line, prev_line);
+            prev_line = line.line;
+
+            if (i % 10 == 5) {
+                CHECK(!line.ok());
+                CHECK(!line.value);
+                CHECK_EQ(input.compare(line.offset, 11, "{\"broken\": "), 0);
+            } else {
+                REQUIRE(line.ok());
+                CHECK_EQ(line.value, expected[k++]);
+            }
+        }
+    }
+
+    // Line numbers and offsets
+    {
+        auto lines = jeyson::parse_lines<backend>(std::string{"1\n\n[2,\n\"3\""});
+
+        REQUIRE_EQ(lines.size(), 3);
+        CHECK_EQ(lines[0].line, 1);
+        CHECK_EQ(lines[0].offset, 0);
+        CHECK_EQ(lines[1].line, 3);
+        CHECK_EQ(lines[1].offset, 3);
+        CHECK(!lines[1].ok());
+        CHECK_EQ(lines[2].line, 4);
+        CHECK_EQ(lines[2].offset, 7);
+        CHECK_EQ(jeyson::get<std::string>(lines[2].value), std::string{"3"});
+    }
+
+    // Ordered callback, exception from callback stops parsing
+    {
+        jeyson::parse_lines_options opts;
+        opts.threads = 4;
+        opts.batch_size = 1;
+
+        std::size_t count = 0;
+        std::size_t prev_line = 0;
+
+        CHECK_THROWS_AS(jeyson::parse_lines<backend>(input, [& count, & prev_line] (json_line && line) {
+            if (++count == 100)
+                throw std::runtime_error{"stop"};
+
+            CHECK_GT(line.line, prev_line);
+            prev_line = line.line;
+        }, opts), std::runtime_error);
+
+        CHECK_EQ(count, 100);
+    }
+
+    // File
+    {
+        auto path = fs::temp_directory_path() / pfs::utf8_decode_path("jeyson-lines-test.jsonl");
+
+        {
+            std::ofstream ofs(pfs::utf8_encode_path(path), std::ios::binary | std::ios::trunc);
+            ofs << input;
+        }
+
+        auto lines = jeyson::parse_lines<backend>(path);
+        CHECK_EQ(lines.size(), 500);
+        fs::remove(path);
+
+        jeyson::error err;
+        lines = jeyson::parse_lines<backend>(path, jeyson::parse_lines_options{}, & err);
+        CHECK(lines.empty());
+        CHECK(err.code() != std::error_code{});
+    }
+}
+
+void run_parallel_parsing_tests ()
+{
+    using backend = jeyson::backend::jansson;
+    using json = jeyson::json<backend>;
+
+    auto popts = doctest::getContextOptions();
+    auto program = fs::path(pfs::utf8_decode_path(popts->binary_name.c_str()));
+    auto program_dir = program.parent_path();
+
+    std::ifstream ifs(pfs::utf8_encode_path(program_dir / pfs::utf8_decode_path("data/twitter.json")), std::ios::binary);
+    std::string content {std::istreambuf_iterator<char>{ifs}, std::istreambuf_iterator<char>{}};
+    auto statuses = json::parse(content)["statuses"];
+
+    // Elements of different kinds, strings contain structural characters
+    std::string input = "[\n";
+
+    for (std::size_t i = 0; i < 300; i++) {
+        if (i > 0)
+            input += i % 2 ? ",\n" : " , ";
+
+        switch (i % 5) {
+            case 0: input += to_string(statuses[i % statuses.size()]); break;
+            case 1: input += std::to_string(i); break;
+            case 2: input += "\"[\\\"],{}\""; break;
+            case 3: input += "[[1, [2, 3]], {\"a,\": [null, true]}]"; break;
+            default: input += "null"; break;
+        }
+    }
+
+    input += "\n] \n";
+
+    auto saved_engine = backend::get_parser_engine();
+    auto saved_parallel = backend::get_parallel_parsing();
+
+    for (auto engine: {backend::parser_engine::jansson, backend::parser_engine::native}) {
+        backend::set_parser_engine(engine);
+        backend::set_parallel_parsing(backend::parallel_parsing{});
+
+        auto expected = json::parse(input);
+        REQUIRE_EQ(expected.size(), 300);
+
+        std::vector<std::string> invalid_inputs {
+              "[1,,2]"
+            , "[,1,2]"
+            , "[1,2,]"
+            , "[1,2] 3"
+            , "[1,2]]"
+            , "[1,{\"a\":2,},3]"
+            , "[1,[2,3}]"
+            , "[1,\"2,3]"
+            , "[1,2"
+        };
+
+        std::vector<std::string> expected_errors;
+
+        for (auto const & s: invalid_inputs) {
+            jeyson::error err;
+            json::parse(s, & err);
+            REQUIRE(err.code() != std::error_code{});
+            expected_errors.push_back(err.what());
+        }
+
+        for (std::size_t threads: {std::size_t{2}, std::size_t{3}, std::size_t{0}}) {
+            backend::parallel_parsing settings;
+            settings.threshold = 1;
+            settings.threads = threads;
+            backend::set_parallel_parsing(settings);
+
+            CHECK_EQ(json::parse(input), expected);
+
+            // Root is not an array
+            CHECK_EQ(json::parse(std::string{"{\"a\": [1, 2]}"}), json::parse(std::string{"{\"a\": [1, 2]}"}));
+            CHECK_EQ(json::parse(std::string{"[]"}).size(), 0);
+            CHECK_EQ(json::parse(std::string{"[1]"}).size(), 1);
+            CHECK_EQ(jeyson::get<std::string>(json::parse(std::string{"\"[1,2]\""})), std::string{"[1,2]"});
+
+            // Errors are reported as by serial parser
+            for (std::size_t i = 0; i < invalid_inputs.size(); i++) {
+                jeyson::error err;
+                auto j = json::parse(invalid_inputs[i], & err);
+                CHECK(!j);
+                CHECK_EQ(std::string{err.what()}, expected_errors[i]);
+            }
+
+            // Parsing inside a document scope is serial
+            auto doc = jeyson::json_document<backend>::parse(input);
+            CHECK_EQ(doc.root(), expected);
+
+            // File
+            auto path = fs::temp_directory_path() / pfs::utf8_decode_path("jeyson-parallel-test.json");
+
+            {
+                std::ofstream ofs(pfs::utf8_encode_path(path), std::ios::binary | std::ios::trunc);
+                ofs << input;
+            }
+
+            CHECK_EQ(json::parse(path), expected);
+
+            {
+                std::ofstream ofs(pfs::utf8_encode_path(path), std::ios::binary | std::ios::trunc);
+                ofs << "[1, {\"a\": 2, \"a\": 3}, 4]";
+            }
+
+            jeyson::error err;
+            CHECK(!json::parse(path, & err));
+            CHECK(err.code() != std::error_code{});
+
+            fs::remove(path);
+        }
+
+        // Input is smaller than the threshold
+        backend::parallel_parsing settings;
+        settings.threshold = input.size() + 1;
+        settings.threads = 4;
+        backend::set_parallel_parsing(settings);
+
+        CHECK_EQ(json::parse(input), expected);
+        CHECK_EQ(backend::get_parallel_parsing().threshold, input.size() + 1);
+        CHECK_EQ(backend::get_parallel_parsing().threads, 4);
+    }
+
+    backend::set_parser_engine(saved_engine);
+    backend::set_parallel_parsing(saved_parallel);
+}
+
+void run_lazy_tests ()
+{
+    using backend = jeyson::backend::jansson;
+    using json = jeyson::json<backend>;
+    using lazy_document = jeyson::lazy_document<backend>;
+    using lazy_value = jeyson::lazy_value<backend>;
+
+    auto popts = doctest::getContextOptions();
+    auto program = fs::path(pfs::utf8_decode_path(popts->binary_name.c_str()));
+    auto program_dir = program.parent_path();
+    auto path = program_dir / pfs::utf8_decode_path("data/twitter.json");
+
+    std::ifstream ifs(pfs::utf8_encode_path(path), std::ios::binary);
+    std::string content {std::istreambuf_iterator<char>{ifs}, std::istreambuf_iterator<char>{}};
+    auto expected = json::parse(content);
+
+    // Materialization
+    {
+        auto doc = lazy_document::parse(content);
+        REQUIRE(doc.root());
+        CHECK_GT(doc.tape_size(), 0);
+        CHECK_EQ(doc.to_json(), expected);
+
+        auto file_doc = lazy_document::parse(path);
+        CHECK_EQ(file_doc.to_json(), expected);
+
+        auto moved_doc = lazy_document::parse(std::string{content});
+        CHECK_EQ(moved_doc.to_json(), expected);
+    }
+
+    // Read access is the same as for `json`
+    {
+        auto doc = lazy_document::parse(content);
+        auto root = doc.root();
+        auto statuses = root["statuses"];
+
+        REQUIRE(statuses.is_array());
+        REQUIRE_EQ(statuses.size(), expected["statuses"].size());
+        CHECK(root.contains("search_metadata"));
+        CHECK_FALSE(root.contains("unknown"));
+        CHECK_FALSE(root["unknown"]);
+        CHECK_FALSE(statuses[statuses.size()]);
+        CHECK_THROWS_AS(statuses.at(statuses.size()), jeyson::error);
+        CHECK_THROWS_AS(statuses.at("id"), jeyson::error);
+        CHECK_THROWS_AS(root.at("unknown"), jeyson::error);
+
+        bool ok = true;
+
+        for (std::size_t i = 0; i < statuses.size(); i++) {
+            auto status = statuses[i];
+            auto estatus = expected["statuses"][i];
+
+            ok = ok && jeyson::get<std::intmax_t>(status["id"]) == jeyson::get<std::intmax_t>(estatus["id"]);
+            ok = ok && jeyson::get<std::string>(status["text"]) == jeyson::get<std::string>(estatus["text"]);
+            ok = ok && jeyson::get<std::string>(status.at("user").at("screen_name"))
+                == jeyson::get<std::string>(estatus["user"]["screen_name"]);
+            ok = ok && status["favorited"].is_bool() && jeyson::get<bool>(status["favorited"]) == jeyson::get<bool>(estatus["favorited"]);
+            ok = ok && status["in_reply_to_status_id"].is_null() == estatus["in_reply_to_status_id"].is_null();
+            ok = ok && status.size() == estatus.size();
+            ok = ok && status.to_json() == json{estatus};
+        }
+
+        CHECK(ok);
+
+        // Iteration
+        std::size_t count = 0;
+
+        for (auto it = statuses.begin(); it != statuses.end(); ++it)
+            count++;
+
+        CHECK_EQ(count, statuses.size());
+
+        auto metadata = root["search_metadata"];
+        auto emetadata = expected["search_metadata"];
+        count = 0;
+
+        for (auto it = metadata.begin(); it != metadata.end(); ++it) {
+            CHECK_EQ((*it).to_json(), json{emetadata[it.key()]});
+            count++;
+        }
+
+        CHECK_EQ(count, emetadata.size());
+        CHECK_THROWS_AS(statuses.begin().key(), jeyson::error);
+        CHECK_THROWS_AS(*metadata.end(), jeyson::error);
+    }
+
+    // Scalars, escapes, duplicate keys
+    {
+        auto doc = lazy_document::parse(std::string{R"({"a\"b": "x\u00e9\ny", "n": -12, "r": 2.5e-3, "t": true,)"
+            R"( "e": [], "o": {}, "d": 1, "d": 2, "s": "plain"})"});
+        auto root = doc.root();
+
+        REQUIRE(root.is_object());
+        CHECK_EQ(root.size(), 9);
+        CHECK_EQ(jeyson::get<std::string>(root["a\"b"]), std::string{"x\xc3\xa9\ny"});
+        CHECK_EQ(jeyson::get<std::intmax_t>(root["n"]), -12);
+        CHECK_EQ(jeyson::get<int>(root["n"]), -12);
+        CHECK(root["r"].is_real());
+        CHECK_EQ(jeyson::get<double>(root["r"]), 2.5e-3);
+        CHECK(jeyson::get<bool>(root["t"]));
+        CHECK(root["e"].is_array());
+        CHECK(root["e"].empty());
+        CHECK(root["e"].begin() == root["e"].end());
+        CHECK(root["o"].is_object());
+        CHECK_EQ(jeyson::get<int>(root["d"]), 2);
+        CHECK_EQ(jeyson::get<std::string>(root["s"]), std::string{"plain"});
+        CHECK_EQ(jeyson::get_or<int>(root["s"], 42), 42);
+        CHECK_EQ(jeyson::get_or<int>(root["missing"], 42), 42);
+        CHECK_EQ(doc.to_json(), json::parse(std::string{R"({"a\"b": "x\u00e9\ny", "n": -12, "r": 2.5e-3, "t": true,)"
+            R"( "e": [], "o": {}, "d": 2, "s": "plain"})"}));
+
+        auto scalar = lazy_document::parse(std::string{"\"text\""});
+        CHECK(scalar.root().is_string());
+        CHECK_EQ(scalar.root().size(), 1);
+        CHECK_EQ(jeyson::get<std::string>(*scalar.root().begin()), std::string{"text"});
+        CHECK_EQ(to_string(scalar.root()), std::string{"\"text\""});
+    }
+
+    // Errors are the same as for `json::parse()` with the native engine
+    {
+        auto saved_engine = backend::get_parser_engine();
+        backend::set_parser_engine(backend::parser_engine::native);
+
+        for (std::string s: {"", "[1, 2", "{\"a\" 1}", "[\"\\u0000\"]", "[1] 2", "[01]", "\"\\x\""}) {
+            jeyson::error expected_err;
+            json::parse(s, & expected_err);
+
+            jeyson::error err;
+            auto doc = lazy_document::parse(s, & err);
+
+            CHECK_FALSE(doc.root());
+            CHECK_EQ(std::string{err.what()}, std::string{expected_err.what()});
+        }
+
+        CHECK_THROWS_AS(lazy_document::parse(std::string{"[1,]"}), jeyson::error);
+
+        jeyson::error err;
+        lazy_document::parse(program_dir / pfs::utf8_decode_path("data/not-exists.json"), & err);
+        CHECK(err.code() != std::error_code{});
+
+        backend::set_parser_engine(saved_engine);
+    }
+
+    // Invalid value
+    {
+        lazy_document doc;
+        lazy_value v = doc.root();
+
+        CHECK_FALSE(v);
+        CHECK_FALSE(v.is_null());
+        CHECK_EQ(v.size(), 0);
+        CHECK_FALSE(v.to_json());
+        CHECK_THROWS_AS(v.at(0), jeyson::error);
+    }
+}
+
+void run_projection_tests ()
+{
+    using backend = jeyson::backend::jansson;
+    using json = jeyson::json<backend>;
+
+    auto popts = doctest::getContextOptions();
+    auto program = fs::path(pfs::utf8_decode_path(popts->binary_name.c_str()));
+    auto program_dir = program.parent_path();
+    auto path = program_dir / pfs::utf8_decode_path("data/twitter.json");
+
+    std::ifstream ifs(pfs::utf8_encode_path(path), std::ios::binary);
+    std::string content {std::istreambuf_iterator<char>{ifs}, std::istreambuf_iterator<char>{}};
+    auto expected = json::parse(content);
+
+    // Wildcard path
+    {
+        auto j = json::parse(content, {"/statuses/*/user/screen_name", "/search_metadata/count"});
+        auto file_j = json::parse(path, {"/statuses/*/user/screen_name", "/search_metadata/count"});
+
+        REQUIRE(j.is_object());
+        CHECK_EQ(j.size(), 2);
+        CHECK_EQ(j["search_metadata"].size(), 1);
+        CHECK_EQ(j["search_metadata"]["count"], expected["search_metadata"]["count"]);
+        REQUIRE_EQ(j["statuses"].size(), expected["statuses"].size());
+
+        bool ok = true;
+
+        for (std::size_t i = 0; i < j["statuses"].size(); i++) {
+            auto status = j["statuses"][i];
+            ok = ok && status.size() == 1 && status["user"].size() == 1;
+            ok = ok && status["user"]["screen_name"] == expected["statuses"][i]["user"]["screen_name"];
+        }
+
+        CHECK(ok);
+        CHECK_EQ(file_j, j);
+    }
+
+    // Empty pointer selects the whole document
+    CHECK_EQ(json::parse(content, {""}), expected);
+    CHECK_EQ(json::parse(content, {"/statuses", ""}), expected);
+
+    // Indices, escaped tokens, compacted arrays
+    {
+        std::string source {R"({"a/b": 1, "m~n": [10, {"x": "y"}, 30], "arr": [[1, 2], [3], [4, 5, 6]],)"
+            R"( "0": "zero", "skip": {"deep": [{"q": "\u0041\"]"}]}})"};
+
+        CHECK_EQ(json::parse(source, {"/a~1b"}), json::parse(std::string{R"({"a/b": 1})"}));
+        CHECK_EQ(json::parse(source, {"/m~0n/1/x"}), json::parse(std::string{R"({"m~n": [{"x": "y"}]})"}));
+        CHECK_EQ(json::parse(source, {"/m~0n/2", "/m~0n/0"}), json::parse(std::string{R"({"m~n": [10, 30]})"}));
+        CHECK_EQ(json::parse(source, {"/arr/*/1"}), json::parse(std::string{R"({"arr": [[2], [5]]})"}));
+        CHECK_EQ(json::parse(source, {"/0"}), json::parse(std::string{R"({"0": "zero"})"}));
+        CHECK_EQ(json::parse(source, {"/missing", "/m~0n/5"}), json::parse(std::string{"{}"}));
+        CHECK_EQ(json::parse(source, {"/skip/deep/0/q"})["skip"]["deep"][0]["q"], json{"A\"]"});
+        CHECK_EQ(json::parse(source, std::vector<std::string>{}), json::parse(std::string{"{}"}));
+        CHECK_EQ(json::parse(std::string{"[1, 2]"}, {"/x"}), json::parse(std::string{"[]"}));
+        CHECK(json::parse(std::string{"42"}, {"/x"}).is_null());
+    }
+
+    // Last of duplicate keys wins as in full parsing
+    {
+        std::string source {R"({"a": {"b": 1}, "a": {"c": 2}, "d": 1, "d": 2})"};
+
+        CHECK_EQ(json::parse(source, {"/a/b"}), json::parse(std::string{"{}"}));
+        CHECK_EQ(json::parse(source, {"/a/c"}), json::parse(std::string{R"({"a": {"c": 2}})"}));
+        CHECK_EQ(json::parse(source, {"/d"}), json::parse(std::string{R"({"d": 2})"}));
+    }
+
+    // Errors are the same as for full parsing with the native engine
+    {
+        auto saved_engine = backend::get_parser_engine();
+        backend::set_parser_engine(backend::parser_engine::native);
+
+        for (std::string s: {"", "{\"a\": 1", "{\"a\" 1}", "{\"a\": 1 \"b\": 2}", "[1] 2", "{1: 2}", "{\"a\": [01]}"}) {
+            jeyson::error expected_err;
+            json::parse(s, & expected_err);
+
+            jeyson::error err;
+            auto j = json::parse(s, {"/a"}, & err);
+
+            CHECK_FALSE(j);
+            CHECK_EQ(std::string{err.what()}, std::string{expected_err.what()});
+        }
+
+        backend::set_parser_engine(saved_engine);
+
+        // Skipped values are checked for bracket balance only
+        CHECK(json::parse(std::string{R"({"a": 1, "b": [01]})"}, {"/a"}));
+        CHECK_THROWS_AS(json::parse(std::string{R"({"a": 1, "b": [1})"}, {"/a"}), jeyson::error);
+    }
+
+    // Invalid pointers
+    {
+        jeyson::error err;
+        json::parse(content, {"statuses"}, & err);
+        CHECK_EQ(err.code(), std::make_error_code(std::errc::invalid_argument));
+
+        CHECK_THROWS_AS(json::parse(content, {"/a~2"}), jeyson::error);
+        CHECK_THROWS_AS(json::parse(content, {"/a~"}), jeyson::error);
+    }
+}
+
+struct writer_point
+{
+    int x;
+    int y;
+};
+
+struct writer_id
+{
+    std::uint32_t value;
+};
+
+namespace jeyson {
+
+template <>
+struct encoder<writer_point>
+{
+    json<backend::jansson> operator () (writer_point const & p) const
+    {
+        json<backend::jansson> result;
+        result["x"] = p.x;
+        result["y"] = p.y;
+        return result;
+    }
+};
+
+template <>
+struct encoder<writer_id>
+{
+    std::string operator () (writer_id const & id) const
+    {
+        return "id-" + std::to_string(id.value);
+    }
+};
+
+} // namespace jeyson
+
+void run_writer_tests ()
+{
+    using backend = jeyson::backend::jansson;
+    using json = jeyson::json<backend>;
+    using writer = jeyson::json_writer<backend>;
+
+    auto pretty = [] (int indent) {
+        jeyson::json_writer_options opts;
+        opts.compact = false;
+        opts.indent = indent;
+        return opts;
+    };
+
+    // Same output as for the tree built with `insert()`/`push_back()`
+    {
+        json tags;
+        tags.push_back("a");
+        tags.push_back(std::string{"b\n\"c\""});
+
+        json nested = json::parse(std::string{R"({"k": [1, {}, []], "e": {}})"});
+
+        json expected;
+        expected.insert("id", 42);
+        expected.insert("name", "Roboto");
+        expected.insert("ratio", 0.1);
+        expected.insert("flag", false);
+        expected.insert("none", nullptr);
+        expected.insert("tags", tags);
+        expected.insert("empty_arr", json::parse(std::string{"[]"}));
+        expected.insert("empty_obj", json::parse(std::string{"{}"}));
+        expected.insert("nested", nested);
+        expected.insert("point", writer_point{1, 2});
+        expected.insert("user", writer_id{7});
+
+        auto write = [&] (writer & w) {
+            w.begin_object()
+                .member("id", 42)
+                .member("name", "Roboto")
+                .member("ratio", 0.1)
+                .member("flag", false)
+                .member("none", nullptr)
+                .key("tags").begin_array().value("a").value(std::string{"b\n\"c\""}).end_array()
+                .key("empty_arr").begin_array().end_array()
+                .key("empty_obj").begin_object().end_object()
+                .member("nested", nested)
+                .member("point", writer_point{1, 2})
+                .member("user", writer_id{7})
+                .end_object();
+        };
+
+        writer w;
+        CHECK_FALSE(w.complete());
+        write(w);
+        CHECK(w.complete());
+        CHECK_EQ(w.depth(), 0);
+        CHECK_EQ(w.str(), to_string(expected));
+
+        auto path = fs::temp_directory_path() / pfs::utf8_decode_path("jeyson-writer-test.json");
+
+        auto read_file = [] (fs::path const & path) {
+            std::ifstream ifs(path, std::ios::binary);
+            return std::string{std::istreambuf_iterator<char>{ifs}, std::istreambuf_iterator<char>{}};
+        };
+
+        // Pretty output is the same as `save()` writes
+        for (int indent: {4, 2, 0}) {
+            writer pw {pretty(indent)};
+            write(pw);
+
+            expected.save(path, false, indent);
+            CHECK_EQ(pw.str(), read_file(path));
+        }
+
+        fs::remove(path);
+    }
+
+    // Top-level scalars and precision
+    {
+        std::string out {"prefix:"};
+        writer w {out};
+        w.value(-9223372036854775807LL - 1);
+        CHECK(w.complete());
+        CHECK_EQ(out, std::string{"prefix:-9223372036854775808"});
+        CHECK(w.str().empty());
+
+        jeyson::json_writer_options opts;
+        opts.precision = 17;
+
+        writer pw {opts};
+        pw.begin_array().value(0.1).value(1e300).value(true).end_array();
+        CHECK_EQ(pw.take(), std::string{"[0.10000000000000001,1.0000000000000001e300,true]"});
+        CHECK(pw.str().empty());
+
+        writer sw;
+        sw.value(std::string{"\x01\xD0\x96"});
+        CHECK_EQ(sw.str(), std::string{"\"\\u0001\xD0\x96\""});
+    }
+
+    // Sink receives the output by chunks
+    {
+        std::string received;
+        std::size_t calls = 0;
+
+        writer w {[& received, & calls] (char const * data, std::size_t n) {
+            received.append(data, n);
+            calls++;
+        }};
+
+        json expected;
+
+        w.begin_array();
+
+        for (int i = 0; i < 20000; i++) {
+            w.value(i);
+            expected.push_back(i);
+        }
+
+        CHECK_GT(calls, 0);
+        CHECK_LT(w.str().size(), writer::sink_threshold + 32);
+
+        w.end_array();
+
+        CHECK(w.str().empty());
+        CHECK_EQ(received, to_string(expected));
+        CHECK_EQ(json::parse(received), expected);
+    }
+
+    // Uninitialized value
+    {
+        writer w;
+        w.begin_array();
+        CHECK_THROWS_AS(w.value(json{}), jeyson::error);
+    }
+
+    // Non-finite real numbers are not representable in JSON
+    {
+        writer w;
+        w.begin_array().value(1.5);
+
+        for (double n: {std::numeric_limits<double>::quiet_NaN()
+                , std::numeric_limits<double>::infinity()
+                , -std::numeric_limits<double>::infinity()}) {
+            try {
+                w.value(n);
+                CHECK(false);
+            } catch (jeyson::error const & err) {
+                CHECK_EQ(err.code(), std::make_error_code(std::errc::invalid_argument));
+            }
+        }
+
+        w.end_array();
+        CHECK_EQ(w.str(), std::string{"[1.5]"});
+    }
+}
+
+void run_native_backend_tests ()
+{
+    using json = jeyson::json<jeyson::backend::native>;
+    using jansson_json = jeyson::json<jeyson::backend::jansson>;
+
+    auto popts = doctest::getContextOptions();
+    auto program = fs::path(pfs::utf8_decode_path(popts->binary_name.c_str()));
+    auto program_dir = program.parent_path();
+    auto path = program_dir / pfs::utf8_decode_path("data/twitter.json");
+
+    std::ifstream ifs(pfs::utf8_encode_path(path), std::ios::binary);
+    std::string content {std::istreambuf_iterator<char>{ifs}, std::istreambuf_iterator<char>{}};
+
+    // Same tree as built by Jansson
+    {
+        auto j = json::parse(content);
+        auto file_j = json::parse(path);
+
+        REQUIRE(j.is_object());
+        CHECK_EQ(file_j, j);
+        CHECK_EQ(json::parse(j.to_string()), j);
+        CHECK_EQ(jansson_json::parse(j.to_string()), jansson_json::parse(content));
+    }
+
+    // Large objects are indexed
+    {
+        json j;
+
+        for (int i = 0; i < 100; i++)
+            j[fmt::format("key{}", i)] = i;
+
+        REQUIRE_EQ(j.size(), 100);
+
+        j["key50"] = "fifty";
+
+        CHECK_EQ(j.size(), 100);
+        CHECK_EQ(jeyson::get<std::string>(j["key50"]), std::string{"fifty"});
+        CHECK_EQ(jeyson::get<int>(j.at("key99")), 99);
+        CHECK(!j.contains("key100"));
+
+        // Members are kept in insertion order
+        int i = 0;
+        bool ok = true;
+
+        for (auto it = j.begin(); it != j.end(); ++it, i++)
+            ok = ok && it.key() == fmt::format("key{}", i);
+
+        CHECK(ok);
+
+        auto copy = json::parse(j.to_string());
+        CHECK_EQ(copy, j);
+        CHECK(copy.contains("key77"));
+        CHECK_EQ(jeyson::get<int>(copy["key77"]), 77);
+    }
+
+    // Last duplicate wins, member keeps the first position
+    {
+        auto j = json::parse(std::string{R"({"a": 1, "b": 2, "a": 3})"});
+
+        CHECK_EQ(j.size(), 2);
+        CHECK_EQ(jeyson::get<int>(j["a"]), 3);
+        CHECK_EQ(j.begin().key(), std::string{"a"});
+    }
+
+    // Projection
+    {
+        auto j = json::parse(content, {"/search_metadata/count"});
+        auto expected = json::parse(content);
+
+        REQUIRE(j.is_object());
+        CHECK_EQ(j.size(), 1);
+        CHECK_EQ(j["search_metadata"]["count"], expected["search_metadata"]["count"]);
+        CHECK_EQ(json::parse(path, {"/search_metadata/count"}), j);
+    }
+
+    {
+        jeyson::error err;
+        auto j = json::parse(std::string{"[1, 2"}, & err);
+        CHECK(!j);
+        CHECK(err.code() != std::error_code{});
+    }
 }
 
 TEST_CASE("JSON Jansson backend") {
@@ -1044,5 +2713,59 @@ TEST_CASE("JSON Jansson backend") {
     run_access_tests<jeyson::backend::jansson>();
     run_parsing_tests<jeyson::backend::jansson>();
     run_algorithm_tests<jeyson::backend::jansson>();
+    run_view_tests<jeyson::backend::jansson>();
+    run_copy_on_write_tests<jeyson::backend::jansson>();
+    run_copy_on_write_at_tests<jeyson::backend::jansson>();
     run_serializer_tests<jeyson::backend::jansson>();
 }
+
+TEST_CASE("JSON native backend") {
+    run_basic_tests<jeyson::backend::native>();
+    run_assignment_tests<jeyson::backend::native>();
+    run_access_tests<jeyson::backend::native>();
+    run_parsing_tests<jeyson::backend::native>();
+    run_algorithm_tests<jeyson::backend::native>();
+    run_view_tests<jeyson::backend::native>();
+    run_copy_on_write_tests<jeyson::backend::native>();
+    run_copy_on_write_at_tests<jeyson::backend::native>();
+    run_serializer_tests<jeyson::backend::native>();
+    run_native_backend_tests();
+}
+
+TEST_CASE("JSON Jansson backend native parser") {
+    run_native_parser_tests();
+}
+
+TEST_CASE("JSON Jansson backend document") {
+    run_document_tests();
+}
+
+TEST_CASE("JSON Jansson backend push parser") {
+    run_push_parser_tests();
+}
+
+TEST_CASE("JSON Jansson backend JSON Lines parser") {
+    run_lines_tests();
+}
+
+TEST_CASE("JSON Jansson backend lazy document") {
+    run_lazy_tests();
+}
+
+TEST_CASE("JSON Jansson backend projection") {
+    run_projection_tests();
+}
+
+TEST_CASE("JSON Jansson backend writer") {
+    run_writer_tests();
+}
+
+TEST_CASE("JSON Jansson backend parallel parsing") {
+    run_parallel_parsing_tests();
+}
+
+#if JEYSON__INSTRUMENTATION_ENABLED
+TEST_CASE("JSON Jansson backend instrumentation") {
+    run_instrumentation_tests();
+}
+#endif
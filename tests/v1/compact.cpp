@@ -0,0 +1,212 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `jeyson-lib`.
+//
+// Changelog:
+//      2026.10.15 Initial version.
+////////////////////////////////////////////////////////////////////////////////
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../doctest.h"
+#include "pfs/jeyson/v1/compact.hpp"
+#include <limits>
+#include <string>
+
+using json_value = jeyson::v1::compact_value;
+using type_enum = jeyson::v1::type_enum;
+
+TEST_CASE("Layout") {
+    CHECK_EQ(sizeof(json_value), 16);
+}
+
+TEST_CASE("Constructors") {
+    CHECK(json_value{}.type() == type_enum::null);
+    CHECK(json_value{true}.type() == type_enum::boolean);
+    CHECK(json_value{std::numeric_limits<int>::min()}.type() == type_enum::integer);
+    CHECK(json_value{std::numeric_limits<unsigned int>::max()}.type() == type_enum::uinteger);
+    CHECK(json_value{3.14}.type() == type_enum::real);
+    CHECK(json_value{"hello"}.type() == type_enum::string);
+    CHECK(json_value{type_enum::array}.type() == type_enum::array);
+    CHECK(json_value{type_enum::object}.type() == type_enum::object);
+
+    CHECK(json_value{true}.is_boolean());
+    CHECK(json_value{-1}.is_number());
+    CHECK(json_value{1u}.is_integral());
+    CHECK(json_value{""}.is_string());
+}
+
+TEST_CASE("Strings") {
+    // Inline and allocated strings (the longest inline one is 14 bytes)
+    for (std::size_t n = 0; n <= 40; n++) {
+        std::string s(n, 'x');
+
+        for (std::size_t i = 0; i < n; i++)
+            s[i] = static_cast<char>('a' + i % 26);
+
+        json_value v {s};
+        REQUIRE(v.is_string());
+        CHECK_EQ(v.get<std::string>(), s);
+
+        json_value copy {v};
+        CHECK_EQ(copy.get<std::string>(), s);
+        CHECK(copy == v);
+
+        json_value moved {std::move(copy)};
+        CHECK(copy.is_null());
+        CHECK_EQ(moved.get<std::string>(), s);
+    }
+
+    {
+        std::string s {"a\0b", 3};
+        json_value v {s};
+        CHECK_EQ(v.get<std::string>(), s);
+        CHECK_FALSE(v == json_value{"a"});
+    }
+
+    {
+        json_value v {"hello, long enough string"};
+        v.clear();
+        CHECK(v.is_string());
+        CHECK(v.get<std::string>().empty());
+    }
+}
+
+TEST_CASE("Assign") {
+    json_value v;
+    v[0] = nullptr;
+    v[1] = true;
+    v[2] = 13;
+    v[3] = uint8_t{13};
+    v[4] = 3.14;
+    v[5] = "Hello";
+    v[6] = std::string{"Hello, long enough string"};
+
+    REQUIRE(v.is_array());
+    CHECK_EQ(v.size(), 7);
+    CHECK(v[0].is_null());
+    CHECK(v[1] == true);
+    CHECK(v[2].is_integer());
+    CHECK(v[2] == 13);
+    CHECK(v[3].is_uinteger());
+    CHECK(v[3] == 13);
+    CHECK(v[4] == 3.14);
+    CHECK(v[5] == "Hello");
+    CHECK(v[6] == "Hello, long enough string");
+
+    // Extended by nulls
+    v[10] = 1;
+    CHECK_EQ(v.size(), 11);
+    CHECK(v[8].is_null());
+
+    json_value obj;
+    obj["null"] = nullptr;
+    obj["boolean"] = true;
+    obj["integer"] = -13;
+    obj["C-string"] = "Hello";
+    obj["string"] = std::string{"Hello"};
+    obj["integer"] = 42;
+
+    REQUIRE(obj.is_object());
+    CHECK_EQ(obj.size(), 5);
+    CHECK(obj["integer"] == 42);
+
+    json_value const & cobj = obj;
+    CHECK(cobj["C-string"] == "Hello");
+    CHECK_THROWS_AS(cobj["unknown"], std::system_error);
+
+    v[11] = std::move(obj);
+    CHECK(obj.is_null());
+    CHECK(v[11]["boolean"] == true);
+
+    // Members are compared regardless of the order
+    json_value a;
+    a["x"] = 1;
+    a["y"] = 2;
+
+    json_value b;
+    b["y"] = 2;
+    b["x"] = 1;
+
+    CHECK(a == b);
+    b["x"] = 2;
+    CHECK_FALSE(a == b);
+
+    json_value copy {v};
+    CHECK(copy == v);
+
+    CHECK_THROWS_AS(json_value{true}[0], std::system_error);
+    CHECK_THROWS_AS(json_value{1}["a"], std::system_error);
+}
+
+TEST_CASE("Cast") {
+    json_value v {std::numeric_limits<int>::min()};
+    CHECK(v.get<bool>());
+    CHECK_EQ(v.get<int>(), std::numeric_limits<int>::min());
+    CHECK_EQ(v.get<double>(), static_cast<double>(std::numeric_limits<int>::min()));
+    CHECK_EQ(v.get<std::string>(), std::to_string(std::numeric_limits<int>::min()));
+
+    json_value s {"hello"};
+    CHECK_THROWS_AS(s.get<bool>(), std::system_error);
+    CHECK_THROWS_AS(s.get<int>(), std::system_error);
+    CHECK_THROWS_AS(s.get<double>(), std::system_error);
+}
+
+TEST_CASE("Iterators") {
+    {
+        json_value v {"hello"};
+        auto first = v.begin();
+        CHECK(first != v.end());
+        CHECK(++first == v.end());
+    }
+
+    {
+        json_value v {type_enum::array};
+        CHECK(v.begin() == v.end());
+
+        for (int i = 0; i < 100; i++)
+            v.push_back(json_value{i});
+
+        v += json_value{"last"};
+
+        int n = 0;
+
+        for (auto it = v.begin(); it != v.end(); ++it, ++n) {
+            if (n < 100)
+                CHECK(*it == n);
+            else
+                CHECK(*it == "last");
+        }
+
+        CHECK_EQ(n, 101);
+    }
+
+    {
+        json_value v;
+        v["a"] = 1;
+        v["b"] = 2;
+        v["c"] = 3;
+
+        json_value const & cv = v;
+        int sum = 0;
+
+        for (auto it = cv.begin(); it != cv.end(); ++it)
+            sum += (*it).get<int>();
+
+        CHECK_EQ(sum, 6);
+    }
+}
+
+TEST_CASE("Capacity") {
+    CHECK(json_value{}.empty());
+    CHECK_EQ(json_value{true}.size(), 1);
+    CHECK_EQ(json_value{"hello"}.max_size(), 1);
+    CHECK(json_value{type_enum::array}.empty());
+    CHECK(json_value{type_enum::object}.empty());
+
+    json_value v;
+    v[3] = 1;
+    CHECK_EQ(v.size(), 4);
+    v.clear();
+    CHECK(v.is_array());
+    CHECK(v.empty());
+}
@@ -6,6 +6,7 @@
 // Changelog:
 //      2020.04.15 Initial version (pfs-json).
 //      2022.02.07 Initial version (jeyson-lib).
+//      2026.10.15 Added array and object iteration tests.
 ////////////////////////////////////////////////////////////////////////////////
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #include "../doctest.h"
@@ -38,6 +39,32 @@ TEST_CASE("Iterators") {
         CHECK(first->get<bool>() == true);
     }
 
+    // Array and object elements
+    {
+        json_value arr;
+        arr[0] = 1;
+        arr[1] = 2;
+        arr[2] = 3;
+
+        int sum = 0;
+
+        for (auto first = arr.begin(), last = arr.end(); first != last; ++first)
+            sum += (*first).get<int>();
+
+        CHECK(sum == 6);
+
+        json_value obj;
+        obj["a"] = 10;
+        obj["b"] = 20;
+
+        sum = 0;
+
+        for (auto & v: obj)
+            sum += v.get<int>();
+
+        CHECK(sum == 30);
+    }
+
     {
         // Array
         // FIXME
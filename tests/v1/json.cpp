@@ -6,14 +6,52 @@
 // Changelog:
 //      2019.12.11 Initial version (pfs-json).
 //      2022.02.07 Initial version (jeyson-lib).
+//      2026.10.16 Added allocator tests.
 ////////////////////////////////////////////////////////////////////////////////
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #include "../doctest.h"
 #include "pfs/jeyson/v1/json.hpp"
 #include <limits>
+#include <memory>
 
 using std::to_string;
 
+namespace {
+
+int allocations = 0;
+int deallocations = 0;
+
+template <typename T>
+struct counting_allocator
+{
+    using value_type = T;
+
+    counting_allocator () = default;
+
+    template <typename U>
+    counting_allocator (counting_allocator<U> const &) {}
+
+    T * allocate (std::size_t n)
+    {
+        allocations++;
+        return std::allocator<T>{}.allocate(n);
+    }
+
+    void deallocate (T * p, std::size_t n)
+    {
+        deallocations++;
+        std::allocator<T>{}.deallocate(p, n);
+    }
+
+    template <typename U>
+    bool operator == (counting_allocator<U> const &) const { return true; }
+
+    template <typename U>
+    bool operator != (counting_allocator<U> const &) const { return false; }
+};
+
+} // namespace
+
 TEST_CASE("Constructors") {
     using json_value = jeyson::v1::value<>;
     using type_enum = jeyson::v1::type_enum;
@@ -510,3 +548,38 @@ TEST_CASE("Modifiers") {
 //         CHECK(v.max_size() == json_value::object_type().max_size());
     }
 }
+
+TEST_CASE("Allocator") {
+    using json_value = jeyson::v1::value<bool, std::intmax_t, std::uintmax_t
+        , double, std::string, jeyson::v1::array_type, jeyson::v1::object_type
+        , counting_allocator<char>>;
+
+    allocations = 0;
+    deallocations = 0;
+
+    {
+        json_value v;
+        v["string"] = "hello";
+        v["array"][2] = 1;
+        v["integer"] = 42;
+
+        // Object, string and array storages
+        CHECK_EQ(allocations, 3);
+
+        json_value copy {v};
+        CHECK_EQ(allocations, 6);
+        CHECK(copy == v);
+
+        json_value moved {std::move(copy)};
+        CHECK_EQ(allocations, 6);
+        CHECK(moved == v);
+    }
+
+    CHECK_EQ(deallocations, allocations);
+
+    {
+        json_value v {42};
+        v.discard();
+        CHECK(v.is_null());
+    }
+}
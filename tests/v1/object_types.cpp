@@ -0,0 +1,185 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `jeyson-lib`.
+//
+// Changelog:
+//      2026.10.16 Initial version.
+////////////////////////////////////////////////////////////////////////////////
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../doctest.h"
+#include "pfs/jeyson/v1/json.hpp"
+#include "pfs/jeyson/v1/object_types.hpp"
+#include <string>
+
+using sorted_object = jeyson::v1::sorted_object<std::string, int>;
+using ordered_object = jeyson::v1::ordered_object<std::string, int>;
+using hashed_object = jeyson::v1::hashed_object<std::string, int>;
+
+// Index is built early
+template <typename K, typename V>
+using small_ordered_object = jeyson::v1::basic_ordered_object<K, V, 2>;
+
+TEST_CASE_TEMPLATE("Object storages", Object, sorted_object, ordered_object
+    , hashed_object, small_ordered_object<std::string, int>) {
+
+    Object obj;
+    CHECK(obj.empty());
+    CHECK(obj.begin() == obj.end());
+    CHECK(obj.find("a") == obj.end());
+    CHECK(obj.max_size() > 0);
+
+    // Enough members to build the index and to grow the hash table
+    int const n = 1000;
+
+    for (int i = 0; i < n; i++)
+        obj[std::to_string(i)] = i;
+
+    CHECK_EQ(obj.size(), n);
+
+    for (int i = 0; i < n; i++) {
+        auto key = std::to_string(i);
+        auto pos = obj.find(key);
+        REQUIRE(pos != obj.end());
+        CHECK_EQ(pos->first, key);
+        CHECK_EQ(pos->second, i);
+        CHECK_EQ(obj.count(key), 1);
+    }
+
+    CHECK(obj.find("unknown") == obj.end());
+    CHECK_EQ(obj.count("unknown"), 0);
+
+    // Existing member is not replaced
+    auto result = obj.emplace("7", 0);
+    CHECK_FALSE(result.second);
+    CHECK_EQ(result.first->second, 7);
+
+    result = obj.emplace("new", 42);
+    CHECK(result.second);
+    CHECK_EQ(result.first->second, 42);
+    CHECK_EQ(obj.size(), n + 1);
+
+    obj["7"] = 77;
+    CHECK_EQ(obj.size(), n + 1);
+    CHECK_EQ(obj.find("7")->second, 77);
+
+    // Every member is visited once forward and backward
+    long sum = 0;
+    std::size_t count = 0;
+
+    for (auto const & m: obj) {
+        sum += m.second;
+        count++;
+    }
+
+    CHECK_EQ(count, obj.size());
+
+    long reverse_sum = 0;
+
+    for (auto pos = obj.end(); pos != obj.begin();)
+        reverse_sum += (--pos)->second;
+
+    CHECK_EQ(sum, reverse_sum);
+
+    // Members are compared regardless of the order
+    Object copy {obj};
+    CHECK(copy == obj);
+
+    Object reversed;
+
+    for (auto pos = obj.end(); pos != obj.begin();) {
+        --pos;
+        reversed.emplace(pos->first, pos->second);
+    }
+
+    CHECK(reversed == obj);
+    reversed["7"] = 7;
+    CHECK(reversed != obj);
+
+    Object moved {std::move(copy)};
+    CHECK(moved == obj);
+
+    Object const & cobj = obj;
+    CHECK(cobj.find("new") != cobj.end());
+    CHECK(cobj.find("unknown") == cobj.end());
+
+    obj.clear();
+    CHECK(obj.empty());
+    CHECK(obj.begin() == obj.end());
+    CHECK(obj.find("1") == obj.end());
+
+    obj["1"] = 1;
+    CHECK_EQ(obj.size(), 1);
+    CHECK_EQ(obj.find("1")->second, 1);
+}
+
+TEST_CASE("Sorted object order") {
+    sorted_object obj;
+    obj["c"] = 3;
+    obj["a"] = 1;
+    obj["b"] = 2;
+
+    std::string keys;
+
+    for (auto const & m: obj)
+        keys += m.first;
+
+    CHECK_EQ(keys, "abc");
+}
+
+TEST_CASE("Ordered object order") {
+    ordered_object obj;
+
+    for (char c = 'z'; c >= 'a'; c--)
+        obj[std::string(1, c)] = c;
+
+    std::string keys;
+
+    for (auto const & m: obj)
+        keys += m.first;
+
+    CHECK_EQ(keys, "zyxwvutsrqponmlkjihgfedcba");
+}
+
+template <template <typename, typename> class ObjectType>
+using json_value = jeyson::v1::value<bool, std::intmax_t, std::uintmax_t
+    , double, std::string, jeyson::v1::array_type, ObjectType>;
+
+template <template <typename, typename> class ObjectType>
+void check_value ()
+{
+    using value_type = json_value<ObjectType>;
+
+    value_type v;
+    v["integer"] = 42;
+    v["string"] = "hello";
+    v["real"] = 3.14;
+
+    REQUIRE(v.is_object());
+    CHECK_EQ(v.size(), 3);
+    CHECK(v["integer"] == 42);
+    CHECK(v["string"] == "hello");
+
+    value_type const & cv = v;
+    CHECK(cv["real"] == 3.14);
+
+    value_type nested;
+    nested["value"] = std::move(v);
+    CHECK(nested["value"]["integer"] == 42);
+
+    value_type copy {nested};
+    CHECK(copy == nested);
+
+    int count = 0;
+
+    for (auto pos = nested["value"].begin(); pos != nested["value"].end(); ++pos)
+        count++;
+
+    CHECK_EQ(count, 3);
+}
+
+TEST_CASE("Value with object storages") {
+    check_value<jeyson::v1::sorted_object>();
+    check_value<jeyson::v1::ordered_object>();
+    check_value<jeyson::v1::hashed_object>();
+}
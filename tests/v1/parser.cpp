@@ -6,11 +6,18 @@
 // Changelog:
 //      2019.12.11 Initial version (pfs-json).
 //      2022.02.07 Initial version (jeyson-lib).
+//      2026.10.15 Added test for handler passed by reference.
+//                 Check escaped quotation mark.
+//                 Added floating point number tests.
+//                 Added nesting depth and contiguous input tests.
 ////////////////////////////////////////////////////////////////////////////////
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #include "../doctest.h"
 #include "pfs/jeyson/v1/parser.hpp"
+#include <deque>
+#include <limits>
 #include <string>
+#include <vector>
 
 TEST_CASE("is_whitespace") {
     using jeyson::v1::is_whitespace;
@@ -253,6 +260,9 @@ TEST_CASE("advance_string") {
             , std::back_inserter(s)
             , ec) == data[i].r);
         CHECK(ec == data[i].ec);
+
+        if (data[i].r)
+            CHECK(pos == last);
     }
 }
 
@@ -411,6 +421,79 @@ TEST_CASE("advance_number for custom number type") {
     }
 }
 
+TEST_CASE("advance_number for floating points") {
+    using jeyson::v1::advance_number;
+    using jeyson::v1::relaxed_policy;
+
+    test_advance_number<double> data[] = {
+          {  0.5, "0.5"  , true }
+        , { -0.5, "-0.5" , true }
+        , {  0.5, "+0.5" , false }
+        , {  0.5, "+0.5" , true, relaxed_policy() }
+        , { 1e10, "1e10" , true }
+        , { 1e10, "1E+10", true }
+        , { 1.5e-10, "15e-11", true }
+        , { 0, "1." , false }
+        , { 0, "1e" , false }
+        , { 0, "1e+", false }
+        , { 0, "-"  , false }
+        , { 0, ".5" , false }
+        , { 0.1, "0.1", true }
+        , { 1.7976931348623157e308, "1.7976931348623157e308", true }
+        , { 0, "1e309", false }
+        , { 4.9406564584124654e-324, "4.9406564584124654e-324", true }
+        , { 0.30000000000000004, "0.3000000000000000444089209850062616169452667236328125", true }
+        , { 18446744073709551616.0, "18446744073709551616", true }
+        , { -9223372036854775809.0, "-9223372036854775809", true }
+    };
+
+    for (int i = 0, count = sizeof(data) / sizeof(data[0])
+            ; i < count; i++) {
+        auto pos  = data[i].s.begin();
+        auto last = data[i].s.end();
+        std::error_code ec;
+
+        double num;
+        auto ok = advance_number(pos, last, data[i].parse_policy, & num, ec);
+
+        CHECK(ok == data[i].r);
+
+        if (ok) {
+            CHECK(pos == last);
+            CHECK(num == data[i].num);
+        }
+    }
+}
+
+TEST_CASE("advance_number for 64-bit integers") {
+    using jeyson::v1::advance_number;
+    using jeyson::v1::strict_policy;
+
+    std::string s = std::to_string((std::numeric_limits<uintmax_t>::max)());
+    auto pos = s.begin();
+    std::error_code ec;
+    uintmax_t u = 0;
+
+    REQUIRE(advance_number(pos, s.end(), strict_policy(), & u, ec));
+    CHECK(pos == s.end());
+    CHECK(u == (std::numeric_limits<uintmax_t>::max)());
+
+    s = std::to_string((std::numeric_limits<intmax_t>::min)());
+    pos = s.begin();
+    intmax_t n = 0;
+
+    REQUIRE(advance_number(pos, s.end(), strict_policy(), & n, ec));
+    CHECK(pos == s.end());
+    CHECK(n == (std::numeric_limits<intmax_t>::min)());
+
+    // Leading zero terminates number
+    s = "012";
+    pos = s.begin();
+    REQUIRE(advance_number(pos, s.end(), strict_policy(), & n, ec));
+    CHECK(n == 0);
+    CHECK(pos == s.begin() + 1);
+}
+
 TEST_CASE("parse_array of booleans") {
     using jeyson::v1::parse_array;
     using jeyson::v1::strict_policy;
@@ -569,3 +652,271 @@ TEST_CASE("parse_object of strings") {
     CHECK(obj["three"] == "three");
 }
 
+
+struct counting_handler
+{
+    using string_type = std::string;
+    using number_type = double;
+
+    int errors {0};
+    int nulls {0};
+    int booleans {0};
+    int numbers {0};
+    int strings {0};
+    int names {0};
+    int arrays {0};
+    int objects {0};
+
+    counting_handler () = default;
+    counting_handler (counting_handler const &) = delete;
+    counting_handler & operator = (counting_handler const &) = delete;
+
+    void on_error (std::error_code const &) { errors++; }
+    void on_null () { nulls++; }
+    void on_true () { booleans++; }
+    void on_false () { booleans++; }
+    void on_number (number_type &&) { numbers++; }
+    void on_string (string_type &&) { strings++; }
+    void on_member_name (string_type &&) { names++; }
+    void on_begin_array () { arrays++; }
+    void on_end_array () {}
+    void on_begin_object () { objects++; }
+    void on_end_object () {}
+};
+
+TEST_CASE("parse with handler passed by reference") {
+    using jeyson::v1::parse;
+    using jeyson::v1::strict_policy;
+
+    auto s = std::string{R"({"a": [1, 2.5, true, false, null], "b": {"c": "d"}})"};
+
+    counting_handler h;
+    auto pos = parse(s.begin(), s.end(), strict_policy(), h);
+
+    REQUIRE(pos == s.end());
+    CHECK_EQ(h.errors, 0);
+    CHECK_EQ(h.nulls, 1);
+    CHECK_EQ(h.booleans, 2);
+    CHECK_EQ(h.numbers, 2);
+    CHECK_EQ(h.strings, 1);
+    CHECK_EQ(h.names, 3);
+    CHECK_EQ(h.arrays, 1);
+    CHECK_EQ(h.objects, 2);
+
+    auto bad = std::string{"[1, 2"};
+    counting_handler h1;
+    CHECK(parse(bad.begin(), bad.end(), strict_policy(), h1) == bad.begin());
+    CHECK(h1.errors > 0);
+}
+
+TEST_CASE("parse nesting depth") {
+    using jeyson::v1::parse;
+    using jeyson::v1::parse_options;
+    using jeyson::v1::strict_policy;
+
+    struct error_handler : counting_handler
+    {
+        std::error_code ec;
+        void on_error (std::error_code const & e) { errors++; ec = e; }
+    };
+
+    // Deep nesting does not consume the C++ stack
+    {
+        std::size_t depth = 100000;
+        auto s = std::string(depth, '[') + std::string(depth, ']');
+
+        parse_options options;
+        options.max_depth = depth;
+
+        error_handler h;
+        CHECK(parse(s.begin(), s.end(), strict_policy(), options, h) == s.end());
+        CHECK_EQ(h.errors, 0);
+        CHECK_EQ(h.arrays, static_cast<int>(depth));
+
+        error_handler h1;
+        CHECK(parse(s.begin(), s.end(), strict_policy(), h1) == s.begin());
+        CHECK_EQ(h1.errors, 1);
+        CHECK(h1.ec == jeyson::make_error_code(jeyson::errc::max_depth_exceeded));
+    }
+
+    // Limit is exact
+    {
+        auto s = std::string{R"({"a": [{"b": [1, {}]}, []]})"};
+
+        parse_options options;
+        options.max_depth = 5;
+
+        error_handler h;
+        CHECK(parse(s.begin(), s.end(), strict_policy(), options, h) == s.end());
+        CHECK_EQ(h.errors, 0);
+        CHECK_EQ(h.objects, 3);
+        CHECK_EQ(h.arrays, 3);
+
+        options.max_depth = 4;
+        options.stack_reserve = 16;
+
+        error_handler h1;
+        CHECK(parse(s.begin(), s.end(), strict_policy(), options, h1) == s.begin());
+        CHECK(h1.ec == jeyson::make_error_code(jeyson::errc::max_depth_exceeded));
+    }
+
+    // Single error is reported
+    {
+        struct { char const * s; jeyson::errc ec; } data[] = {
+              { "[1 2]", jeyson::errc::unbalanced_array_bracket }
+            , { "{\"a\": 1 \"b\": 2}", jeyson::errc::unbalanced_object_bracket }
+            , { "[[1, 2], \"\\x\"]", jeyson::errc::bad_escaped_char }
+            , { "{1: 2}", jeyson::errc::bad_member_name }
+            , { "{\"a\" 1}", jeyson::errc::bad_json_sequence }
+            , { "[1, ]", jeyson::errc::bad_json_sequence }
+            , { "[1, ", jeyson::errc::bad_json_sequence }
+        };
+
+        for (auto const & d: data) {
+            auto s = std::string{d.s};
+            error_handler h;
+            CHECK(parse(s.begin(), s.end(), strict_policy(), h) == s.begin());
+            CHECK_EQ(h.errors, 1);
+            CHECK(h.ec == jeyson::make_error_code(d.ec));
+        }
+    }
+}
+
+struct recording_handler
+{
+    using string_type = std::string;
+    using number_type = double;
+
+    std::vector<std::string> events;
+
+    void on_error (std::error_code const & ec) { events.push_back("error:" + ec.message()); }
+    void on_null () { events.push_back("null"); }
+    void on_true () { events.push_back("true"); }
+    void on_false () { events.push_back("false"); }
+    void on_number (number_type && n) { events.push_back("number:" + std::to_string(n)); }
+    void on_string (string_type && s) { events.push_back("string:" + s); }
+    void on_member_name (string_type && s) { events.push_back("name:" + s); }
+    void on_begin_array () { events.push_back("["); }
+    void on_end_array () { events.push_back("]"); }
+    void on_begin_object () { events.push_back("{"); }
+    void on_end_object () { events.push_back("}"); }
+};
+
+TEST_CASE("parse contiguous input") {
+    using jeyson::v1::parse;
+    using jeyson::v1::relaxed_policy;
+    using jeyson::v1::strict_policy;
+
+    static_assert(jeyson::v1::is_contiguous_char_iterator<std::string::const_iterator>::value, "");
+    static_assert(!jeyson::v1::is_contiguous_char_iterator<std::deque<char>::iterator>::value, "");
+
+    struct { std::string s; jeyson::v1::parse_policy_set policy; } data[] = {
+          { R"({"a": [1, 2.5, true, false, null], "b": {"c": "d"}})", strict_policy() }
+        , { "{\n        \"indented\":\n                [\"long string without escapes\", 12345678901234567890]\n}  ", strict_policy() }
+        , { R"(["esc\"aped \\ \/ \b\f\n\r\t \u0041 tail of the string", "\u00"])", strict_policy() }
+        , { R"(["x\u0041"])", strict_policy() }
+        , { R"([0.000000000012345678901234, 1234567890.1234567890123, -98765432109876543210e-5, 1e5])", strict_policy() }
+        , { R"(['single \' quoted', "\q"])", relaxed_policy() }
+        , { R"(["\q"])", strict_policy() }
+        , { R"(["unterminated string)", strict_policy() }
+        , { R"(["unterminated escape\)", strict_policy() }
+        , { R"(["\u12)", strict_policy() }
+        , { R"([nul, 1])", strict_policy() }
+        , { R"([tru)", strict_policy() }
+        , { "  null  ", relaxed_policy() }
+        , { "", strict_policy() }
+    };
+
+    for (auto const & d: data) {
+        std::deque<char> generic_input(d.s.begin(), d.s.end());
+
+        recording_handler generic;
+        auto generic_pos = parse(generic_input.begin(), generic_input.end(), d.policy, generic);
+
+        recording_handler contiguous;
+        auto pos = parse(d.s.cbegin(), d.s.cend(), d.policy, contiguous);
+
+        CHECK_EQ(contiguous.events, generic.events);
+        CHECK_EQ(pos - d.s.cbegin(), generic_pos - generic_input.begin());
+
+        recording_handler raw;
+        auto raw_pos = parse(d.s.data(), d.s.data() + d.s.size(), d.policy, raw);
+
+        CHECK_EQ(raw.events, generic.events);
+        CHECK_EQ(raw_pos - d.s.data(), generic_pos - generic_input.begin());
+    }
+}
+
+struct view_handler
+{
+    using string_type = pfs::string_view;
+    using number_type = double;
+
+    std::string const * source {nullptr};
+    std::vector<std::string> strings;
+    int in_source {0};
+    int errors {0};
+
+    void check (string_type const & s)
+    {
+        strings.push_back(std::string(s.data(), s.size()));
+
+        if (s.data() >= source->data() && s.data() < source->data() + source->size())
+            in_source++;
+    }
+
+    void on_error (std::error_code const &) { errors++; }
+    void on_null () {}
+    void on_true () {}
+    void on_false () {}
+    void on_number (number_type &&) {}
+    void on_string (string_type && s) { check(s); }
+    void on_member_name (string_type && s) { check(s); }
+    void on_begin_array () {}
+    void on_end_array () {}
+    void on_begin_object () {}
+    void on_end_object () {}
+};
+
+TEST_CASE("parse with string views") {
+    using jeyson::v1::parse;
+    using jeyson::v1::strict_policy;
+
+    auto s = std::string{R"({"plain": "value", "esc\"aped": ["a\nb", "", "ABC", "long string without escapes"]})"};
+
+    recording_handler owned;
+    parse(s.cbegin(), s.cend(), strict_policy(), owned);
+
+    std::vector<std::string> expected;
+
+    for (auto const & e: owned.events) {
+        if (e.compare(0, 5, "name:") == 0)
+            expected.push_back(e.substr(5));
+        else if (e.compare(0, 7, "string:") == 0)
+            expected.push_back(e.substr(7));
+    }
+
+    // Contiguous input: escape-free strings refer to the source
+    view_handler h;
+    h.source = & s;
+    CHECK(parse(s.cbegin(), s.cend(), strict_policy(), h) == s.cend());
+    CHECK_EQ(h.errors, 0);
+    CHECK_EQ(h.strings, expected);
+    CHECK_EQ(h.in_source, 5);
+
+    // Generic input: all strings are decoded into the scratch buffer
+    std::deque<char> generic_input(s.begin(), s.end());
+    view_handler h1;
+    h1.source = & s;
+    CHECK(parse(generic_input.begin(), generic_input.end(), strict_policy(), h1) == generic_input.end());
+    CHECK_EQ(h1.strings, expected);
+    CHECK_EQ(h1.in_source, 0);
+
+    // Errors are the same as for owned delivery
+    auto bad = std::string{R"(["ok", "bad \x escape"])"};
+    view_handler h2;
+    h2.source = & bad;
+    CHECK(parse(bad.cbegin(), bad.cend(), strict_policy(), h2) == bad.cbegin());
+    CHECK_EQ(h2.errors, 1);
+    CHECK_EQ(h2.strings.size(), 1);
+}
@@ -0,0 +1,128 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2026 Vladislav Trifochkin
+//
+// This file is part of `jeyson-lib`.
+//
+// Changelog:
+//      2026.10.16 Initial version.
+////////////////////////////////////////////////////////////////////////////////
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "../doctest.h"
+#include "pfs/jeyson/v1/pmr.hpp"
+#include <memory_resource>
+#include <string>
+
+using json_value = jeyson::v1::pmr::value;
+using jeyson::v1::pmr::resource_scope;
+
+namespace {
+
+class counting_resource : public std::pmr::memory_resource
+{
+public:
+    int allocations {0};
+    int deallocations {0};
+
+private:
+    void * do_allocate (std::size_t bytes, std::size_t alignment) override
+    {
+        allocations++;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate (void * p, std::size_t bytes, std::size_t alignment) override
+    {
+        deallocations++;
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal (std::pmr::memory_resource const & other) const noexcept override
+    {
+        return this == & other;
+    }
+};
+
+// Any allocation out of the scopes throws
+struct null_default_resource
+{
+    std::pmr::memory_resource * prev;
+
+    null_default_resource ()
+        : prev(std::pmr::set_default_resource(std::pmr::null_memory_resource()))
+    {}
+
+    ~null_default_resource ()
+    {
+        std::pmr::set_default_resource(prev);
+    }
+};
+
+void fill (json_value & v)
+{
+    v["string"] = "string longer than the small string buffer";
+    v["array"][3] = 3.14;
+    v["object"]["integer"] = 42;
+    v["object"]["boolean"] = true;
+}
+
+} // namespace
+
+TEST_CASE("Scoped resource") {
+    null_default_resource guard;
+    counting_resource r1;
+    counting_resource r2;
+
+    {
+        resource_scope scope {& r1};
+        json_value v;
+        fill(v);
+
+        CHECK(r1.allocations > 0);
+        CHECK(v["object"]["integer"] == 42);
+        CHECK(v["array"][3] == 3.14);
+
+        {
+            // Copy allocates from the current resource
+            resource_scope nested {& r2};
+            json_value copy {v};
+            CHECK(r2.allocations > 0);
+            CHECK(copy == v);
+        }
+
+        CHECK_EQ(r2.deallocations, r2.allocations);
+
+        // Scope is restored
+        auto n = r1.allocations;
+        v["another"] = "string longer than the small string buffer";
+        CHECK(r1.allocations > n);
+    }
+
+    CHECK_EQ(r1.deallocations, r1.allocations);
+    CHECK_THROWS_AS(json_value{"string longer than the small string buffer"}, std::bad_alloc);
+}
+
+TEST_CASE("Monotonic resource") {
+    null_default_resource guard;
+    counting_resource upstream;
+
+    {
+        std::pmr::monotonic_buffer_resource buffer {& upstream};
+        resource_scope scope {& buffer};
+
+        json_value v;
+
+        for (int i = 0; i < 100; i++)
+            fill(v["items"][i]);
+
+        CHECK_EQ(v["items"].size(), 100);
+        CHECK(v["items"][99]["object"]["boolean"] == true);
+        CHECK(upstream.allocations > 0);
+
+        // The tree is dropped without destruction and released by the buffer
+        v.discard();
+        CHECK(v.is_null());
+        CHECK_EQ(upstream.deallocations, 0);
+    }
+
+    CHECK_EQ(upstream.deallocations, upstream.allocations);
+}